@@ -0,0 +1,621 @@
+//           Copyright agent 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//      (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_DIFFERENTIATION_AUTODIFF_LANES_HPP
+#define BOOST_MATH_DIFFERENTIATION_AUTODIFF_LANES_HPP
+
+#include <boost/math/constants/constants.hpp>
+#include <boost/math/special_functions/digamma.hpp>
+#include <boost/math/special_functions/erf.hpp>
+#include <boost/math/special_functions/gamma.hpp>
+#include <boost/math/special_functions/polygamma.hpp>
+#include <boost/math/tools/config.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <ostream>
+
+// fvar_lanes<RealType, Order, Lanes> carries Lanes independent evaluation points ("lanes") of one variable of
+// differentiation through a single computation. Each of the Order+1 Taylor coefficients is stored as a contiguous
+// array of Lanes values, and every operation is a loop across the lanes with no data-dependent branches, so that
+// the compiler can map the lanes onto SIMD registers. Unlike fvar there are no comparison operators: the lanes may
+// take different branches, which a single expression cannot.
+
+namespace boost {
+namespace math {
+namespace differentiation {
+// Automatic Differentiation v1
+inline namespace autodiff_v1 {
+namespace detail {
+
+template <typename RealType, size_t Order, size_t Lanes>
+class fvar_lanes {
+ public:
+  using root_type = RealType;
+  using lane_type = std::array<RealType, Lanes>;
+  static constexpr size_t order_sum = Order;
+  static constexpr size_t lanes = Lanes;
+
+  fvar_lanes() = default;
+
+  // Initialize a constant with the same value in every lane.
+  fvar_lanes(root_type const& ca);
+
+  // Initialize a constant with a value per lane.
+  explicit fvar_lanes(lane_type const& ca);
+
+  // Initialize a variable or constant with a value per lane.
+  fvar_lanes(lane_type const& ca, bool const is_variable);
+
+  // Taylor coefficient i of every lane: derivative(i)/factorial(i).
+  lane_type const& operator[](size_t i) const { return v[i]; }
+  lane_type& operator[](size_t i) { return v[i]; }
+
+  // Derivative of the given order in every lane.
+  lane_type derivative(size_t order) const;
+
+  // Value in every lane, equivalent to derivative(0).
+  lane_type const& value() const { return v.front(); }
+
+  fvar_lanes& operator+=(fvar_lanes const&);
+  fvar_lanes& operator+=(root_type const&);
+  fvar_lanes& operator-=(fvar_lanes const&);
+  fvar_lanes& operator-=(root_type const&);
+  fvar_lanes& operator*=(fvar_lanes const&);
+  fvar_lanes& operator*=(root_type const&);
+  fvar_lanes& operator/=(fvar_lanes const&);
+  fvar_lanes& operator/=(root_type const&);
+
+  fvar_lanes operator-() const;
+  fvar_lanes const& operator+() const { return *this; }
+
+  // Multiplicative inverse 1/(*this).
+  fvar_lanes inverse() const;
+
+  // Same as *this less its value in every lane: the infinitesimal part.
+  fvar_lanes epsilon() const;
+
+  // f : order -> lane_type of derivative(order)/factorial(order) of some function at the value of *this.
+  // Returns that function composed with *this.
+  template <typename Func>
+  fvar_lanes apply_coefficients(Func const& f) const;
+
+  // f : order -> lane_type of derivative(order) of some function at the value of *this.
+  template <typename Func>
+  fvar_lanes apply_derivatives(Func const& f) const;
+
+ private:
+  // v[i][j] is Taylor coefficient i in lane j.
+  std::array<lane_type, Order + 1> v{};
+};
+
+// Standard math functions are overloaded and called via argument-dependent lookup (ADL).
+
+template <typename RealType, size_t Order, size_t Lanes>
+fvar_lanes<RealType, Order, Lanes> operator+(fvar_lanes<RealType, Order, Lanes> cr1,
+                                             fvar_lanes<RealType, Order, Lanes> const& cr2) {
+  return cr1 += cr2;
+}
+
+template <typename RealType, size_t Order, size_t Lanes>
+fvar_lanes<RealType, Order, Lanes> operator+(fvar_lanes<RealType, Order, Lanes> cr,
+                                             typename fvar_lanes<RealType, Order, Lanes>::root_type const& ca) {
+  return cr += ca;
+}
+
+template <typename RealType, size_t Order, size_t Lanes>
+fvar_lanes<RealType, Order, Lanes> operator+(typename fvar_lanes<RealType, Order, Lanes>::root_type const& ca,
+                                             fvar_lanes<RealType, Order, Lanes> cr) {
+  return cr += ca;
+}
+
+template <typename RealType, size_t Order, size_t Lanes>
+fvar_lanes<RealType, Order, Lanes> operator-(fvar_lanes<RealType, Order, Lanes> cr1,
+                                             fvar_lanes<RealType, Order, Lanes> const& cr2) {
+  return cr1 -= cr2;
+}
+
+template <typename RealType, size_t Order, size_t Lanes>
+fvar_lanes<RealType, Order, Lanes> operator-(fvar_lanes<RealType, Order, Lanes> cr,
+                                             typename fvar_lanes<RealType, Order, Lanes>::root_type const& ca) {
+  return cr -= ca;
+}
+
+template <typename RealType, size_t Order, size_t Lanes>
+fvar_lanes<RealType, Order, Lanes> operator-(typename fvar_lanes<RealType, Order, Lanes>::root_type const& ca,
+                                             fvar_lanes<RealType, Order, Lanes> const& cr) {
+  return -cr += ca;
+}
+
+template <typename RealType, size_t Order, size_t Lanes>
+fvar_lanes<RealType, Order, Lanes> operator*(fvar_lanes<RealType, Order, Lanes> cr1,
+                                             fvar_lanes<RealType, Order, Lanes> const& cr2) {
+  return cr1 *= cr2;
+}
+
+template <typename RealType, size_t Order, size_t Lanes>
+fvar_lanes<RealType, Order, Lanes> operator*(fvar_lanes<RealType, Order, Lanes> cr,
+                                             typename fvar_lanes<RealType, Order, Lanes>::root_type const& ca) {
+  return cr *= ca;
+}
+
+template <typename RealType, size_t Order, size_t Lanes>
+fvar_lanes<RealType, Order, Lanes> operator*(typename fvar_lanes<RealType, Order, Lanes>::root_type const& ca,
+                                             fvar_lanes<RealType, Order, Lanes> cr) {
+  return cr *= ca;
+}
+
+template <typename RealType, size_t Order, size_t Lanes>
+fvar_lanes<RealType, Order, Lanes> operator/(fvar_lanes<RealType, Order, Lanes> cr1,
+                                             fvar_lanes<RealType, Order, Lanes> const& cr2) {
+  return cr1 /= cr2;
+}
+
+template <typename RealType, size_t Order, size_t Lanes>
+fvar_lanes<RealType, Order, Lanes> operator/(fvar_lanes<RealType, Order, Lanes> cr,
+                                             typename fvar_lanes<RealType, Order, Lanes>::root_type const& ca) {
+  return cr /= ca;
+}
+
+template <typename RealType, size_t Order, size_t Lanes>
+fvar_lanes<RealType, Order, Lanes> operator/(typename fvar_lanes<RealType, Order, Lanes>::root_type const& ca,
+                                             fvar_lanes<RealType, Order, Lanes> const& cr) {
+  return cr.inverse() *= ca;
+}
+
+template <typename RealType, size_t Order, size_t Lanes>
+std::ostream& operator<<(std::ostream& out, fvar_lanes<RealType, Order, Lanes> const& cr) {
+  out << '[';
+  for (size_t j = 0; j < Lanes; ++j) {
+    out << (j ? "," : "") << "depth(1)(" << cr[0][j];
+    for (size_t i = 1; i <= Order; ++i)
+      out << ',' << cr[i][j];
+    out << ')';
+  }
+  return out << ']';
+}
+
+template <typename RealType, size_t Order, size_t Lanes>
+fvar_lanes<RealType, Order, Lanes>::fvar_lanes(root_type const& ca) {
+  v.front().fill(ca);
+}
+
+template <typename RealType, size_t Order, size_t Lanes>
+fvar_lanes<RealType, Order, Lanes>::fvar_lanes(lane_type const& ca) {
+  v.front() = ca;
+}
+
+template <typename RealType, size_t Order, size_t Lanes>
+fvar_lanes<RealType, Order, Lanes>::fvar_lanes(lane_type const& ca, bool const is_variable) {
+  v.front() = ca;
+  BOOST_IF_CONSTEXPR (0 < Order)
+    if (is_variable)
+      v[(std::min)(size_t(1), Order)].fill(static_cast<root_type>(1));
+}
+
+template <typename RealType, size_t Order, size_t Lanes>
+typename fvar_lanes<RealType, Order, Lanes>::lane_type fvar_lanes<RealType, Order, Lanes>::derivative(
+    size_t order) const {
+  lane_type r{};
+  if (order <= Order) {
+    root_type factorial = 1;
+    for (size_t i = 2; i <= order; ++i)
+      factorial *= static_cast<root_type>(i);
+    for (size_t j = 0; j < Lanes; ++j)
+      r[j] = v[order][j] * factorial;
+  }
+  return r;
+}
+
+template <typename RealType, size_t Order, size_t Lanes>
+fvar_lanes<RealType, Order, Lanes>& fvar_lanes<RealType, Order, Lanes>::operator+=(fvar_lanes const& cr) {
+  for (size_t i = 0; i <= Order; ++i)
+    for (size_t j = 0; j < Lanes; ++j)
+      v[i][j] += cr.v[i][j];
+  return *this;
+}
+
+template <typename RealType, size_t Order, size_t Lanes>
+fvar_lanes<RealType, Order, Lanes>& fvar_lanes<RealType, Order, Lanes>::operator+=(root_type const& ca) {
+  for (size_t j = 0; j < Lanes; ++j)
+    v.front()[j] += ca;
+  return *this;
+}
+
+template <typename RealType, size_t Order, size_t Lanes>
+fvar_lanes<RealType, Order, Lanes>& fvar_lanes<RealType, Order, Lanes>::operator-=(fvar_lanes const& cr) {
+  for (size_t i = 0; i <= Order; ++i)
+    for (size_t j = 0; j < Lanes; ++j)
+      v[i][j] -= cr.v[i][j];
+  return *this;
+}
+
+template <typename RealType, size_t Order, size_t Lanes>
+fvar_lanes<RealType, Order, Lanes>& fvar_lanes<RealType, Order, Lanes>::operator-=(root_type const& ca) {
+  for (size_t j = 0; j < Lanes; ++j)
+    v.front()[j] -= ca;
+  return *this;
+}
+
+// Coefficients are overwritten from the highest order down, since each depends only on those of equal or lower
+// order. This also holds when &cr == this.
+template <typename RealType, size_t Order, size_t Lanes>
+fvar_lanes<RealType, Order, Lanes>& fvar_lanes<RealType, Order, Lanes>::operator*=(fvar_lanes const& cr) {
+  for (size_t i = Order + 1; i-- > 0;) {
+    lane_type sum;
+    for (size_t j = 0; j < Lanes; ++j)
+      sum[j] = v[i][j] * cr.v.front()[j];
+    for (size_t k = 1; k <= i; ++k)
+      for (size_t j = 0; j < Lanes; ++j)
+        sum[j] += v[i - k][j] * cr.v[k][j];
+    v[i] = sum;
+  }
+  return *this;
+}
+
+template <typename RealType, size_t Order, size_t Lanes>
+fvar_lanes<RealType, Order, Lanes>& fvar_lanes<RealType, Order, Lanes>::operator*=(root_type const& ca) {
+  for (size_t i = 0; i <= Order; ++i)
+    for (size_t j = 0; j < Lanes; ++j)
+      v[i][j] *= ca;
+  return *this;
+}
+
+// Coefficients of the quotient are found from the lowest order up.
+template <typename RealType, size_t Order, size_t Lanes>
+fvar_lanes<RealType, Order, Lanes>& fvar_lanes<RealType, Order, Lanes>::operator/=(fvar_lanes const& cr) {
+  if (&cr == this)
+    return *this = fvar_lanes(static_cast<root_type>(1));
+  for (size_t i = 0; i <= Order; ++i) {
+    for (size_t k = 1; k <= i; ++k)
+      for (size_t j = 0; j < Lanes; ++j)
+        v[i][j] -= cr.v[k][j] * v[i - k][j];
+    for (size_t j = 0; j < Lanes; ++j)
+      v[i][j] /= cr.v.front()[j];
+  }
+  return *this;
+}
+
+template <typename RealType, size_t Order, size_t Lanes>
+fvar_lanes<RealType, Order, Lanes>& fvar_lanes<RealType, Order, Lanes>::operator/=(root_type const& ca) {
+  root_type const inv = 1 / ca;
+  return *this *= inv;
+}
+
+template <typename RealType, size_t Order, size_t Lanes>
+fvar_lanes<RealType, Order, Lanes> fvar_lanes<RealType, Order, Lanes>::operator-() const {
+  fvar_lanes r;
+  for (size_t i = 0; i <= Order; ++i)
+    for (size_t j = 0; j < Lanes; ++j)
+      r.v[i][j] = -v[i][j];
+  return r;
+}
+
+template <typename RealType, size_t Order, size_t Lanes>
+fvar_lanes<RealType, Order, Lanes> fvar_lanes<RealType, Order, Lanes>::inverse() const {
+  return fvar_lanes(static_cast<root_type>(1)) /= *this;
+}
+
+template <typename RealType, size_t Order, size_t Lanes>
+fvar_lanes<RealType, Order, Lanes> fvar_lanes<RealType, Order, Lanes>::epsilon() const {
+  fvar_lanes r = *this;
+  r.v.front().fill(static_cast<root_type>(0));
+  return r;
+}
+
+// Horner's method over the lanes: (((c[Order])*e + c[Order-1])*e + ...)*e + c[0], where e is the infinitesimal
+// part of *this. Since e has no constant term, r*e leaves the constant term of r free for the next coefficient.
+template <typename RealType, size_t Order, size_t Lanes>
+template <typename Func>
+fvar_lanes<RealType, Order, Lanes> fvar_lanes<RealType, Order, Lanes>::apply_coefficients(Func const& f) const {
+  fvar_lanes r(f(Order));
+  for (size_t n = Order; n-- > 0;) {
+    for (size_t i = Order; 0 < i; --i) {
+      lane_type sum{};
+      for (size_t k = 1; k <= i; ++k)
+        for (size_t j = 0; j < Lanes; ++j)
+          sum[j] += r.v[i - k][j] * v[k][j];
+      r.v[i] = sum;
+    }
+    r.v.front() = f(n);
+  }
+  return r;
+}
+
+template <typename RealType, size_t Order, size_t Lanes>
+template <typename Func>
+fvar_lanes<RealType, Order, Lanes> fvar_lanes<RealType, Order, Lanes>::apply_derivatives(Func const& f) const {
+  return apply_coefficients([&f](size_t i) {
+    lane_type c = f(i);
+    root_type factorial = 1;
+    for (size_t k = 2; k <= i; ++k)
+      factorial *= static_cast<root_type>(k);
+    for (size_t j = 0; j < Lanes; ++j)
+      c[j] /= factorial;
+    return c;
+  });
+}
+
+// Coefficients of the function whose derivative is d1, and whose value is d0.
+template <typename RealType, size_t Order, size_t Lanes>
+fvar_lanes<RealType, Order, Lanes> apply_antiderivative(fvar_lanes<RealType, Order, Lanes> const& cr,
+                                                        std::array<RealType, Lanes> const& d0,
+                                                        fvar_lanes<RealType, Order, Lanes> const& d1) {
+  return cr.apply_coefficients([&d0, &d1](size_t i) {
+    if (i == 0)
+      return d0;
+    std::array<RealType, Lanes> c = d1[i - 1];
+    for (size_t j = 0; j < Lanes; ++j)
+      c[j] /= static_cast<RealType>(i);
+    return c;
+  });
+}
+
+template <typename RealType, size_t Order, size_t Lanes>
+fvar_lanes<RealType, Order, Lanes> exp(fvar_lanes<RealType, Order, Lanes> const& cr) {
+  using std::exp;
+  std::array<RealType, Lanes> d0;
+  for (size_t j = 0; j < Lanes; ++j)
+    d0[j] = exp(cr[0][j]);
+  return cr.apply_derivatives([&d0](size_t) { return d0; });
+}
+
+template <typename RealType, size_t Order, size_t Lanes>
+fvar_lanes<RealType, Order, Lanes> expm1(fvar_lanes<RealType, Order, Lanes> const& cr) {
+  using std::exp;
+  using boost::math::expm1;
+  std::array<RealType, Lanes> d0, d1;
+  for (size_t j = 0; j < Lanes; ++j) {
+    d0[j] = expm1(cr[0][j]);
+    d1[j] = exp(cr[0][j]);
+  }
+  return cr.apply_derivatives([&d0, &d1](size_t i) { return i ? d1 : d0; });
+}
+
+// Natural logarithm. If a lane is 0 then its derivatives are not finite.
+template <typename RealType, size_t Order, size_t Lanes>
+fvar_lanes<RealType, Order, Lanes> log(fvar_lanes<RealType, Order, Lanes> const& cr) {
+  using std::log;
+  std::array<RealType, Lanes> d0;
+  for (size_t j = 0; j < Lanes; ++j)
+    d0[j] = log(cr[0][j]);
+  fvar_lanes<RealType, Order, Lanes> const x(cr.value(), true);
+  return apply_antiderivative(cr, d0, x.inverse());  // log'(x) = 1 / x
+}
+
+template <typename RealType, size_t Order, size_t Lanes>
+fvar_lanes<RealType, Order, Lanes> log1p(fvar_lanes<RealType, Order, Lanes> const& cr) {
+  using boost::math::log1p;
+  std::array<RealType, Lanes> d0;
+  for (size_t j = 0; j < Lanes; ++j)
+    d0[j] = log1p(cr[0][j]);
+  fvar_lanes<RealType, Order, Lanes> x(cr.value(), true);
+  return apply_antiderivative(cr, d0, (x += static_cast<RealType>(1)).inverse());  // log1p'(x) = 1 / (1+x)
+}
+
+template <typename RealType, size_t Order, size_t Lanes>
+fvar_lanes<RealType, Order, Lanes> sqrt(fvar_lanes<RealType, Order, Lanes> const& cr) {
+  using std::sqrt;
+  std::array<std::array<RealType, Lanes>, Order + 1> derivatives;
+  for (size_t j = 0; j < Lanes; ++j) {
+    RealType const x = cr[0][j];
+    derivatives[0][j] = sqrt(x);
+    RealType numerator = 0.5;
+    RealType powers = 1;
+    for (size_t i = 1; i <= Order; ++i) {
+      if (1 < i) {
+        numerator *= static_cast<RealType>(-0.5) * (static_cast<RealType>(2 * i) - 3);
+        powers *= x;
+      }
+      derivatives[i][j] = numerator / (powers * derivatives[0][j]);
+    }
+  }
+  return cr.apply_derivatives([&derivatives](size_t i) { return derivatives[i]; });
+}
+
+template <typename RealType, size_t Order, size_t Lanes>
+fvar_lanes<RealType, Order, Lanes> pow(fvar_lanes<RealType, Order, Lanes> const& x,
+                                       typename fvar_lanes<RealType, Order, Lanes>::root_type const& y) {
+  using std::pow;
+  std::array<std::array<RealType, Lanes>, Order + 1> derivatives{};
+  for (size_t j = 0; j < Lanes; ++j) {
+    RealType const x0 = x[0][j];
+    derivatives[0][j] = pow(x0, y);
+    RealType coef = 1;
+    for (size_t i = 0; i < Order && y - i != 0; ++i) {
+      coef *= y - i;
+      derivatives[i + 1][j] = coef * pow(x0, y - (i + 1));
+    }
+  }
+  return x.apply_derivatives([&derivatives](size_t i) { return derivatives[i]; });
+}
+
+template <typename RealType, size_t Order, size_t Lanes>
+fvar_lanes<RealType, Order, Lanes> pow(typename fvar_lanes<RealType, Order, Lanes>::root_type const& x,
+                                       fvar_lanes<RealType, Order, Lanes> const& y) {
+  using std::log;
+  return exp(y * log(x));
+}
+
+template <typename RealType, size_t Order, size_t Lanes>
+fvar_lanes<RealType, Order, Lanes> pow(fvar_lanes<RealType, Order, Lanes> const& x,
+                                       fvar_lanes<RealType, Order, Lanes> const& y) {
+  return exp(y * log(x));
+}
+
+template <typename RealType, size_t Order, size_t Lanes>
+fvar_lanes<RealType, Order, Lanes> sin(fvar_lanes<RealType, Order, Lanes> const& cr) {
+  using std::cos;
+  using std::sin;
+  std::array<std::array<RealType, Lanes>, 4> derivatives;
+  for (size_t j = 0; j < Lanes; ++j) {
+    derivatives[0][j] = sin(cr[0][j]);
+    derivatives[1][j] = cos(cr[0][j]);
+    derivatives[2][j] = -derivatives[0][j];
+    derivatives[3][j] = -derivatives[1][j];
+  }
+  return cr.apply_derivatives([&derivatives](size_t i) { return derivatives[i & 3]; });
+}
+
+template <typename RealType, size_t Order, size_t Lanes>
+fvar_lanes<RealType, Order, Lanes> cos(fvar_lanes<RealType, Order, Lanes> const& cr) {
+  using std::cos;
+  using std::sin;
+  std::array<std::array<RealType, Lanes>, 4> derivatives;
+  for (size_t j = 0; j < Lanes; ++j) {
+    derivatives[0][j] = cos(cr[0][j]);
+    derivatives[1][j] = -sin(cr[0][j]);
+    derivatives[2][j] = -derivatives[0][j];
+    derivatives[3][j] = -derivatives[1][j];
+  }
+  return cr.apply_derivatives([&derivatives](size_t i) { return derivatives[i & 3]; });
+}
+
+template <typename RealType, size_t Order, size_t Lanes>
+fvar_lanes<RealType, Order, Lanes> atan(fvar_lanes<RealType, Order, Lanes> const& cr) {
+  using std::atan;
+  std::array<RealType, Lanes> d0;
+  for (size_t j = 0; j < Lanes; ++j)
+    d0[j] = atan(cr[0][j]);
+  fvar_lanes<RealType, Order, Lanes> x(cr.value(), true);
+  return apply_antiderivative(cr, d0, ((x *= x) += static_cast<RealType>(1)).inverse());  // atan'(x) = 1 / (x*x+1)
+}
+
+template <typename RealType, size_t Order, size_t Lanes>
+fvar_lanes<RealType, Order, Lanes> sinh(fvar_lanes<RealType, Order, Lanes> const& cr) {
+  using std::cosh;
+  using std::sinh;
+  std::array<std::array<RealType, Lanes>, 2> derivatives;
+  for (size_t j = 0; j < Lanes; ++j) {
+    derivatives[0][j] = sinh(cr[0][j]);
+    derivatives[1][j] = cosh(cr[0][j]);
+  }
+  return cr.apply_derivatives([&derivatives](size_t i) { return derivatives[i & 1]; });
+}
+
+template <typename RealType, size_t Order, size_t Lanes>
+fvar_lanes<RealType, Order, Lanes> cosh(fvar_lanes<RealType, Order, Lanes> const& cr) {
+  using std::cosh;
+  using std::sinh;
+  std::array<std::array<RealType, Lanes>, 2> derivatives;
+  for (size_t j = 0; j < Lanes; ++j) {
+    derivatives[0][j] = cosh(cr[0][j]);
+    derivatives[1][j] = sinh(cr[0][j]);
+  }
+  return cr.apply_derivatives([&derivatives](size_t i) { return derivatives[i & 1]; });
+}
+
+// The Taylor coefficients t[i] of tanh satisfy tanh' = 1 - tanh^2, so that
+// (i+1)*t[i+1] = (i == 0) - sum(t[k]*t[i-k], k=0..i). This stays finite for all arguments.
+template <typename RealType, size_t Order, size_t Lanes>
+fvar_lanes<RealType, Order, Lanes> tanh(fvar_lanes<RealType, Order, Lanes> const& cr) {
+  using std::tanh;
+  std::array<std::array<RealType, Lanes>, Order + 1> coefficients;
+  for (size_t j = 0; j < Lanes; ++j)
+    coefficients[0][j] = tanh(cr[0][j]);
+  for (size_t i = 0; i < Order; ++i) {
+    for (size_t j = 0; j < Lanes; ++j)
+      coefficients[i + 1][j] = i ? 0 : 1;
+    for (size_t k = 0; k <= i; ++k)
+      for (size_t j = 0; j < Lanes; ++j)
+        coefficients[i + 1][j] -= coefficients[k][j] * coefficients[i - k][j];
+    for (size_t j = 0; j < Lanes; ++j)
+      coefficients[i + 1][j] /= static_cast<RealType>(i + 1);
+  }
+  return cr.apply_coefficients([&coefficients](size_t i) { return coefficients[i]; });
+}
+
+// The derivative is -1 in lanes whose value is negative, and +1 otherwise.
+template <typename RealType, size_t Order, size_t Lanes>
+fvar_lanes<RealType, Order, Lanes> fabs(fvar_lanes<RealType, Order, Lanes> const& cr) {
+  std::array<RealType, Lanes> sign;
+  for (size_t j = 0; j < Lanes; ++j)
+    sign[j] = cr[0][j] < 0 ? -1 : 1;
+  return cr * fvar_lanes<RealType, Order, Lanes>(sign);
+}
+
+template <typename RealType, size_t Order, size_t Lanes>
+fvar_lanes<RealType, Order, Lanes> erf(fvar_lanes<RealType, Order, Lanes> const& cr) {
+  using boost::math::erf;
+  std::array<RealType, Lanes> d0;
+  for (size_t j = 0; j < Lanes; ++j)
+    d0[j] = erf(cr[0][j]);
+  fvar_lanes<RealType, Order, Lanes> x(cr.value(), true);
+  // erf'(x) = 2/sqrt(pi) * exp(-x*x)
+  return apply_antiderivative(cr, d0, exp((x *= x) *= static_cast<RealType>(-1)) *= constants::two_div_root_pi<RealType>());
+}
+
+template <typename RealType, size_t Order, size_t Lanes>
+fvar_lanes<RealType, Order, Lanes> erfc(fvar_lanes<RealType, Order, Lanes> const& cr) {
+  using boost::math::erfc;
+  std::array<RealType, Lanes> d0;
+  for (size_t j = 0; j < Lanes; ++j)
+    d0[j] = erfc(cr[0][j]);
+  fvar_lanes<RealType, Order, Lanes> x(cr.value(), true);
+  // erfc'(x) = -2/sqrt(pi) * exp(-x*x)
+  return apply_antiderivative(cr, d0, exp((x *= x) *= static_cast<RealType>(-1)) *= -constants::two_div_root_pi<RealType>());
+}
+
+template <typename RealType, size_t Order, size_t Lanes>
+fvar_lanes<RealType, Order, Lanes> digamma(fvar_lanes<RealType, Order, Lanes> const& cr) {
+  using boost::math::digamma;
+  using boost::math::polygamma;
+  std::array<std::array<RealType, Lanes>, Order + 1> derivatives;
+  for (size_t j = 0; j < Lanes; ++j) {
+    derivatives[0][j] = digamma(cr[0][j]);
+    for (size_t i = 1; i <= Order; ++i)
+      derivatives[i][j] = polygamma(static_cast<int>(i), cr[0][j]);
+  }
+  return cr.apply_derivatives([&derivatives](size_t i) { return derivatives[i]; });
+}
+
+template <typename RealType, size_t Order, size_t Lanes>
+fvar_lanes<RealType, Order, Lanes> lgamma(fvar_lanes<RealType, Order, Lanes> const& cr) {
+  using boost::math::digamma;
+  using boost::math::lgamma;
+  using boost::math::polygamma;
+  std::array<std::array<RealType, Lanes>, Order + 1> derivatives;
+  for (size_t j = 0; j < Lanes; ++j) {
+    derivatives[0][j] = lgamma(cr[0][j]);
+    for (size_t i = 1; i <= Order; ++i)
+      derivatives[i][j] = i == 1 ? digamma(cr[0][j]) : polygamma(static_cast<int>(i - 1), cr[0][j]);
+  }
+  return cr.apply_derivatives([&derivatives](size_t i) { return derivatives[i]; });
+}
+
+// tgamma(x) = sign(tgamma(x)) * exp(lgamma(x)), where lgamma is the logarithm of the absolute value.
+template <typename RealType, size_t Order, size_t Lanes>
+fvar_lanes<RealType, Order, Lanes> tgamma(fvar_lanes<RealType, Order, Lanes> const& cr) {
+  using boost::math::tgamma;
+  std::array<RealType, Lanes> d0;
+  std::array<RealType, Lanes> sign;
+  for (size_t j = 0; j < Lanes; ++j) {
+    d0[j] = tgamma(cr[0][j]);
+    sign[j] = d0[j] < 0 ? -1 : 1;
+  }
+  fvar_lanes<RealType, Order, Lanes> r = exp(lgamma(cr)) * fvar_lanes<RealType, Order, Lanes>(sign);
+  r[0] = d0;
+  return r;
+}
+
+}  // namespace detail
+
+template <typename RealType, size_t Order, size_t Lanes>
+using autodiff_fvar_lanes = detail::fvar_lanes<RealType, Order, Lanes>;
+
+// Variable of differentiation with the value ca[j] in lane j.
+template <typename RealType, size_t Order, size_t Lanes>
+detail::fvar_lanes<RealType, Order, Lanes> make_fvar_lanes(std::array<RealType, Lanes> const& ca) {
+  return detail::fvar_lanes<RealType, Order, Lanes>(ca, true);
+}
+
+}  // namespace autodiff_v1
+}  // namespace differentiation
+}  // namespace math
+}  // namespace boost
+
+#endif  // BOOST_MATH_DIFFERENTIATION_AUTODIFF_LANES_HPP
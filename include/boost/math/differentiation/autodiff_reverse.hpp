@@ -0,0 +1,550 @@
+//           Copyright agent 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//      (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_DIFFERENTIATION_AUTODIFF_REVERSE_HPP
+#define BOOST_MATH_DIFFERENTIATION_AUTODIFF_REVERSE_HPP
+
+#include <boost/assert.hpp>
+#include <boost/math/constants/constants.hpp>
+#include <boost/math/distributions/complement.hpp>
+#include <boost/math/special_functions/bessel.hpp>
+#include <boost/math/special_functions/beta.hpp>
+#include <boost/math/special_functions/digamma.hpp>
+#include <boost/math/special_functions/erf.hpp>
+#include <boost/math/special_functions/expm1.hpp>
+#include <boost/math/special_functions/gamma.hpp>
+#include <boost/math/special_functions/log1p.hpp>
+#include <boost/math/tools/config.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <ostream>
+#include <vector>
+
+// Reverse mode (adjoint) automatic differentiation. Each operation on an rvar appends one statement to a tape:
+// the index of every operand that is itself recorded, and the partial derivative of the result with respect to
+// that operand. A single reverse sweep over the tape then gives the derivatives of one result with respect to
+// every variable, at a cost of a small multiple of the evaluation, however many variables there are.
+//
+// The statements live in two flat arrays owned by the tape, which keep their capacity when the tape is rewound,
+// so that repeated evaluations (of a loss function inside an optimizer, say) allocate nothing once warmed up.
+
+namespace boost {
+namespace math {
+namespace differentiation {
+// Automatic Differentiation v1
+inline namespace autodiff_v1 {
+namespace detail {
+
+template <typename RealType>
+class tape;
+
+// A value, and its position on a tape. Constants are on no tape.
+template <typename RealType>
+class rvar {
+ public:
+  using root_type = RealType;
+
+  rvar() : v(0), i(0), t(nullptr) {}
+
+  // Initialize a constant.
+  rvar(root_type const& ca) : v(ca), i(0), t(nullptr) {}
+
+  root_type const& value() const { return v; }
+
+  // Is this recorded on a tape?
+  bool is_variable() const { return t != nullptr; }
+
+  tape<RealType>* get_tape() const { return t; }
+  std::size_t index() const { return i; }
+
+  rvar& operator+=(rvar const& cr) { return *this = *this + cr; }
+  rvar& operator-=(rvar const& cr) { return *this = *this - cr; }
+  rvar& operator*=(rvar const& cr) { return *this = *this * cr; }
+  rvar& operator/=(rvar const& cr) { return *this = *this / cr; }
+
+  explicit operator root_type() const { return v; }
+
+ private:
+  friend class tape<RealType>;
+
+  rvar(root_type const& ca, std::size_t index, tape<RealType>* pt) : v(ca), i(index), t(pt) {}
+
+  root_type v;
+  std::size_t i;
+  tape<RealType>* t;
+};
+
+template <typename RealType>
+class tape {
+ public:
+  // One partial derivative of a statement: d(statement)/d(operand) = partial.
+  struct operand {
+    std::size_t index;
+    RealType partial;
+  };
+
+  tape() : m_begin(1, 0) {}
+  tape(tape const&) = delete;
+  tape& operator=(tape const&) = delete;
+
+  // Reserve room for the given number of statements and operands.
+  void reserve(std::size_t statements, std::size_t operands) {
+    m_begin.reserve(statements + 1);
+    m_operands.reserve(operands);
+  }
+
+  // New independent variable.
+  rvar<RealType> variable(RealType const& ca) { return record(ca, nullptr, nullptr); }
+
+  // Number of statements recorded so far.
+  std::size_t position() const { return m_begin.size() - 1; }
+
+  // Discard every statement after position p. Any rvar recorded after p is invalidated.
+  void rewind(std::size_t p) {
+    BOOST_ASSERT(p <= position());
+    m_begin.resize(p + 1);
+    m_operands.resize(m_begin.back());
+    if (m_adjoints.size() > p)
+      m_adjoints.resize(p);
+  }
+
+  void clear() { rewind(0); }
+
+  // Records a statement with value ca, whose partial derivatives are given by [first, last).
+  rvar<RealType> record(RealType const& ca, operand const* first, operand const* last) {
+    m_operands.insert(m_operands.end(), first, last);
+    m_begin.push_back(m_operands.size());
+    return rvar<RealType>(ca, position() - 1, this);
+  }
+
+  // Sets the adjoint of y to 1, and propagates it to every statement recorded before y.
+  // The adjoints of the previous call are discarded first, since summing over a second sweep
+  // would count the adjoints of intermediate statements twice.
+  void propagate(rvar<RealType> const& y) {
+    BOOST_ASSERT(y.get_tape() == this);
+    zero_adjoints();
+    if (m_adjoints.size() < position())
+      m_adjoints.resize(position(), RealType(0));
+    m_adjoints[y.index()] = 1;
+    for (std::size_t k = y.index() + 1; k-- > 0;) {
+      RealType const a = m_adjoints[k];
+      if (a == 0)
+        continue;
+      for (std::size_t j = m_begin[k]; j < m_begin[k + 1]; ++j)
+        m_adjoints[m_operands[j].index] += a * m_operands[j].partial;
+    }
+  }
+
+  void zero_adjoints() { m_adjoints.assign(m_adjoints.size(), RealType(0)); }
+
+  // Derivative of the propagated result with respect to x; 0 when x is a constant.
+  RealType adjoint(rvar<RealType> const& x) const {
+    if (x.get_tape() != this || x.index() >= m_adjoints.size())
+      return RealType(0);
+    return m_adjoints[x.index()];
+  }
+
+  // Derivatives of y with respect to each of [first, last), written to out.
+  template <typename InputIterator, typename OutputIterator>
+  OutputIterator gradient(rvar<RealType> const& y, InputIterator first, InputIterator last, OutputIterator out) {
+    if (y.get_tape() == this)
+      propagate(y);
+    else
+      zero_adjoints();
+    for (; first != last; ++first)
+      *out++ = adjoint(*first);
+    return out;
+  }
+
+ private:
+  // Operands of statement k are m_operands[m_begin[k]] to m_operands[m_begin[k+1]-1].
+  std::vector<std::size_t> m_begin;
+  std::vector<operand> m_operands;
+  std::vector<RealType> m_adjoints;
+};
+
+// Result of a function of one argument, with derivative da.
+template <typename RealType>
+rvar<RealType> record_unary(typename rvar<RealType>::root_type const& value,
+                            rvar<RealType> const& a,
+                            typename rvar<RealType>::root_type const& da) {
+  if (!a.is_variable())
+    return rvar<RealType>(value);
+  typename tape<RealType>::operand const op{a.index(), da};
+  return a.get_tape()->record(value, &op, &op + 1);
+}
+
+// Result of a function of two arguments, with partial derivatives da and db.
+template <typename RealType>
+rvar<RealType> record_binary(typename rvar<RealType>::root_type const& value,
+                             rvar<RealType> const& a,
+                             typename rvar<RealType>::root_type const& da,
+                             rvar<RealType> const& b,
+                             typename rvar<RealType>::root_type const& db) {
+  if (!b.is_variable())
+    return record_unary(value, a, da);
+  if (!a.is_variable())
+    return record_unary(value, b, db);
+  BOOST_ASSERT(a.get_tape() == b.get_tape());
+  typename tape<RealType>::operand const ops[2]{{a.index(), da}, {b.index(), db}};
+  return a.get_tape()->record(value, ops, ops + 2);
+}
+
+template <typename RealType>
+rvar<RealType> operator+(rvar<RealType> const& a, rvar<RealType> const& b) {
+  return record_binary(a.value() + b.value(), a, RealType(1), b, RealType(1));
+}
+
+template <typename RealType>
+rvar<RealType> operator+(rvar<RealType> const& a, typename rvar<RealType>::root_type const& b) {
+  return record_unary(a.value() + b, a, RealType(1));
+}
+
+template <typename RealType>
+rvar<RealType> operator+(typename rvar<RealType>::root_type const& a, rvar<RealType> const& b) {
+  return record_unary(a + b.value(), b, RealType(1));
+}
+
+template <typename RealType>
+rvar<RealType> operator-(rvar<RealType> const& a, rvar<RealType> const& b) {
+  return record_binary(a.value() - b.value(), a, RealType(1), b, RealType(-1));
+}
+
+template <typename RealType>
+rvar<RealType> operator-(rvar<RealType> const& a, typename rvar<RealType>::root_type const& b) {
+  return record_unary(a.value() - b, a, RealType(1));
+}
+
+template <typename RealType>
+rvar<RealType> operator-(typename rvar<RealType>::root_type const& a, rvar<RealType> const& b) {
+  return record_unary(a - b.value(), b, RealType(-1));
+}
+
+template <typename RealType>
+rvar<RealType> operator-(rvar<RealType> const& a) {
+  return record_unary(-a.value(), a, RealType(-1));
+}
+
+template <typename RealType>
+rvar<RealType> const& operator+(rvar<RealType> const& a) {
+  return a;
+}
+
+template <typename RealType>
+rvar<RealType> operator*(rvar<RealType> const& a, rvar<RealType> const& b) {
+  return record_binary(a.value() * b.value(), a, b.value(), b, a.value());
+}
+
+template <typename RealType>
+rvar<RealType> operator*(rvar<RealType> const& a, typename rvar<RealType>::root_type const& b) {
+  return record_unary(a.value() * b, a, b);
+}
+
+template <typename RealType>
+rvar<RealType> operator*(typename rvar<RealType>::root_type const& a, rvar<RealType> const& b) {
+  return record_unary(a * b.value(), b, a);
+}
+
+template <typename RealType>
+rvar<RealType> operator/(rvar<RealType> const& a, rvar<RealType> const& b) {
+  RealType const q = a.value() / b.value();
+  return record_binary(q, a, RealType(1) / b.value(), b, -q / b.value());
+}
+
+template <typename RealType>
+rvar<RealType> operator/(rvar<RealType> const& a, typename rvar<RealType>::root_type const& b) {
+  return record_unary(a.value() / b, a, RealType(1) / b);
+}
+
+template <typename RealType>
+rvar<RealType> operator/(typename rvar<RealType>::root_type const& a, rvar<RealType> const& b) {
+  RealType const q = a / b.value();
+  return record_unary(q, b, -q / b.value());
+}
+
+// Comparisons are of the values only, so that piecewise functions take the branch of the point of evaluation.
+#define BOOST_MATH_AUTODIFF_REVERSE_COMPARISON(op)                                                              \
+  template <typename RealType>                                                                                  \
+  bool operator op(rvar<RealType> const& a, rvar<RealType> const& b) {                                          \
+    return a.value() op b.value();                                                                              \
+  }                                                                                                             \
+  template <typename RealType>                                                                                  \
+  bool operator op(rvar<RealType> const& a, typename rvar<RealType>::root_type const& b) {                      \
+    return a.value() op b;                                                                                      \
+  }                                                                                                             \
+  template <typename RealType>                                                                                  \
+  bool operator op(typename rvar<RealType>::root_type const& a, rvar<RealType> const& b) {                      \
+    return a op b.value();                                                                                      \
+  }
+
+BOOST_MATH_AUTODIFF_REVERSE_COMPARISON(==)
+BOOST_MATH_AUTODIFF_REVERSE_COMPARISON(!=)
+BOOST_MATH_AUTODIFF_REVERSE_COMPARISON(<)
+BOOST_MATH_AUTODIFF_REVERSE_COMPARISON(<=)
+BOOST_MATH_AUTODIFF_REVERSE_COMPARISON(>)
+BOOST_MATH_AUTODIFF_REVERSE_COMPARISON(>=)
+
+#undef BOOST_MATH_AUTODIFF_REVERSE_COMPARISON
+
+template <typename RealType>
+std::ostream& operator<<(std::ostream& out, rvar<RealType> const& cr) {
+  return out << cr.value();
+}
+
+// Standard math functions are overloaded and called via argument-dependent lookup (ADL).
+
+template <typename RealType>
+rvar<RealType> exp(rvar<RealType> const& x) {
+  using std::exp;
+  RealType const d0 = exp(x.value());
+  return record_unary(d0, x, d0);
+}
+
+template <typename RealType>
+rvar<RealType> expm1(rvar<RealType> const& x) {
+  using std::exp;
+  return record_unary(boost::math::expm1(x.value()), x, RealType(exp(x.value())));
+}
+
+template <typename RealType>
+rvar<RealType> log(rvar<RealType> const& x) {
+  using std::log;
+  return record_unary(RealType(log(x.value())), x, RealType(1) / x.value());
+}
+
+template <typename RealType>
+rvar<RealType> log1p(rvar<RealType> const& x) {
+  return record_unary(boost::math::log1p(x.value()), x, RealType(1) / (1 + x.value()));
+}
+
+template <typename RealType>
+rvar<RealType> sqrt(rvar<RealType> const& x) {
+  using std::sqrt;
+  RealType const d0 = sqrt(x.value());
+  return record_unary(d0, x, RealType(0.5) / d0);
+}
+
+template <typename RealType>
+rvar<RealType> pow(rvar<RealType> const& x, typename rvar<RealType>::root_type const& y) {
+  using std::pow;
+  return record_unary(RealType(pow(x.value(), y)), x, RealType(y == 0 ? 0 : y * pow(x.value(), y - 1)));
+}
+
+template <typename RealType>
+rvar<RealType> pow(typename rvar<RealType>::root_type const& x, rvar<RealType> const& y) {
+  using std::log;
+  using std::pow;
+  RealType const d0 = pow(x, y.value());
+  return record_unary(d0, y, RealType(d0 == 0 ? 0 : d0 * log(x)));
+}
+
+template <typename RealType>
+rvar<RealType> pow(rvar<RealType> const& x, rvar<RealType> const& y) {
+  using std::log;
+  using std::pow;
+  RealType const d0 = pow(x.value(), y.value());
+  RealType const dx = y.value() == 0 ? RealType(0) : RealType(y.value() * pow(x.value(), y.value() - 1));
+  RealType const dy = d0 == 0 ? RealType(0) : RealType(d0 * log(x.value()));
+  return record_binary(d0, x, dx, y, dy);
+}
+
+template <typename RealType>
+rvar<RealType> fabs(rvar<RealType> const& x) {
+  using std::fabs;
+  return record_unary(RealType(fabs(x.value())), x, RealType(x.value() < 0 ? -1 : 1));
+}
+
+template <typename RealType>
+rvar<RealType> abs(rvar<RealType> const& x) {
+  return fabs(x);
+}
+
+template <typename RealType>
+rvar<RealType> sin(rvar<RealType> const& x) {
+  using std::cos;
+  using std::sin;
+  return record_unary(RealType(sin(x.value())), x, RealType(cos(x.value())));
+}
+
+template <typename RealType>
+rvar<RealType> cos(rvar<RealType> const& x) {
+  using std::cos;
+  using std::sin;
+  return record_unary(RealType(cos(x.value())), x, RealType(-sin(x.value())));
+}
+
+template <typename RealType>
+rvar<RealType> tan(rvar<RealType> const& x) {
+  using std::tan;
+  RealType const d0 = tan(x.value());
+  return record_unary(d0, x, 1 + d0 * d0);
+}
+
+template <typename RealType>
+rvar<RealType> atan(rvar<RealType> const& x) {
+  using std::atan;
+  return record_unary(RealType(atan(x.value())), x, 1 / (1 + x.value() * x.value()));
+}
+
+template <typename RealType>
+rvar<RealType> sinh(rvar<RealType> const& x) {
+  using std::cosh;
+  using std::sinh;
+  return record_unary(RealType(sinh(x.value())), x, RealType(cosh(x.value())));
+}
+
+template <typename RealType>
+rvar<RealType> cosh(rvar<RealType> const& x) {
+  using std::cosh;
+  using std::sinh;
+  return record_unary(RealType(cosh(x.value())), x, RealType(sinh(x.value())));
+}
+
+template <typename RealType>
+rvar<RealType> tanh(rvar<RealType> const& x) {
+  using std::tanh;
+  RealType const d0 = tanh(x.value());
+  return record_unary(d0, x, 1 - d0 * d0);
+}
+
+template <typename RealType>
+rvar<RealType> erf(rvar<RealType> const& x) {
+  using std::exp;
+  RealType const d1 = constants::two_div_root_pi<RealType>() * exp(-x.value() * x.value());
+  return record_unary(boost::math::erf(x.value()), x, d1);
+}
+
+template <typename RealType>
+rvar<RealType> erfc(rvar<RealType> const& x) {
+  using std::exp;
+  RealType const d1 = -constants::two_div_root_pi<RealType>() * exp(-x.value() * x.value());
+  return record_unary(boost::math::erfc(x.value()), x, d1);
+}
+
+template <typename RealType>
+rvar<RealType> tgamma(rvar<RealType> const& x) {
+  RealType const d0 = boost::math::tgamma(x.value());
+  return record_unary(d0, x, RealType(d0 * boost::math::digamma(x.value())));
+}
+
+template <typename RealType>
+rvar<RealType> lgamma(rvar<RealType> const& x) {
+  return record_unary(boost::math::lgamma(x.value()), x, boost::math::digamma(x.value()));
+}
+
+template <typename RealType>
+rvar<RealType> digamma(rvar<RealType> const& x) {
+  return record_unary(boost::math::digamma(x.value()), x, boost::math::trigamma(x.value()));
+}
+
+// The incomplete gamma and beta functions are differentiated with respect to x only: the parameters are constants.
+template <typename RealType>
+rvar<RealType> gamma_p(typename rvar<RealType>::root_type const& a, rvar<RealType> const& x) {
+  return record_unary(boost::math::gamma_p(a, x.value()), x, boost::math::gamma_p_derivative(a, x.value()));
+}
+
+template <typename RealType>
+rvar<RealType> gamma_q(typename rvar<RealType>::root_type const& a, rvar<RealType> const& x) {
+  return record_unary(boost::math::gamma_q(a, x.value()), x, RealType(-boost::math::gamma_p_derivative(a, x.value())));
+}
+
+template <typename RealType>
+rvar<RealType> ibeta(typename rvar<RealType>::root_type const& a,
+                     typename rvar<RealType>::root_type const& b,
+                     rvar<RealType> const& x) {
+  return record_unary(boost::math::ibeta(a, b, x.value()), x, boost::math::ibeta_derivative(a, b, x.value()));
+}
+
+template <typename RealType>
+rvar<RealType> ibetac(typename rvar<RealType>::root_type const& a,
+                      typename rvar<RealType>::root_type const& b,
+                      rvar<RealType> const& x) {
+  return record_unary(boost::math::ibetac(a, b, x.value()), x, RealType(-boost::math::ibeta_derivative(a, b, x.value())));
+}
+
+// Bessel functions are differentiated with respect to x, from the recurrences for their derivatives.
+template <typename RealType>
+rvar<RealType> cyl_bessel_j(typename rvar<RealType>::root_type const& v, rvar<RealType> const& x) {
+  RealType const d1 = (boost::math::cyl_bessel_j(v - 1, x.value()) - boost::math::cyl_bessel_j(v + 1, x.value())) / 2;
+  return record_unary(boost::math::cyl_bessel_j(v, x.value()), x, d1);
+}
+
+template <typename RealType>
+rvar<RealType> cyl_neumann(typename rvar<RealType>::root_type const& v, rvar<RealType> const& x) {
+  RealType const d1 = (boost::math::cyl_neumann(v - 1, x.value()) - boost::math::cyl_neumann(v + 1, x.value())) / 2;
+  return record_unary(boost::math::cyl_neumann(v, x.value()), x, d1);
+}
+
+template <typename RealType>
+rvar<RealType> cyl_bessel_i(typename rvar<RealType>::root_type const& v, rvar<RealType> const& x) {
+  RealType const d1 = (boost::math::cyl_bessel_i(v - 1, x.value()) + boost::math::cyl_bessel_i(v + 1, x.value())) / 2;
+  return record_unary(boost::math::cyl_bessel_i(v, x.value()), x, d1);
+}
+
+template <typename RealType>
+rvar<RealType> cyl_bessel_k(typename rvar<RealType>::root_type const& v, rvar<RealType> const& x) {
+  RealType const d1 = -(boost::math::cyl_bessel_k(v - 1, x.value()) + boost::math::cyl_bessel_k(v + 1, x.value())) / 2;
+  return record_unary(boost::math::cyl_bessel_k(v, x.value()), x, d1);
+}
+
+// The cdf of any distribution of the library, differentiated with respect to x: its derivative is the pdf.
+// The cdf and pdf of the distribution itself are found by argument-dependent lookup.
+template <typename Distribution, typename RealType>
+rvar<RealType> cdf(Distribution const& dist, rvar<RealType> const& x) {
+  return record_unary(RealType(cdf(dist, x.value())), x, RealType(pdf(dist, x.value())));
+}
+
+template <typename Distribution, typename RealType>
+rvar<RealType> cdf(complemented2_type<Distribution, rvar<RealType>> const& c) {
+  return record_unary(RealType(cdf(complement(c.dist, c.param.value()))), c.param,
+                      RealType(-pdf(c.dist, c.param.value())));
+}
+
+}  // namespace detail
+
+template <typename RealType>
+using autodiff_tape = detail::tape<RealType>;
+
+template <typename RealType>
+using autodiff_rvar = detail::rvar<RealType>;
+
+// Checkpoint: evaluates f on a private tape, and records on the tape of x only the gradient of the result with
+// respect to x, as a single statement. The intermediate statements of f are never stored on the tape of x, so that
+// a long computation with few inputs costs the tape one statement rather than one per operation.
+template <typename RealType, typename Func>
+detail::rvar<RealType> checkpoint(Func const& f, std::vector<detail::rvar<RealType>> const& x) {
+  detail::tape<RealType>* t = nullptr;
+  detail::tape<RealType> local;
+  std::vector<detail::rvar<RealType>> local_x;
+  local_x.reserve(x.size());
+  for (auto const& xi : x) {
+    local_x.push_back(local.variable(xi.value()));
+    if (xi.is_variable()) {
+      BOOST_ASSERT(t == nullptr || t == xi.get_tape());
+      t = xi.get_tape();
+    }
+  }
+  detail::rvar<RealType> const y = f(local_x);
+  if (t == nullptr)
+    return detail::rvar<RealType>(y.value());
+  std::vector<typename detail::tape<RealType>::operand> ops;
+  ops.reserve(x.size());
+  if (y.get_tape() == &local) {
+    local.propagate(y);
+    for (std::size_t k = 0; k < x.size(); ++k)
+      if (x[k].is_variable())
+        ops.push_back({x[k].index(), local.adjoint(local_x[k])});
+  }
+  return t->record(y.value(), ops.data(), ops.data() + ops.size());
+}
+
+}  // namespace autodiff_v1
+}  // namespace differentiation
+}  // namespace math
+}  // namespace boost
+
+#endif  // BOOST_MATH_DIFFERENTIATION_AUTODIFF_REVERSE_HPP
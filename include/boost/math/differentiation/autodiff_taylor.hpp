@@ -0,0 +1,474 @@
+//           Copyright agent 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//      (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_DIFFERENTIATION_AUTODIFF_TAYLOR_HPP
+#define BOOST_MATH_DIFFERENTIATION_AUTODIFF_TAYLOR_HPP
+
+#include <boost/assert.hpp>
+#include <boost/math/differentiation/autodiff.hpp>
+#include <boost/math/special_functions/erf.hpp>
+#include <boost/math/special_functions/gamma.hpp>
+
+#include <array>
+#include <cstddef>
+#include <map>
+#include <ostream>
+
+// taylor<RealType, Variables, Degree> is a truncated Taylor polynomial in Variables variables, holding every
+// coefficient of total degree at most Degree, and no others. The nested fvar<fvar<...>> of make_ftuple holds
+// the full tensor product of orders instead: for 4 variables of order 2 that is 3^4 = 81 coefficients, of which a
+// Hessian needs only the 15 of total degree 2 or less.
+//
+// The coefficients are stored in graded lexicographic order: the constant, then the variables, then the terms of
+// degree 2, and so on. Which products of coefficients contribute to each coefficient of a product depends only on
+// Variables and Degree, so it is tabulated once per type, and a multiplication is a single pass over that table.
+
+namespace boost {
+namespace math {
+namespace differentiation {
+// Automatic Differentiation v1
+inline namespace autodiff_v1 {
+namespace detail {
+
+// Number of monomials in vars variables of total degree at most degree: binomial(vars + degree, degree).
+constexpr size_t taylor_size(size_t vars, size_t degree) {
+  return degree == 0 ? 1 : taylor_size(vars, degree - 1) * (vars + degree) / degree;
+}
+
+// The monomials of each degree in graded lexicographic order, and for each coefficient k of a product the pairs
+// (left[p], right[p]) of coefficients whose monomials multiply to monomial k, for p in [begin[k], begin[k+1]).
+template <size_t Vars, size_t Degree>
+struct taylor_tables {
+  static constexpr size_t size = taylor_size(Vars, Degree);
+  // A pair of monomials whose product has degree at most Degree is a monomial in 2*Vars variables.
+  static constexpr size_t pairs = taylor_size(2 * Vars, Degree);
+
+  std::array<std::array<size_t, Vars>, size> exponents;
+  std::array<size_t, size + 1> begin;
+  std::array<size_t, pairs> left;
+  std::array<size_t, pairs> right;
+
+  static taylor_tables const& get() {
+    static taylor_tables const tables;
+    return tables;
+  }
+
+  // Index of the monomial with the given exponents, or size if its degree exceeds Degree.
+  size_t index(std::array<size_t, Vars> const& e) const {
+    for (size_t k = 0; k < size; ++k)
+      if (exponents[k] == e)
+        return k;
+    return size;
+  }
+
+ private:
+  taylor_tables() {
+    size_t n = 0;
+    std::array<size_t, Vars> e{};
+    for (size_t d = 0; d <= Degree; ++d)
+      enumerate(e, 0, d, n);
+    std::map<std::array<size_t, Vars>, size_t> lookup;
+    for (size_t k = 0; k < size; ++k)
+      lookup[exponents[k]] = k;
+    size_t p = 0;
+    for (size_t k = 0; k < size; ++k) {
+      begin[k] = p;
+      for (size_t i = 0; i < size; ++i) {
+        bool divides = true;
+        for (size_t j = 0; j < Vars; ++j) {
+          divides = divides && exponents[i][j] <= exponents[k][j];
+          e[j] = exponents[k][j] - (divides ? exponents[i][j] : 0);
+        }
+        if (divides) {
+          left[p] = i;
+          right[p++] = lookup[e];
+        }
+      }
+    }
+    begin[size] = p;
+  }
+
+  // All exponents e[j..] summing to d, with e[j] descending first.
+  void enumerate(std::array<size_t, Vars>& e, size_t j, size_t d, size_t& n) {
+    if (j + 1 == Vars) {
+      e[j] = d;
+      exponents[n++] = e;
+      return;
+    }
+    for (size_t m = d + 1; m-- > 0;) {
+      e[j] = m;
+      enumerate(e, j + 1, d - m, n);
+    }
+    e[j] = 0;
+  }
+};
+
+template <typename RealType, size_t Vars, size_t Degree>
+class taylor {
+ public:
+  using root_type = RealType;
+  static constexpr size_t variables = Vars;
+  static constexpr size_t degree = Degree;
+  static constexpr size_t size = taylor_size(Vars, Degree);
+  using tables = taylor_tables<Vars, Degree>;
+
+  taylor() : v{} {}
+
+  // Initialize a constant.
+  taylor(root_type const& ca) : v{} { v.front() = ca; }
+
+  // Initialize variable number i (counting from 0, and less than Vars) with value ca.
+  taylor(root_type const& ca, size_t i);
+
+  // Coefficient i in graded lexicographic order: derivative/(product of factorials of the orders).
+  root_type const& operator[](size_t i) const { return v[i]; }
+  root_type& operator[](size_t i) { return v[i]; }
+
+  // Mixed partial derivative with the given order for each variable, in order; omitted orders are 0.
+  // Derivatives of total order above Degree are not held, and are returned as 0.
+  template <typename... Orders>
+  root_type derivative(Orders... orders) const;
+
+  root_type derivative(std::array<size_t, Vars> const& orders) const;
+
+  explicit operator root_type() const { return v.front(); }
+
+  taylor& operator+=(taylor const&);
+  taylor& operator+=(root_type const&);
+  taylor& operator-=(taylor const&);
+  taylor& operator-=(root_type const&);
+  taylor& operator*=(taylor const&);
+  taylor& operator*=(root_type const&);
+  taylor& operator/=(taylor const&);
+  taylor& operator/=(root_type const&);
+
+  taylor operator-() const;
+  taylor const& operator+() const { return *this; }
+
+  // Multiplicative inverse 1/(*this).
+  taylor inverse() const;
+
+  // f : order -> derivative(order)/factorial(order) of a function of one variable at the value of *this.
+  // Returns that function composed with *this.
+  template <typename Func>
+  taylor apply_coefficients(Func const& f) const;
+
+ private:
+  std::array<RealType, size> v;
+};
+
+template <typename RealType, size_t Vars, size_t Degree>
+taylor<RealType, Vars, Degree>::taylor(root_type const& ca, size_t i) : v{} {
+  BOOST_ASSERT(i < Vars);
+  v.front() = ca;
+  BOOST_IF_CONSTEXPR (0 < Degree)
+    v[i + 1] = 1;
+}
+
+template <typename RealType, size_t Vars, size_t Degree>
+template <typename... Orders>
+typename taylor<RealType, Vars, Degree>::root_type taylor<RealType, Vars, Degree>::derivative(
+    Orders... orders) const {
+  static_assert(sizeof...(Orders) <= Vars, "Number of orders must not exceed number of variables.");
+  std::array<size_t, Vars> o{{static_cast<size_t>(orders)...}};
+  return derivative(o);
+}
+
+template <typename RealType, size_t Vars, size_t Degree>
+typename taylor<RealType, Vars, Degree>::root_type taylor<RealType, Vars, Degree>::derivative(
+    std::array<size_t, Vars> const& orders) const {
+  size_t const k = tables::get().index(orders);
+  if (k == size)
+    return 0;
+  root_type r = v[k];
+  for (size_t order : orders)
+    for (size_t i = 2; i <= order; ++i)
+      r *= static_cast<root_type>(i);
+  return r;
+}
+
+template <typename RealType, size_t Vars, size_t Degree>
+taylor<RealType, Vars, Degree>& taylor<RealType, Vars, Degree>::operator+=(taylor const& cr) {
+  for (size_t i = 0; i < size; ++i)
+    v[i] += cr.v[i];
+  return *this;
+}
+
+template <typename RealType, size_t Vars, size_t Degree>
+taylor<RealType, Vars, Degree>& taylor<RealType, Vars, Degree>::operator+=(root_type const& ca) {
+  v.front() += ca;
+  return *this;
+}
+
+template <typename RealType, size_t Vars, size_t Degree>
+taylor<RealType, Vars, Degree>& taylor<RealType, Vars, Degree>::operator-=(taylor const& cr) {
+  for (size_t i = 0; i < size; ++i)
+    v[i] -= cr.v[i];
+  return *this;
+}
+
+template <typename RealType, size_t Vars, size_t Degree>
+taylor<RealType, Vars, Degree>& taylor<RealType, Vars, Degree>::operator-=(root_type const& ca) {
+  v.front() -= ca;
+  return *this;
+}
+
+template <typename RealType, size_t Vars, size_t Degree>
+taylor<RealType, Vars, Degree>& taylor<RealType, Vars, Degree>::operator*=(taylor const& cr) {
+  tables const& t = tables::get();
+  std::array<RealType, size> r;
+  for (size_t k = 0; k < size; ++k) {
+    RealType sum = 0;
+    for (size_t p = t.begin[k]; p < t.begin[k + 1]; ++p)
+      sum += v[t.left[p]] * cr.v[t.right[p]];
+    r[k] = sum;
+  }
+  v = r;
+  return *this;
+}
+
+template <typename RealType, size_t Vars, size_t Degree>
+taylor<RealType, Vars, Degree>& taylor<RealType, Vars, Degree>::operator*=(root_type const& ca) {
+  for (size_t i = 0; i < size; ++i)
+    v[i] *= ca;
+  return *this;
+}
+
+// Coefficients of the quotient q = *this / cr are found in graded order, from
+// q[k]*cr[0] = v[k] - sum(q[i]*cr[j]) over the pairs (i,j) of coefficient k with j != 0, for which i precedes k.
+template <typename RealType, size_t Vars, size_t Degree>
+taylor<RealType, Vars, Degree>& taylor<RealType, Vars, Degree>::operator/=(taylor const& cr) {
+  if (&cr == this)
+    return *this = taylor(static_cast<root_type>(1));
+  tables const& t = tables::get();
+  for (size_t k = 0; k < size; ++k) {
+    for (size_t p = t.begin[k]; p < t.begin[k + 1]; ++p)
+      if (t.right[p] != 0)
+        v[k] -= v[t.left[p]] * cr.v[t.right[p]];
+    v[k] /= cr.v.front();
+  }
+  return *this;
+}
+
+template <typename RealType, size_t Vars, size_t Degree>
+taylor<RealType, Vars, Degree>& taylor<RealType, Vars, Degree>::operator/=(root_type const& ca) {
+  for (size_t i = 0; i < size; ++i)
+    v[i] /= ca;
+  return *this;
+}
+
+template <typename RealType, size_t Vars, size_t Degree>
+taylor<RealType, Vars, Degree> taylor<RealType, Vars, Degree>::operator-() const {
+  taylor r;
+  for (size_t i = 0; i < size; ++i)
+    r.v[i] = -v[i];
+  return r;
+}
+
+template <typename RealType, size_t Vars, size_t Degree>
+taylor<RealType, Vars, Degree> taylor<RealType, Vars, Degree>::inverse() const {
+  return taylor(static_cast<root_type>(1)) /= *this;
+}
+
+// Horner's method in e = *this - (*this)[0], which has no constant term: (((c[Degree])*e + c[Degree-1])*e ...)*e + c[0].
+template <typename RealType, size_t Vars, size_t Degree>
+template <typename Func>
+taylor<RealType, Vars, Degree> taylor<RealType, Vars, Degree>::apply_coefficients(Func const& f) const {
+  taylor e = *this;
+  e.v.front() = 0;
+  taylor r(static_cast<root_type>(f(Degree)));
+  for (size_t i = Degree; i-- > 0;)
+    (r *= e).v.front() = static_cast<root_type>(f(i));
+  return r;
+}
+
+// Applies a function of one variable, given by its overload for fvar, which supplies its Taylor coefficients.
+template <typename RealType, size_t Vars, size_t Degree, typename Func>
+taylor<RealType, Vars, Degree> apply_function(taylor<RealType, Vars, Degree> const& cr, Func const& f) {
+  auto const u = f(make_fvar<RealType, Degree>(cr[0]));
+  std::array<RealType, Degree + 1> coefficients;
+  RealType factorial = 1;
+  for (size_t i = 0; i <= Degree; ++i) {
+    if (1 < i)
+      factorial *= static_cast<RealType>(i);
+    coefficients[i] = static_cast<RealType>(u.derivative(i)) / factorial;
+  }
+  return cr.apply_coefficients([&coefficients](size_t i) { return coefficients[i]; });
+}
+
+template <typename RealType, size_t Vars, size_t Degree>
+taylor<RealType, Vars, Degree> operator+(taylor<RealType, Vars, Degree> cr1,
+                                         taylor<RealType, Vars, Degree> const& cr2) {
+  return cr1 += cr2;
+}
+
+template <typename RealType, size_t Vars, size_t Degree>
+taylor<RealType, Vars, Degree> operator+(taylor<RealType, Vars, Degree> cr,
+                                         typename taylor<RealType, Vars, Degree>::root_type const& ca) {
+  return cr += ca;
+}
+
+template <typename RealType, size_t Vars, size_t Degree>
+taylor<RealType, Vars, Degree> operator+(typename taylor<RealType, Vars, Degree>::root_type const& ca,
+                                         taylor<RealType, Vars, Degree> cr) {
+  return cr += ca;
+}
+
+template <typename RealType, size_t Vars, size_t Degree>
+taylor<RealType, Vars, Degree> operator-(taylor<RealType, Vars, Degree> cr1,
+                                         taylor<RealType, Vars, Degree> const& cr2) {
+  return cr1 -= cr2;
+}
+
+template <typename RealType, size_t Vars, size_t Degree>
+taylor<RealType, Vars, Degree> operator-(taylor<RealType, Vars, Degree> cr,
+                                         typename taylor<RealType, Vars, Degree>::root_type const& ca) {
+  return cr -= ca;
+}
+
+template <typename RealType, size_t Vars, size_t Degree>
+taylor<RealType, Vars, Degree> operator-(typename taylor<RealType, Vars, Degree>::root_type const& ca,
+                                         taylor<RealType, Vars, Degree> const& cr) {
+  return -cr += ca;
+}
+
+template <typename RealType, size_t Vars, size_t Degree>
+taylor<RealType, Vars, Degree> operator*(taylor<RealType, Vars, Degree> cr1,
+                                         taylor<RealType, Vars, Degree> const& cr2) {
+  return cr1 *= cr2;
+}
+
+template <typename RealType, size_t Vars, size_t Degree>
+taylor<RealType, Vars, Degree> operator*(taylor<RealType, Vars, Degree> cr,
+                                         typename taylor<RealType, Vars, Degree>::root_type const& ca) {
+  return cr *= ca;
+}
+
+template <typename RealType, size_t Vars, size_t Degree>
+taylor<RealType, Vars, Degree> operator*(typename taylor<RealType, Vars, Degree>::root_type const& ca,
+                                         taylor<RealType, Vars, Degree> cr) {
+  return cr *= ca;
+}
+
+template <typename RealType, size_t Vars, size_t Degree>
+taylor<RealType, Vars, Degree> operator/(taylor<RealType, Vars, Degree> cr1,
+                                         taylor<RealType, Vars, Degree> const& cr2) {
+  return cr1 /= cr2;
+}
+
+template <typename RealType, size_t Vars, size_t Degree>
+taylor<RealType, Vars, Degree> operator/(taylor<RealType, Vars, Degree> cr,
+                                         typename taylor<RealType, Vars, Degree>::root_type const& ca) {
+  return cr /= ca;
+}
+
+template <typename RealType, size_t Vars, size_t Degree>
+taylor<RealType, Vars, Degree> operator/(typename taylor<RealType, Vars, Degree>::root_type const& ca,
+                                         taylor<RealType, Vars, Degree> const& cr) {
+  return cr.inverse() *= ca;
+}
+
+// Comparisons are of the constant terms, as for fvar.
+#define BOOST_MATH_AUTODIFF_TAYLOR_COMPARISON(op)                                                               \
+  template <typename RealType, size_t Vars, size_t Degree>                                                      \
+  bool operator op(taylor<RealType, Vars, Degree> const& a, taylor<RealType, Vars, Degree> const& b) {          \
+    return a[0] op b[0];                                                                                        \
+  }                                                                                                             \
+  template <typename RealType, size_t Vars, size_t Degree>                                                      \
+  bool operator op(taylor<RealType, Vars, Degree> const& a,                                                     \
+                   typename taylor<RealType, Vars, Degree>::root_type const& b) {                               \
+    return a[0] op b;                                                                                           \
+  }                                                                                                             \
+  template <typename RealType, size_t Vars, size_t Degree>                                                      \
+  bool operator op(typename taylor<RealType, Vars, Degree>::root_type const& a,                                 \
+                   taylor<RealType, Vars, Degree> const& b) {                                                   \
+    return a op b[0];                                                                                           \
+  }
+
+BOOST_MATH_AUTODIFF_TAYLOR_COMPARISON(==)
+BOOST_MATH_AUTODIFF_TAYLOR_COMPARISON(!=)
+BOOST_MATH_AUTODIFF_TAYLOR_COMPARISON(<)
+BOOST_MATH_AUTODIFF_TAYLOR_COMPARISON(<=)
+BOOST_MATH_AUTODIFF_TAYLOR_COMPARISON(>)
+BOOST_MATH_AUTODIFF_TAYLOR_COMPARISON(>=)
+
+#undef BOOST_MATH_AUTODIFF_TAYLOR_COMPARISON
+
+template <typename RealType, size_t Vars, size_t Degree>
+std::ostream& operator<<(std::ostream& out, taylor<RealType, Vars, Degree> const& cr) {
+  out << "taylor(" << cr[0];
+  for (size_t i = 1; i < cr.size; ++i)
+    out << ',' << cr[i];
+  return out << ')';
+}
+
+// Standard math functions are overloaded and called via argument-dependent lookup (ADL).
+// Each takes the Taylor coefficients of the function of one variable from its overload for fvar.
+#define BOOST_MATH_AUTODIFF_TAYLOR_FUNCTION(name)                                                               \
+  template <typename RealType, size_t Vars, size_t Degree>                                                      \
+  taylor<RealType, Vars, Degree> name(taylor<RealType, Vars, Degree> const& cr) {                               \
+    return apply_function(cr, [](fvar<RealType, Degree> const& u) {                                             \
+      using std::name;                                                                                          \
+      return name(u);                                                                                           \
+    });                                                                                                         \
+  }
+
+BOOST_MATH_AUTODIFF_TAYLOR_FUNCTION(exp)
+BOOST_MATH_AUTODIFF_TAYLOR_FUNCTION(log)
+BOOST_MATH_AUTODIFF_TAYLOR_FUNCTION(sqrt)
+BOOST_MATH_AUTODIFF_TAYLOR_FUNCTION(sin)
+BOOST_MATH_AUTODIFF_TAYLOR_FUNCTION(cos)
+BOOST_MATH_AUTODIFF_TAYLOR_FUNCTION(tan)
+BOOST_MATH_AUTODIFF_TAYLOR_FUNCTION(asin)
+BOOST_MATH_AUTODIFF_TAYLOR_FUNCTION(acos)
+BOOST_MATH_AUTODIFF_TAYLOR_FUNCTION(atan)
+BOOST_MATH_AUTODIFF_TAYLOR_FUNCTION(sinh)
+BOOST_MATH_AUTODIFF_TAYLOR_FUNCTION(cosh)
+BOOST_MATH_AUTODIFF_TAYLOR_FUNCTION(tanh)
+BOOST_MATH_AUTODIFF_TAYLOR_FUNCTION(erf)
+BOOST_MATH_AUTODIFF_TAYLOR_FUNCTION(erfc)
+BOOST_MATH_AUTODIFF_TAYLOR_FUNCTION(lgamma)
+BOOST_MATH_AUTODIFF_TAYLOR_FUNCTION(tgamma)
+
+#undef BOOST_MATH_AUTODIFF_TAYLOR_FUNCTION
+
+template <typename RealType, size_t Vars, size_t Degree>
+taylor<RealType, Vars, Degree> pow(taylor<RealType, Vars, Degree> const& x,
+                                   typename taylor<RealType, Vars, Degree>::root_type const& y) {
+  return apply_function(x, [&y](fvar<RealType, Degree> const& u) { return pow(u, y); });
+}
+
+template <typename RealType, size_t Vars, size_t Degree>
+taylor<RealType, Vars, Degree> pow(typename taylor<RealType, Vars, Degree>::root_type const& x,
+                                   taylor<RealType, Vars, Degree> const& y) {
+  return apply_function(y, [&x](fvar<RealType, Degree> const& u) { return pow(x, u); });
+}
+
+template <typename RealType, size_t Vars, size_t Degree>
+taylor<RealType, Vars, Degree> pow(taylor<RealType, Vars, Degree> const& x, taylor<RealType, Vars, Degree> const& y) {
+  return exp(y * log(x));
+}
+
+}  // namespace detail
+
+template <typename RealType, size_t Variables, size_t Degree>
+using autodiff_taylor = detail::taylor<RealType, Variables, Degree>;
+
+// Variables of differentiation with values x[0], x[1], ..., of which derivatives up to total order Degree are held.
+template <typename RealType, size_t Degree, size_t Variables>
+std::array<autodiff_taylor<RealType, Variables, Degree>, Variables> make_taylor_variables(
+    std::array<RealType, Variables> const& x) {
+  std::array<autodiff_taylor<RealType, Variables, Degree>, Variables> r;
+  for (size_t i = 0; i < Variables; ++i)
+    r[i] = autodiff_taylor<RealType, Variables, Degree>(x[i], i);
+  return r;
+}
+
+}  // namespace autodiff_v1
+}  // namespace differentiation
+}  // namespace math
+}  // namespace boost
+
+#endif  // BOOST_MATH_DIFFERENTIATION_AUTODIFF_TAYLOR_HPP
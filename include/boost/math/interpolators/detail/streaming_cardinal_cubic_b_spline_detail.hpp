@@ -0,0 +1,190 @@
+// Copyright agent, 2026
+// Use, modification and distribution are subject to the
+// Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_INTERPOLATORS_STREAMING_CARDINAL_CUBIC_B_SPLINE_DETAIL_HPP
+#define BOOST_MATH_INTERPOLATORS_STREAMING_CARDINAL_CUBIC_B_SPLINE_DETAIL_HPP
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+#include <stdexcept>
+#include <utility>
+#include <boost/math/interpolators/detail/cardinal_cubic_b_spline_detail.hpp>
+
+namespace boost{ namespace math{ namespace interpolators{ namespace detail{
+
+// The coefficients of the cardinal cubic B-spline interpolant are obtained by applying the
+// inverse of the filter (z + 4 + 1/z)/6 to the samples; see
+// Unser, Michael, Akram Aldroubi, and Murray Eden. "B-spline signal processing. II. Efficiency design and applications."
+// IEEE transactions on signal processing 41.2 (1993): 834-848.
+// The inverse factors into a causal and an anticausal first order recursion with pole z1 = sqrt(3) - 2.
+// The causal pass is naturally streaming. The anticausal pass requires the future, but its impulse response decays like |z1|^k,
+// so once L samples with |z1|^L < eps have arrived after sample k, the coefficient of sample k is known to working precision.
+// Hence each push_back costs O(L) operations and no allocations, and the coefficients are retained in a ring buffer.
+template <class Real>
+class streaming_cardinal_cubic_b_spline_detail
+{
+public:
+    streaming_cardinal_cubic_b_spline_detail(Real t0, Real h, size_t capacity)
+    : m_t0{t0}, m_h{h}, m_inv_h{1/h}, m_samples{0}
+    {
+        using std::sqrt;
+        using std::log;
+        using std::ceil;
+        using std::abs;
+        if (h <= 0) {
+            throw std::domain_error("Spacing must be > 0.");
+        }
+        if (capacity < 4) {
+            throw std::domain_error("The streaming cubic b-spline requires a capacity of at least 4 coefficients.");
+        }
+        m_z1 = sqrt(Real(3)) - 2;
+        Real L = ceil(log(std::numeric_limits<Real>::epsilon()/2)/log(abs(m_z1)));
+        m_lookahead = static_cast<size_t>(L);
+        m_causal.resize(m_lookahead + 1);
+        m_alpha.resize(capacity);
+    }
+
+    void push_back(Real y)
+    {
+        size_t la = m_causal.size();
+        if (m_samples == 0) {
+            // Constant extension to the left of the first sample:
+            m_causal[0] = y/(1 - m_z1);
+        }
+        else {
+            m_causal[m_samples % la] = y + m_z1*m_causal[(m_samples - 1) % la];
+        }
+        ++m_samples;
+        if (m_samples <= m_lookahead) {
+            return;
+        }
+
+        // Run the anticausal recursion from the newest sample back to the one being finalized.
+        // Mirror-symmetric initialization at the newest sample:
+        size_t m = m_samples - 1;
+        Real cm = m_z1/(m_z1*m_z1 - 1)*(m_causal[m % la] + m_z1*m_causal[(m - 1) % la]);
+        for (size_t k = m - 1; k + m_lookahead >= m; --k) {
+            cm = m_z1*(cm - m_causal[k % la]);
+            if (k == 0) {
+                break;
+            }
+        }
+        size_t finalized = m - m_lookahead;
+        m_alpha[finalized % m_alpha.size()] = 6*cm;
+    }
+
+    Real operator()(Real t) const
+    {
+        size_t k;
+        Real x = this->locate(t, &k);
+        Real s = 0;
+        for (size_t j = k - 1; j <= k + 2; ++j) {
+            s += m_alpha[j % m_alpha.size()]*b3_spline(x - j);
+        }
+        return s;
+    }
+
+    Real prime(Real t) const
+    {
+        size_t k;
+        Real x = this->locate(t, &k);
+        Real s = 0;
+        for (size_t j = k - 1; j <= k + 2; ++j) {
+            s += m_alpha[j % m_alpha.size()]*b3_spline_prime(x - j);
+        }
+        return s*m_inv_h;
+    }
+
+    Real double_prime(Real t) const
+    {
+        size_t k;
+        Real x = this->locate(t, &k);
+        Real s = 0;
+        for (size_t j = k - 1; j <= k + 2; ++j) {
+            s += m_alpha[j % m_alpha.size()]*b3_spline_double_prime(x - j);
+        }
+        return s*m_inv_h*m_inv_h;
+    }
+
+    std::pair<Real, Real> domain() const
+    {
+        if (m_samples < m_lookahead + 4) {
+            return std::make_pair(std::numeric_limits<Real>::quiet_NaN(), std::numeric_limits<Real>::quiet_NaN());
+        }
+        size_t lo = first_coefficient() + 1;
+        size_t hi = last_coefficient() - 1;
+        return std::make_pair(m_t0 + lo*m_h, m_t0 + hi*m_h);
+    }
+
+    size_t size() const
+    {
+        return m_samples;
+    }
+
+    size_t capacity() const
+    {
+        return m_alpha.size();
+    }
+
+    size_t latency() const
+    {
+        return m_lookahead;
+    }
+
+    int64_t bytes() const
+    {
+        return sizeof(*this) + (m_alpha.capacity() + m_causal.capacity())*sizeof(Real);
+    }
+
+private:
+    size_t last_coefficient() const
+    {
+        return m_samples - 1 - m_lookahead;
+    }
+
+    size_t first_coefficient() const
+    {
+        size_t last = last_coefficient();
+        return last + 1 > m_alpha.size() ? last + 1 - m_alpha.size() : 0;
+    }
+
+    // Returns the scaled abscissa x = (t-t0)/h, and the index k of the knot to the left of x.
+    Real locate(Real t, size_t* k) const
+    {
+        using std::floor;
+        using std::isnan;
+        if (m_samples < m_lookahead + 4) {
+            throw std::domain_error("Not enough samples have been pushed to evaluate the streaming cubic b-spline.");
+        }
+        size_t lo = first_coefficient() + 1;
+        size_t hi = last_coefficient() - 1;
+        Real x = (t - m_t0)*m_inv_h;
+        if (isnan(x) || x < lo || x > hi) {
+            const char* err_msg = "Tried to evaluate the streaming cubic b-spline outside the window of retained coefficients.";
+            throw std::domain_error(err_msg);
+        }
+        *k = static_cast<size_t>(floor(x));
+        if (*k == hi) {
+            --*k;
+        }
+        return x;
+    }
+
+    Real m_t0;
+    Real m_h;
+    Real m_inv_h;
+    Real m_z1;
+    size_t m_samples;
+    size_t m_lookahead;
+    // Causal filter output for the last m_lookahead + 1 samples:
+    std::vector<Real> m_causal;
+    // Ring buffer of finalized spline coefficients:
+    std::vector<Real> m_alpha;
+};
+
+}}}}
+#endif
@@ -0,0 +1,75 @@
+// Copyright agent, 2026
+// Use, modification and distribution are subject to the
+// Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// A cardinal cubic B-spline which is built up sample-by-sample.
+// Memory usage is bounded by the capacity passed to the constructor, and each push_back costs O(latency) time and no allocations,
+// with the latency fixed at construction by the precision of Real.
+// The price paid is latency: The spline can only be evaluated up to latency() samples behind the most recent sample.
+
+#ifndef BOOST_MATH_INTERPOLATORS_STREAMING_CARDINAL_CUBIC_B_SPLINE_HPP
+#define BOOST_MATH_INTERPOLATORS_STREAMING_CARDINAL_CUBIC_B_SPLINE_HPP
+#include <memory>
+#include <boost/math/interpolators/detail/streaming_cardinal_cubic_b_spline_detail.hpp>
+
+namespace boost{ namespace math{ namespace interpolators {
+
+template <class Real>
+class streaming_cardinal_cubic_b_spline
+{
+public:
+    // Sample k is taken at t0 + k*h. At most `capacity` spline coefficients are retained.
+    streaming_cardinal_cubic_b_spline(Real t0 /* time of first sample */,
+                                      Real h  /* spacing, stepsize */,
+                                      size_t capacity)
+     : impl_(std::make_shared<detail::streaming_cardinal_cubic_b_spline_detail<Real>>(t0, h, capacity))
+    {}
+
+    void push_back(Real y) {
+        impl_->push_back(y);
+    }
+
+    Real operator()(Real t) const {
+        return impl_->operator()(t);
+    }
+
+    Real prime(Real t) const {
+        return impl_->prime(t);
+    }
+
+    Real double_prime(Real t) const {
+        return impl_->double_prime(t);
+    }
+
+    // The window [t_min, t_max] in which the spline can be evaluated.
+    // Both endpoints are nan until enough samples have been pushed.
+    std::pair<Real, Real> domain() const {
+        return impl_->domain();
+    }
+
+    // Number of samples pushed since construction.
+    size_t size() const {
+        return impl_->size();
+    }
+
+    size_t capacity() const {
+        return impl_->capacity();
+    }
+
+    // Number of samples which must follow a sample before its spline coefficient is known to working precision.
+    size_t latency() const {
+        return impl_->latency();
+    }
+
+    int64_t bytes() const {
+        return impl_->bytes() + sizeof(impl_);
+    }
+
+private:
+    std::shared_ptr<detail::streaming_cardinal_cubic_b_spline_detail<Real>> impl_;
+};
+
+}}}
+#endif
@@ -0,0 +1,720 @@
+//  (C) Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_QUADRATURE_GAUSS_RULE_HPP
+#define BOOST_MATH_QUADRATURE_GAUSS_RULE_HPP
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <list>
+#include <memory>
+#include <tuple>
+#include <utility>
+#include <vector>
+#include <boost/config.hpp>
+#ifdef BOOST_HAS_THREADS
+#include <boost/detail/lightweight_mutex.hpp>
+#endif
+#include <boost/math/constants/constants.hpp>
+#include <boost/math/policies/error_handling.hpp>
+#include <boost/math/special_functions/bessel.hpp>
+#include <boost/math/special_functions/beta.hpp>
+#include <boost/math/special_functions/gamma.hpp>
+#include <boost/math/special_functions/jacobi.hpp>
+#include <boost/math/tools/precision.hpp>
+
+//
+// Gauss rules of arbitrary order, for the Jacobi, Laguerre and Hermite weights, by the method of
+// Glaser, Liu and Rokhlin, "A fast algorithm for the calculation of the roots of special functions",
+// SIAM J. Sci. Comput. 29 (2007).  Each zero is found from the previous one by Newton's method on the
+// Taylor series of the polynomial about the previous zero, whose coefficients follow from the
+// differential equation; so the whole rule costs O(n) operations, in any precision.
+//
+namespace boost { namespace math { namespace quadrature { namespace detail {
+
+enum gauss_rule_family
+{
+   gauss_jacobi_family, gauss_laguerre_family, gauss_hermite_family
+};
+
+//
+// The polynomials satisfy A(x)y'' + B(x)y' + Cy = 0, with A quadratic and B linear,
+// and each of them is computed, scaled by 2^-e, by its three term recurrence:
+//
+template <class Real>
+inline int gauss_rule_shift()
+{
+   int shift = std::numeric_limits<Real>::max_exponent / 4;
+   return shift < 16 ? 16 : (shift > 4096 ? 4096 : shift);
+}
+
+template <class Real>
+inline void gauss_rule_rescale(Real& p0, Real& p1, int& e)
+{
+   using std::abs;
+   using std::ldexp;
+   static const int shift = gauss_rule_shift<Real>();
+   static const Real big = ldexp(Real(1), shift);
+   if (abs(p1) > big)
+   {
+      p0 = ldexp(p0, -shift);
+      p1 = ldexp(p1, -shift);
+      e += shift;
+   }
+}
+
+template <class Real>
+struct gauss_jacobi_ode
+{
+   gauss_jacobi_ode(unsigned n, const Real& a, const Real& b) : n(n), alpha(a), beta(b) {}
+
+   Real A(const Real& x) const { return (1 - x) * (1 + x); }
+   Real dA(const Real& x) const { return -2 * x; }
+   Real d2A() const { return -2; }
+   Real B(const Real& x) const { return beta - alpha - (alpha + beta + 2) * x; }
+   Real dB() const { return -(alpha + beta + 2); }
+   Real C() const { return n * (n + alpha + beta + 1); }
+
+   // P_n^(alpha, beta)(x) and its derivative, scaled by 2^-e:
+   void evaluate(const Real& x, Real& p, Real& dp, int& e) const
+   {
+      Real p0 = 1;
+      Real p1 = (alpha + 1) + (alpha + beta + 2) * (x - 1) / 2;
+      e = 0;
+      for (unsigned k = 2; k <= n; ++k)
+      {
+         Real a, b, c;
+         boost::math::detail::jacobi_recurrence_coefficients(Real(k), alpha, beta, a, b, c);
+         Real next = (a * x + b) * p1 + c * p0;
+         p0 = p1;
+         p1 = next;
+         gauss_rule_rescale(p0, p1, e);
+      }
+      Real m = 2 * n + alpha + beta;
+      p = p1;
+      dp = (n * ((alpha - beta) - m * x) * p1 + 2 * (n + alpha) * (n + beta) * p0) / (m * (1 - x) * (1 + x));
+   }
+
+   unsigned n;
+   Real alpha;
+   Real beta;
+};
+
+template <class Real>
+struct gauss_laguerre_ode
+{
+   gauss_laguerre_ode(unsigned n, const Real& a) : n(n), alpha(a) {}
+
+   Real A(const Real& x) const { return x; }
+   Real dA(const Real&) const { return 1; }
+   Real d2A() const { return 0; }
+   Real B(const Real& x) const { return alpha + 1 - x; }
+   Real dB() const { return -1; }
+   Real C() const { return n; }
+
+   void evaluate(const Real& x, Real& p, Real& dp, int& e) const
+   {
+      Real p0 = 1;
+      Real p1 = alpha + 1 - x;
+      e = 0;
+      for (unsigned k = 1; k < n; ++k)
+      {
+         Real next = ((2 * k + 1 + alpha - x) * p1 - (k + alpha) * p0) / (k + 1);
+         p0 = p1;
+         p1 = next;
+         gauss_rule_rescale(p0, p1, e);
+      }
+      p = p1;
+      dp = (n * p1 - (n + alpha) * p0) / x;
+   }
+
+   unsigned n;
+   Real alpha;
+};
+
+template <class Real>
+struct gauss_hermite_ode
+{
+   explicit gauss_hermite_ode(unsigned n) : n(n) {}
+
+   Real A(const Real&) const { return 1; }
+   Real dA(const Real&) const { return 0; }
+   Real d2A() const { return 0; }
+   Real B(const Real& x) const { return -2 * x; }
+   Real dB() const { return -2; }
+   Real C() const { return 2 * n; }
+
+   void evaluate(const Real& x, Real& p, Real& dp, int& e) const
+   {
+      Real p0 = 1;
+      Real p1 = 2 * x;
+      e = 0;
+      for (unsigned k = 1; k < n; ++k)
+      {
+         Real next = 2 * x * p1 - 2 * k * p0;
+         p0 = p1;
+         p1 = next;
+         gauss_rule_rescale(p0, p1, e);
+      }
+      p = p1;
+      dp = 2 * n * p0;
+   }
+
+   unsigned n;
+};
+
+//
+// The zeros, with the residual y/y' at each zero as rounded, and y' scaled by 2^-e:
+//
+template <class Real>
+struct gauss_rule_zeros
+{
+   explicit gauss_rule_zeros(std::size_t count) : x(count), r(count), d(count), e(count) {}
+
+   std::vector<Real> x;
+   std::vector<Real> r;
+   std::vector<Real> d;
+   std::vector<int> e;
+};
+
+//
+// Newton's method on the recurrence, deflated by the zeros already found so that no zero is found twice.
+// This costs O(n) per iteration, so is used only for the few zeros closest to a singular point of the
+// differential equation, where the Taylor series converge slowly.
+//
+template <class Real, class ODE>
+void gauss_rule_newton(const ODE& ode, const std::vector<Real>& guesses, gauss_rule_zeros<Real>& z)
+{
+   using std::abs;
+   const Real eps = tools::epsilon<Real>();
+   for (std::size_t k = 0; k < guesses.size(); ++k)
+   {
+      Real x = guesses[k];
+      Real p, dp;
+      int e;
+      for (unsigned iteration = 0; iteration < 100; ++iteration)
+      {
+         ode.evaluate(x, p, dp, e);
+         Real s = 0;
+         for (std::size_t j = 0; j < k; ++j)
+         {
+            s += 1 / (x - z.x[j]);
+         }
+         Real delta = p / (dp - p * s);
+         x -= delta;
+         if (!(abs(delta) > eps * abs(x)))
+         {
+            break;
+         }
+      }
+      ode.evaluate(x, p, dp, e);
+      z.x[k] = x;
+      z.r[k] = p / dp;
+      z.d[k] = dp;
+      z.e[k] = e;
+   }
+}
+
+// Q = q - p'/2 - p^2/4 for y'' + py' + qy = 0, so that u = y exp(1/2 int p) satisfies u'' + Qu = 0; also Q':
+template <class Real, class ODE>
+Real gauss_rule_liouville(const ODE& ode, const Real& x, Real& dQ)
+{
+   Real A = ode.A(x);
+   Real dA = ode.dA(x);
+   Real B = ode.B(x);
+   Real p = B / A;
+   Real N = ode.dB() * A - B * dA;
+   Real dp = N / (A * A);
+   Real d2p = (-B * ode.d2A() * A - 2 * N * dA) / (A * A * A);
+   Real q = ode.C() / A;
+   Real dq = -ode.C() * dA / (A * A);
+   dQ = dq - d2p / 2 - p * dp / 2;
+   return q - dp / 2 - p * p / 4;
+}
+
+//
+// With sqrt(Q) u = r sin(theta) and u' = r cos(theta), the zeros are at theta = k pi, and
+// dx/dtheta = 1/(sqrt(Q) + Q' sin(2 theta)/(4Q)), which the classical Runge-Kutta method integrates
+// well enough to start Newton's method.
+//
+template <class Real, class ODE>
+Real gauss_rule_prufer(const ODE& ode, Real x, Real theta, const Real& dtheta)
+{
+   using std::sin;
+   using std::sqrt;
+   const unsigned steps = 8;
+   Real h = dtheta / steps;
+   for (unsigned i = 0; i < steps; ++i)
+   {
+      Real k[4];
+      for (unsigned j = 0; j < 4; ++j)
+      {
+         Real offset = j == 0 ? Real(0) : (j == 3 ? h : h / 2);
+         Real z = j == 0 ? x : x + offset * k[j - 1];
+         Real dQ;
+         Real Q = gauss_rule_liouville(ode, z, dQ);
+         k[j] = 1 / (sqrt(Q) + dQ * sin(2 * (theta + offset)) / (4 * Q));
+      }
+      x += h * (k[0] + 2 * k[1] + 2 * k[2] + k[3]) / 6;
+      theta += h;
+   }
+   return x;
+}
+
+//
+// Finds count successive zeros in the given direction, starting from x0, which is either a zero with y/y' = r0 and
+// y' = d0 2^e0, or (if extremum) a point at which y' = 0 and y = d0 2^e0.  The residual at each zero is carried
+// into the next Taylor series, so that the rounding of the zeros does not accumulate.
+//
+template <class Real, class ODE>
+void gauss_rule_march(const ODE& ode, Real x0, Real r0, Real d0, int e0, bool extremum, int direction, gauss_rule_zeros<Real>& z, std::size_t first)
+{
+   using std::abs;
+   using std::frexp;
+   const Real eps = tools::epsilon<Real>();
+   const std::size_t max_terms = 20 + 3 * std::numeric_limits<Real>::digits10;
+   const Real half_pi = constants::half_pi<Real>();
+   std::vector<Real> u(max_terms);
+   for (std::size_t i = first; i < z.x.size(); ++i)
+   {
+      Real theta = extremum ? half_pi : Real(0);
+      Real t = gauss_rule_prufer(ode, x0, theta, direction * (extremum ? half_pi : 2 * half_pi)) - x0;
+      // The Taylor coefficients, to as many terms as are significant at a little beyond the first guess:
+      Real a0 = ode.A(x0);
+      Real a1 = ode.dA(x0);
+      Real a2 = ode.d2A() / 2;
+      Real b0 = ode.B(x0);
+      Real b1 = ode.dB();
+      Real c0 = ode.C();
+      Real h = 5 * abs(t) / 4;
+      u[0] = extremum ? Real(1) : r0;
+      u[1] = extremum ? Real(0) : Real(1);
+      Real largest = abs(u[0]) + abs(u[1]) * h;
+      std::size_t terms = 2;
+      Real hk = h;
+      while (terms < max_terms)
+      {
+         std::size_t k = terms - 2;
+         u[k + 2] = -((a1 * k + b0) * (k + 1) * u[k + 1] + (a2 * k * (k - 1) + b1 * k + c0) * u[k]) / (a0 * (k + 2) * (k + 1));
+         hk *= h;
+         Real last = abs(u[k + 2]) * hk * h;
+         largest = (std::max)(largest, last);
+         ++terms;
+         if (last + abs(u[k + 1]) * hk < eps * largest / 4)
+         {
+            break;
+         }
+      }
+      Real s, ds;
+      auto taylor = [&](const Real& v)
+      {
+         s = u[terms - 1];
+         ds = 0;
+         for (std::size_t k = terms - 1; k-- > 0;)
+         {
+            ds = ds * v + s;
+            s = s * v + u[k];
+         }
+      };
+      for (unsigned iteration = 0; iteration < 50; ++iteration)
+      {
+         taylor(t);
+         Real delta = s / ds;
+         t -= delta;
+         if (!(abs(delta) > eps * (std::max)(abs(x0 + t), abs(t))))
+         {
+            break;
+         }
+      }
+      Real x = x0 + t;
+      taylor(x - x0);
+      int k;
+      d0 = frexp(d0 * ds, &k);
+      e0 += k;
+      r0 = s / ds;
+      z.x[i] = x;
+      z.r[i] = r0;
+      z.d[i] = d0;
+      z.e[i] = e0;
+      x0 = x;
+      extremum = false;
+   }
+}
+
+// The weights are proportional to 1/(A y'^2) at the zeros; this is corrected to first order for the rounding of the zero:
+template <class Real, class ODE>
+void gauss_rule_weights(const ODE& ode, const gauss_rule_zeros<Real>& z, std::vector<Real>& w, std::vector<long>& e)
+{
+   using std::frexp;
+   w.resize(z.x.size());
+   e.resize(z.x.size());
+   for (std::size_t i = 0; i < z.x.size(); ++i)
+   {
+      Real x = z.x[i];
+      Real A = ode.A(x);
+      int k;
+      w[i] = frexp((1 - (2 * ode.B(x) - ode.dA(x)) * z.r[i] / A) / (A * z.d[i] * z.d[i]), &k);
+      e[i] = k - 2 * long(z.e[i]);
+   }
+}
+
+// Scale the weights to sum to mu0; weights too small to represent become zero:
+template <class Real>
+std::vector<Real> gauss_rule_normalize(const std::vector<Real>& w, const std::vector<long>& e, const Real& mu0)
+{
+   using std::frexp;
+   using std::ldexp;
+   long largest = *std::max_element(e.begin(), e.end());
+   Real sum = 0;
+   for (std::size_t i = 0; i < w.size(); ++i)
+   {
+      sum += ldexp(w[i], int((std::max)(e[i] - largest, long(std::numeric_limits<int>::min() / 2))));
+   }
+   int k;
+   Real scale = frexp(mu0 / sum, &k);
+   std::vector<Real> result(w.size());
+   for (std::size_t i = 0; i < w.size(); ++i)
+   {
+      long exponent = e[i] - largest + k;
+      result[i] = ldexp(scale * w[i], int((std::max)(exponent, long(std::numeric_limits<int>::min() / 2))));
+   }
+   return result;
+}
+
+// The zeros closest to a singular point are found by the recurrence, and the rest by the Taylor series.
+const std::size_t gauss_rule_boundary_zeros = 10;
+
+template <class Real, class ODE>
+gauss_rule_zeros<Real> gauss_rule_from_boundary(const ODE& ode, const std::vector<Real>& guesses, std::size_t count, int direction)
+{
+   gauss_rule_zeros<Real> z(count);
+   gauss_rule_newton(ode, guesses, z);
+   std::size_t k = guesses.size();
+   if (count > k)
+   {
+      gauss_rule_march(ode, z.x[k - 1], z.r[k - 1], z.d[k - 1], z.e[k - 1], false, direction, z, k);
+   }
+   return z;
+}
+
+// The count zeros of P_n^(alpha, beta) closest to x = 1, in decreasing order:
+template <class Real, class Policy>
+gauss_rule_zeros<Real> gauss_jacobi_zeros(unsigned n, const Real& alpha, const Real& beta, std::size_t count, std::vector<Real>& w, std::vector<long>& e, const Policy& pol)
+{
+   using std::cos;
+   gauss_jacobi_ode<Real> ode(n, alpha, beta);
+   // The zeros close to x = 1 are close to cos(j_{alpha, k}/rho), where j_{alpha, k} is a zero of J_alpha:
+   Real rho = n + (alpha + beta + 1) / 2;
+   std::vector<Real> guesses((std::min)(count, gauss_rule_boundary_zeros));
+   for (std::size_t k = 0; k < guesses.size(); ++k)
+   {
+      guesses[k] = cos(boost::math::cyl_bessel_j_zero(alpha, int(k + 1), pol) / rho);
+   }
+   gauss_rule_zeros<Real> z = gauss_rule_from_boundary(ode, guesses, count, -1);
+   gauss_rule_weights(ode, z, w, e);
+   return z;
+}
+
+template <class Real, class Policy>
+gauss_rule_zeros<Real> gauss_laguerre_zeros(unsigned n, const Real& alpha, std::vector<Real>& w, std::vector<long>& e, const Policy& pol)
+{
+   gauss_laguerre_ode<Real> ode(n, alpha);
+   // The zeros close to x = 0 are close to j_{alpha, k}^2/(4n + 2 alpha + 2):
+   std::vector<Real> guesses((std::min)(std::size_t(n), gauss_rule_boundary_zeros));
+   for (std::size_t k = 0; k < guesses.size(); ++k)
+   {
+      Real j = boost::math::cyl_bessel_j_zero(alpha, int(k + 1), pol);
+      guesses[k] = j * j / (4 * n + 2 * alpha + 2);
+   }
+   gauss_rule_zeros<Real> z = gauss_rule_from_boundary(ode, guesses, n, 1);
+   gauss_rule_weights(ode, z, w, e);
+   return z;
+}
+
+// The zeros of H_n in [0, infinity), in increasing order; the Taylor series converge everywhere, so march from the origin:
+template <class Real>
+gauss_rule_zeros<Real> gauss_hermite_zeros(unsigned n, std::vector<Real>& w, std::vector<long>& e)
+{
+   gauss_hermite_ode<Real> ode(n);
+   gauss_rule_zeros<Real> z(n - n / 2);
+   Real p, dp;
+   int k;
+   ode.evaluate(Real(0), p, dp, k);
+   if (n & 1)
+   {
+      z.x[0] = 0;
+      z.r[0] = 0;
+      z.d[0] = dp;
+      z.e[0] = k;
+      gauss_rule_march(ode, Real(0), Real(0), dp, k, false, 1, z, 1);
+   }
+   else
+   {
+      gauss_rule_march(ode, Real(0), Real(0), p, k, true, 1, z, 0);
+   }
+   gauss_rule_weights(ode, z, w, e);
+   return z;
+}
+
+} // namespace detail
+
+//
+// A Gauss rule of run time order: the integral of f against the weight of the rule is approximated by
+// the sum of weights()[i] * f(abscissa()[i]), which is exact for polynomials of degree up to 2 size() - 1.
+// The abscissas are in increasing order.
+//
+template <class Real>
+class gauss_rule
+{
+public:
+   gauss_rule(std::vector<Real>&& abscissa, std::vector<Real>&& weights)
+      : m_abscissa(std::move(abscissa)), m_weights(std::move(weights)) {}
+
+   std::size_t size() const { return m_abscissa.size(); }
+   const std::vector<Real>& abscissa() const { return m_abscissa; }
+   const std::vector<Real>& weights() const { return m_weights; }
+
+   template <class F>
+   auto integrate(F f, Real* pL1 = nullptr) const ->decltype(std::declval<F>()(std::declval<Real>()))
+   {
+      typedef decltype(f(Real(0))) K;
+      using std::abs;
+      K result = Real(0);
+      Real L1 = 0;
+      for (std::size_t i = 0; i < m_abscissa.size(); ++i)
+      {
+         K fx = f(m_abscissa[i]);
+         result += fx * m_weights[i];
+         L1 += abs(fx) * m_weights[i];
+      }
+      if (pL1)
+      {
+         *pL1 = L1;
+      }
+      return result;
+   }
+
+private:
+   std::vector<Real> m_abscissa;
+   std::vector<Real> m_weights;
+};
+
+namespace detail {
+
+template <class Real, class Policy>
+gauss_rule<Real> gauss_rule_generate(gauss_rule_family family, unsigned n, const Real& alpha, const Real& beta, const Policy& pol)
+{
+   using std::pow;
+   std::vector<Real> x(n);
+   std::vector<Real> w(n);
+   std::vector<long> e(n);
+   Real mu0;
+   std::size_t half = n / 2;
+   if (family == gauss_laguerre_family)
+   {
+      gauss_rule_zeros<Real> z = gauss_laguerre_zeros(n, alpha, w, e, pol);
+      x = z.x;
+      mu0 = boost::math::tgamma(alpha + 1, pol);
+   }
+   else if ((family == gauss_hermite_family) || (alpha == beta))
+   {
+      // Symmetric about the origin: find the zeros in [0, 1) and reflect them.
+      std::vector<Real> wr;
+      std::vector<long> er;
+      if (family == gauss_hermite_family)
+      {
+         gauss_rule_zeros<Real> z = gauss_hermite_zeros<Real>(n, wr, er);
+         std::copy(z.x.begin(), z.x.end(), x.begin() + (n - z.x.size()));
+         std::copy(wr.begin(), wr.end(), w.begin() + (n - z.x.size()));
+         std::copy(er.begin(), er.end(), e.begin() + (n - z.x.size()));
+         mu0 = constants::root_pi<Real>();
+      }
+      else
+      {
+         gauss_rule_zeros<Real> z = gauss_jacobi_zeros(n, alpha, alpha, n - half, wr, er, pol);
+         std::copy(z.x.begin(), z.x.end(), x.rbegin());
+         std::copy(wr.begin(), wr.end(), w.rbegin());
+         std::copy(er.begin(), er.end(), e.rbegin());
+         mu0 = boost::math::beta(alpha + 1, alpha + 1, pol) * pow(Real(2), 2 * alpha + 1);
+      }
+      if (n & 1)
+      {
+         x[half] = 0;
+      }
+      for (std::size_t i = 0; i < half; ++i)
+      {
+         x[i] = -x[n - 1 - i];
+         w[i] = w[n - 1 - i];
+         e[i] = e[n - 1 - i];
+      }
+   }
+   else
+   {
+      // P_n^(alpha, beta)(-x) = (-1)^n P_n^(beta, alpha)(x), so the zeros close to x = -1 are found in the same way as those close to 1:
+      std::vector<Real> wr, wl;
+      std::vector<long> er, el;
+      gauss_rule_zeros<Real> right = gauss_jacobi_zeros(n, alpha, beta, n - half, wr, er, pol);
+      gauss_rule_zeros<Real> left = gauss_jacobi_zeros(n, beta, alpha, half, wl, el, pol);
+      for (std::size_t i = 0; i < half; ++i)
+      {
+         x[i] = -left.x[i];
+         w[i] = wl[i];
+         e[i] = el[i];
+      }
+      std::copy(right.x.begin(), right.x.end(), x.rbegin());
+      std::copy(wr.begin(), wr.end(), w.rbegin());
+      std::copy(er.begin(), er.end(), e.rbegin());
+      mu0 = boost::math::beta(alpha + 1, beta + 1, pol) * pow(Real(2), alpha + beta + 1);
+   }
+   return gauss_rule<Real>(std::move(x), gauss_rule_normalize(w, e, mu0));
+}
+
+//
+// Rules are generated once and shared.  The generation is done outside the lock, so that other rules
+// may be looked up meanwhile; if two threads generate the same rule at once, the first to finish is kept.
+// Only the BOOST_MATH_GAUSS_RULE_CACHE_SIZE most recently requested rules are kept, so that sweeping the
+// exponents does not hold on to every rule ever made; an evicted rule lives on while a caller holds it.
+//
+#ifndef BOOST_MATH_GAUSS_RULE_CACHE_SIZE
+#define BOOST_MATH_GAUSS_RULE_CACHE_SIZE 32
+#endif
+
+template <class Key, class Rule>
+std::shared_ptr<Rule> gauss_rule_cache_find(std::list<std::pair<Key, std::shared_ptr<Rule>>>& cache, const Key& key)
+{
+   for (auto it = cache.begin(); it != cache.end(); ++it)
+   {
+      if (it->first == key)
+      {
+         // Most recently used first:
+         cache.splice(cache.begin(), cache, it);
+         return cache.front().second;
+      }
+   }
+   return std::shared_ptr<Rule>();
+}
+
+template <class Real, class Policy>
+std::shared_ptr<const gauss_rule<Real>> gauss_rule_cached(gauss_rule_family family, unsigned n, const Real& alpha, const Real& beta, const Policy&)
+{
+   typedef std::tuple<int, unsigned, Real, Real> key_type;
+   static std::list<std::pair<key_type, std::shared_ptr<const gauss_rule<Real>>>> cache;
+#ifdef BOOST_HAS_THREADS
+   static boost::detail::lightweight_mutex mutex;
+#endif
+   key_type key(family, n, alpha, beta);
+   {
+#ifdef BOOST_HAS_THREADS
+      boost::detail::lightweight_mutex::scoped_lock lock(mutex);
+#endif
+      std::shared_ptr<const gauss_rule<Real>> found = gauss_rule_cache_find(cache, key);
+      if (found)
+      {
+         return found;
+      }
+   }
+   // The zeros and weights are each found from the last, so the rounding error grows with n; work in the promoted type:
+   typedef typename policies::evaluation<Real, Policy>::type value_type;
+   typedef typename policies::normalise<
+      Policy,
+      policies::promote_float<false>,
+      policies::promote_double<false>,
+      policies::discrete_quantile<>,
+      policies::assert_undefined<> >::type forwarding_policy;
+   gauss_rule<value_type> generated = gauss_rule_generate(family, n, value_type(alpha), value_type(beta), forwarding_policy());
+   std::vector<Real> x(generated.abscissa().begin(), generated.abscissa().end());
+   std::vector<Real> w(generated.weights().begin(), generated.weights().end());
+   std::shared_ptr<const gauss_rule<Real>> rule = std::make_shared<const gauss_rule<Real>>(std::move(x), std::move(w));
+#ifdef BOOST_HAS_THREADS
+   boost::detail::lightweight_mutex::scoped_lock lock(mutex);
+#endif
+   std::shared_ptr<const gauss_rule<Real>> found = gauss_rule_cache_find(cache, key);
+   if (found)
+   {
+      return found;
+   }
+   cache.push_front(std::make_pair(key, rule));
+   if (cache.size() > BOOST_MATH_GAUSS_RULE_CACHE_SIZE)
+   {
+      cache.pop_back();
+   }
+   return rule;
+}
+
+template <class Real, class Policy>
+bool gauss_rule_check(const char* function, unsigned n, const Real& alpha, const Real& beta, std::shared_ptr<const gauss_rule<Real>>& result, const Policy& pol)
+{
+   if (n == 0)
+   {
+      policies::raise_domain_error(function, "The number of abscissas must be at least one, but got %1%.", Real(n), pol);
+      return false;
+   }
+   if (!(alpha > -1) || !(boost::math::isfinite)(alpha))
+   {
+      policies::raise_domain_error(function, "The exponents of the weight must be finite and greater than -1, but got %1%.", alpha, pol);
+      return false;
+   }
+   if (!(beta > -1) || !(boost::math::isfinite)(beta))
+   {
+      policies::raise_domain_error(function, "The exponents of the weight must be finite and greater than -1, but got %1%.", beta, pol);
+      return false;
+   }
+   result.reset();
+   return true;
+}
+
+} // namespace detail
+
+// The n point rule for the weight (1-x)^alpha (1+x)^beta on [-1, 1]:
+template <class Real, class Policy = boost::math::policies::policy<> >
+std::shared_ptr<const gauss_rule<Real>> gauss_jacobi_rule(unsigned n, Real alpha, Real beta)
+{
+   std::shared_ptr<const gauss_rule<Real>> result;
+   if (!detail::gauss_rule_check("boost::math::quadrature::gauss_jacobi_rule<%1%>(unsigned, %1%, %1%)", n, alpha, beta, result, Policy()))
+   {
+      return result;
+   }
+   return detail::gauss_rule_cached(detail::gauss_jacobi_family, n, alpha, beta, Policy());
+}
+
+// The n point rule for the weight 1 on [-1, 1]:
+template <class Real, class Policy = boost::math::policies::policy<> >
+std::shared_ptr<const gauss_rule<Real>> gauss_legendre_rule(unsigned n)
+{
+   return gauss_jacobi_rule<Real, Policy>(n, Real(0), Real(0));
+}
+
+// The n point rule for the weight x^alpha e^-x on [0, infinity):
+template <class Real, class Policy = boost::math::policies::policy<> >
+std::shared_ptr<const gauss_rule<Real>> gauss_laguerre_rule(unsigned n, Real alpha = 0)
+{
+   std::shared_ptr<const gauss_rule<Real>> result;
+   if (!detail::gauss_rule_check("boost::math::quadrature::gauss_laguerre_rule<%1%>(unsigned, %1%)", n, alpha, Real(0), result, Policy()))
+   {
+      return result;
+   }
+   return detail::gauss_rule_cached(detail::gauss_laguerre_family, n, alpha, Real(0), Policy());
+}
+
+// The n point rule for the weight e^-x^2 on (-infinity, infinity):
+template <class Real, class Policy = boost::math::policies::policy<> >
+std::shared_ptr<const gauss_rule<Real>> gauss_hermite_rule(unsigned n)
+{
+   std::shared_ptr<const gauss_rule<Real>> result;
+   if (!detail::gauss_rule_check("boost::math::quadrature::gauss_hermite_rule<%1%>(unsigned)", n, Real(0), Real(0), result, Policy()))
+   {
+      return result;
+   }
+   return detail::gauss_rule_cached(detail::gauss_hermite_family, n, Real(0), Real(0), Policy());
+}
+
+}}} // namespaces
+
+#endif
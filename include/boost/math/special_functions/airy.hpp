@@ -12,6 +12,7 @@
 #include <boost/math/special_functions/bessel.hpp>
 #include <boost/math/special_functions/cbrt.hpp>
 #include <boost/math/special_functions/detail/airy_ai_bi_zero.hpp>
+#include <boost/math/special_functions/detail/zeros_execution.hpp>
 #include <boost/math/tools/roots.hpp>
 
 namespace boost{ namespace math{
@@ -464,6 +465,54 @@ inline OutputIterator airy_bi_zero(
    return airy_bi_zero<T>(start_index, number_of_zeros, out_it, policies::policy<>());
 }
 
+#if !defined(BOOST_NO_CXX17_HDR_EXECUTION) && !defined(BOOST_NO_CXX17_IF_CONSTEXPR)
+
+template <class T, class ExecutionPolicy, class OutputIterator, class Policy, class = detail::enable_if_execution_policy<ExecutionPolicy> >
+inline OutputIterator airy_ai_zero(
+                         ExecutionPolicy&& exec,
+                         int start_index,
+                         unsigned number_of_zeros,
+                         OutputIterator out_it,
+                         const Policy& pol)
+{
+   return detail::zeros_with_execution_policy(exec, start_index, number_of_zeros, out_it,
+      [&pol](int m) { return boost::math::airy_ai_zero<T>(m, pol); });
+}
+
+template <class T, class ExecutionPolicy, class OutputIterator, class = detail::enable_if_execution_policy<ExecutionPolicy> >
+inline OutputIterator airy_ai_zero(
+                         ExecutionPolicy&& exec,
+                         int start_index,
+                         unsigned number_of_zeros,
+                         OutputIterator out_it)
+{
+   return airy_ai_zero<T>(exec, start_index, number_of_zeros, out_it, policies::policy<>());
+}
+
+template <class T, class ExecutionPolicy, class OutputIterator, class Policy, class = detail::enable_if_execution_policy<ExecutionPolicy> >
+inline OutputIterator airy_bi_zero(
+                         ExecutionPolicy&& exec,
+                         int start_index,
+                         unsigned number_of_zeros,
+                         OutputIterator out_it,
+                         const Policy& pol)
+{
+   return detail::zeros_with_execution_policy(exec, start_index, number_of_zeros, out_it,
+      [&pol](int m) { return boost::math::airy_bi_zero<T>(m, pol); });
+}
+
+template <class T, class ExecutionPolicy, class OutputIterator, class = detail::enable_if_execution_policy<ExecutionPolicy> >
+inline OutputIterator airy_bi_zero(
+                         ExecutionPolicy&& exec,
+                         int start_index,
+                         unsigned number_of_zeros,
+                         OutputIterator out_it)
+{
+   return airy_bi_zero<T>(exec, start_index, number_of_zeros, out_it, policies::policy<>());
+}
+
+#endif
+
 }} // namespaces
 
 #endif // BOOST_MATH_AIRY_HPP
@@ -138,6 +138,48 @@ inline OutputIterator tangent_t2n(const int start_index,
    return boost::math::tangent_t2n<T, OutputIterator>(start_index, number_of_tangent_t2n, out_it, policies::policy<>());
 }
 
+//
+// Persistence of the table of Bernoulli and tangent numbers used for multiprecision types:
+// save_bernoulli_cache writes the table, extended to at least the given number of entries,
+// and load_bernoulli_cache restores it into the table used with that policy, and into the
+// one used by the special functions which call bernoulli_b2n internally:
+//
+template <class T, class Policy>
+inline void save_bernoulli_cache(std::ostream& os, const unsigned number_of_bernoullis_b2n, const Policy&)
+{
+   boost::math::detail::get_bernoulli_numbers_cache<T, Policy>().save(os, number_of_bernoullis_b2n);
+}
+
+template <class T>
+inline void save_bernoulli_cache(std::ostream& os, const unsigned number_of_bernoullis_b2n)
+{
+   boost::math::save_bernoulli_cache<T>(os, number_of_bernoullis_b2n, policies::policy<>());
+}
+
+template <class T, class Policy>
+bool load_bernoulli_cache(std::istream& is, const Policy&)
+{
+   typedef typename policies::normalise<
+      Policy,
+      policies::promote_float<false>,
+      policies::promote_double<false>,
+      policies::discrete_quantile<>,
+      policies::assert_undefined<> >::type forwarding_policy;
+   std::vector<T> b, t, intermediates;
+   std::size_t overflow_limit;
+   if(!boost::math::detail::bernoulli_numbers_cache<T, Policy>::read(is, b, t, intermediates, overflow_limit))
+      return false;
+   if(!boost::is_same<Policy, forwarding_policy>::value)
+      boost::math::detail::get_bernoulli_numbers_cache<T, forwarding_policy>().load(b, t, intermediates, overflow_limit);
+   return boost::math::detail::get_bernoulli_numbers_cache<T, Policy>().load(b, t, intermediates, overflow_limit);
+}
+
+template <class T>
+inline bool load_bernoulli_cache(std::istream& is)
+{
+   return boost::math::load_bernoulli_cache<T>(is, policies::policy<>());
+}
+
 } } // namespace boost::math
 
 #endif // _BOOST_BERNOULLI_B2N_2013_05_30_HPP_
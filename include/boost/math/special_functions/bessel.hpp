@@ -35,6 +35,7 @@
 #include <boost/math/tools/promotion.hpp>
 #include <boost/math/tools/series.hpp>
 #include <boost/math/tools/roots.hpp>
+#include <boost/math/special_functions/detail/zeros_execution.hpp>
 
 namespace boost{ namespace math{
 
@@ -754,6 +755,54 @@ inline OutputIterator cyl_neumann_zero(T v,
    return cyl_neumann_zero(v, start_index, number_of_zeros, out_it, policies::policy<>());
 }
 
+#if !defined(BOOST_NO_CXX17_HDR_EXECUTION) && !defined(BOOST_NO_CXX17_IF_CONSTEXPR)
+
+template <class ExecutionPolicy, class T, class OutputIterator, class Policy, class = detail::enable_if_execution_policy<ExecutionPolicy> >
+inline OutputIterator cyl_bessel_j_zero(ExecutionPolicy&& exec,
+                              T v,
+                              int start_index,
+                              unsigned number_of_zeros,
+                              OutputIterator out_it,
+                              const Policy& pol)
+{
+   return detail::zeros_with_execution_policy(exec, start_index, number_of_zeros, out_it,
+      [v, &pol](int m) { return boost::math::cyl_bessel_j_zero(v, m, pol); });
+}
+
+template <class ExecutionPolicy, class T, class OutputIterator, class = detail::enable_if_execution_policy<ExecutionPolicy> >
+inline OutputIterator cyl_bessel_j_zero(ExecutionPolicy&& exec,
+                              T v,
+                              int start_index,
+                              unsigned number_of_zeros,
+                              OutputIterator out_it)
+{
+   return cyl_bessel_j_zero(exec, v, start_index, number_of_zeros, out_it, policies::policy<>());
+}
+
+template <class ExecutionPolicy, class T, class OutputIterator, class Policy, class = detail::enable_if_execution_policy<ExecutionPolicy> >
+inline OutputIterator cyl_neumann_zero(ExecutionPolicy&& exec,
+                             T v,
+                             int start_index,
+                             unsigned number_of_zeros,
+                             OutputIterator out_it,
+                             const Policy& pol)
+{
+   return detail::zeros_with_execution_policy(exec, start_index, number_of_zeros, out_it,
+      [v, &pol](int m) { return boost::math::cyl_neumann_zero(v, m, pol); });
+}
+
+template <class ExecutionPolicy, class T, class OutputIterator, class = detail::enable_if_execution_policy<ExecutionPolicy> >
+inline OutputIterator cyl_neumann_zero(ExecutionPolicy&& exec,
+                             T v,
+                             int start_index,
+                             unsigned number_of_zeros,
+                             OutputIterator out_it)
+{
+   return cyl_neumann_zero(exec, v, start_index, number_of_zeros, out_it, policies::policy<>());
+}
+
+#endif
+
 } // namespace math
 } // namespace boost
 
@@ -0,0 +1,454 @@
+//  (C) Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Bessel functions of a sequence of orders v, v+1, ..., v+n-1 at one argument.
+//
+// The minimal solutions of the three term recurrence (J and I, and the spherical j) are found
+// by backward recurrence from the highest order, started either from the ratio of the two highest
+// orders given by the continued fraction of the recurrence (when the highest order is at least x,
+// so the fraction converges quickly) or from two direct evaluations (when it is below x, so both
+// values are of moderate size).  The result is normalized by a single direct evaluation at the
+// largest element of the unnormalized sequence, which is never close to a zero of the function.
+// The dominant solutions (Y, K and the spherical y) are found by forward recurrence from two
+// direct evaluations at the lowest orders.
+// The total cost is O(n) plus two or three scalar evaluations, rather than n scalar evaluations.
+//
+#ifndef BOOST_MATH_BESSEL_ARRAY_HPP
+#define BOOST_MATH_BESSEL_ARRAY_HPP
+
+#ifdef _MSC_VER
+#  pragma once
+#endif
+
+#include <vector>
+#include <boost/math/special_functions/bessel.hpp>
+#include <boost/math/special_functions/bessel_iterators.hpp>
+#include <boost/math/special_functions/fpclassify.hpp>
+#include <boost/math/tools/recurrence.hpp>
+#include <boost/math/constants/constants.hpp>
+#if !defined(BOOST_NO_CXX17_HDR_EXECUTION) && !defined(BOOST_NO_CXX17_IF_CONSTEXPR)
+#include <algorithm>
+#include <execution>
+#include <numeric>
+#include <type_traits>
+#endif
+
+namespace boost{ namespace math{
+
+namespace detail{
+
+//
+// Backward recurrence f_{k-1} = (2(v+k)/x) f_k - s f_{k+1} from the given f[n-1] and f[n-2].
+// The values grow as the order decreases, so whenever the next step could overflow the
+// values computed so far are rescaled; those which underflow are exactly the ones whose true
+// values are negligible.  Returns false if the recurrence cannot be run at all (x is so small
+// that a single step overflows), true otherwise, and sets rescaled if any rescaling took place.
+//
+template <class T>
+bool bessel_backward_recurrence(T v, T x, T s, T* f, std::size_t n, bool& rescaled)
+{
+   BOOST_MATH_STD_USING
+   std::size_t live = n;
+   rescaled = false;
+   for(std::size_t k = n - 2; k > 0; --k)
+   {
+      T fact = 2 * (v + k) / x;
+      if(fabs(fact) > tools::max_value<T>() / 4)
+         return false;
+      if((fabs(f[k]) > 1) && (fabs(f[k]) > tools::max_value<T>() / (2 * fabs(fact) + 2)))
+      {
+         T scale = 1 / fabs(f[k]);
+         for(std::size_t j = k; j < live; ++j)
+            f[j] *= scale;
+         while((live > k + 1) && (f[live - 1] == 0))
+            --live;
+         rescaled = true;
+      }
+      f[k - 1] = fact * f[k] - s * f[k + 1];
+   }
+   return true;
+}
+
+//
+// The minimal solution of the recurrence for orders v, v+1, ... v+n-1, with Recurrence
+// bessel_jy_recurrence (s = 1) or bessel_ik_recurrence (s = -1), and exact(k) the direct
+// evaluation of the function at order v+k.
+//
+template <class T, class Recurrence, class Exact, class Policy>
+void bessel_minimal_array(T v, T x, T s, T* f, std::size_t n, Exact exact, const char* function, const Policy& pol)
+{
+   BOOST_MATH_STD_USING
+   if(n < 3)
+   {
+      for(std::size_t k = 0; k < n; ++k)
+         f[k] = exact(k);
+      return;
+   }
+   T top = v + (n - 1);
+   bool normalize;
+   if(top >= x)
+   {
+      boost::uintmax_t max_iter = policies::get_max_series_iterations<Policy>();
+      f[n - 1] = tools::function_ratio_from_backwards_recurrence(Recurrence(top, x), T(tools::epsilon<T>()), max_iter);
+      policies::check_series_iterations<T>(function, max_iter, pol);
+      f[n - 2] = 1;
+      normalize = true;
+   }
+   else
+   {
+      f[n - 1] = exact(n - 1);
+      f[n - 2] = exact(n - 2);
+      normalize = false;
+   }
+   bool rescaled;
+   if(!bessel_backward_recurrence(v, x, s, f, n, rescaled))
+   {
+      for(std::size_t k = 0; k < n; ++k)
+         f[k] = exact(k);
+      return;
+   }
+   if(normalize || rescaled)
+   {
+      std::size_t j = 0;
+      for(std::size_t k = 1; k < n; ++k)
+      {
+         if(fabs(f[k]) > fabs(f[j]))
+            j = k;
+      }
+      T fj = exact(j);
+      T scale = fj / f[j];
+      for(std::size_t k = 0; k < n; ++k)
+         f[k] *= scale;
+      f[j] = fj;
+   }
+}
+
+//
+// The dominant solution by forward recurrence f_{k+1} = (2(v+k)/x) f_k + s f_{k-1}:
+// s = -1 for Y and s = 1 for K.  Once the values overflow, the rest of the sequence is
+// set by the overflow error handler, with the sign of the last finite value.
+//
+template <class T, class Exact, class Policy>
+void bessel_dominant_array(T v, T x, T s, T* f, std::size_t n, Exact exact, const char* function, const Policy& pol)
+{
+   BOOST_MATH_STD_USING
+   for(std::size_t k = 0; k < (std::min)(n, std::size_t(2)); ++k)
+      f[k] = exact(k);
+   for(std::size_t k = 1; k + 1 < n; ++k)
+   {
+      T fact = 2 * (v + k) / x;
+      if((fabs(f[k]) > 1) && (fabs(fact) > tools::max_value<T>() / (2 * fabs(f[k]))))
+      {
+         T inf = policies::raise_overflow_error<T>(function, 0, pol);
+         for(std::size_t j = k + 1; j < n; ++j)
+            f[j] = f[k] < 0 ? T(-inf) : inf;
+         return;
+      }
+      f[k + 1] = fact * f[k] + s * f[k - 1];
+   }
+}
+
+template <class T>
+inline bool bessel_array_use_recurrence(T v, T x)
+{
+   // Zero, negative and infinite arguments, and negative orders, go through the scalar functions,
+   // which deal with all the special cases:
+   return (x > 0) && (boost::math::isfinite)(x) && (v >= 0);
+}
+
+template <class T, class Policy>
+void cyl_bessel_j_array_imp(T v, T x, std::vector<T>& f, const Policy& pol)
+{
+   auto exact = [&](std::size_t k) { return boost::math::cyl_bessel_j(T(v + k), x, pol); };
+   if(!bessel_array_use_recurrence(v, x))
+   {
+      for(std::size_t k = 0; k < f.size(); ++k)
+         f[k] = exact(k);
+      return;
+   }
+   bessel_minimal_array<T, bessel_jy_recurrence<T> >(v, x, T(1), f.data(), f.size(), exact, "boost::math::cyl_bessel_j_array<%1%>(%1%,%1%)", pol);
+}
+
+template <class T, class Policy>
+void cyl_bessel_i_array_imp(T v, T x, std::vector<T>& f, const Policy& pol)
+{
+   auto exact = [&](std::size_t k) { return boost::math::cyl_bessel_i(T(v + k), x, pol); };
+   if(!bessel_array_use_recurrence(v, x))
+   {
+      for(std::size_t k = 0; k < f.size(); ++k)
+         f[k] = exact(k);
+      return;
+   }
+   bessel_minimal_array<T, bessel_ik_recurrence<T> >(v, x, T(-1), f.data(), f.size(), exact, "boost::math::cyl_bessel_i_array<%1%>(%1%,%1%)", pol);
+}
+
+template <class T, class Policy>
+void cyl_neumann_array_imp(T v, T x, std::vector<T>& f, const Policy& pol)
+{
+   auto exact = [&](std::size_t k) { return boost::math::cyl_neumann(T(v + k), x, pol); };
+   if(!bessel_array_use_recurrence(v, x))
+   {
+      for(std::size_t k = 0; k < f.size(); ++k)
+         f[k] = exact(k);
+      return;
+   }
+   bessel_dominant_array(v, x, T(-1), f.data(), f.size(), exact, "boost::math::cyl_neumann_array<%1%>(%1%,%1%)", pol);
+}
+
+template <class T, class Policy>
+void cyl_bessel_k_array_imp(T v, T x, std::vector<T>& f, const Policy& pol)
+{
+   auto exact = [&](std::size_t k) { return boost::math::cyl_bessel_k(T(v + k), x, pol); };
+   if(!bessel_array_use_recurrence(v, x))
+   {
+      for(std::size_t k = 0; k < f.size(); ++k)
+         f[k] = exact(k);
+      return;
+   }
+   bessel_dominant_array(v, x, T(1), f.data(), f.size(), exact, "boost::math::cyl_bessel_k_array<%1%>(%1%,%1%)", pol);
+}
+
+//
+// The spherical functions satisfy the recurrences of J and Y of order n + 1/2,
+// so only the direct evaluations differ:
+//
+template <class T, class Policy>
+void sph_bessel_array_imp(unsigned v, T x, std::vector<T>& f, const Policy& pol)
+{
+   auto exact = [&](std::size_t k) { return boost::math::sph_bessel(static_cast<unsigned>(v + k), x, pol); };
+   if(!bessel_array_use_recurrence(T(v), x))
+   {
+      for(std::size_t k = 0; k < f.size(); ++k)
+         f[k] = exact(k);
+      return;
+   }
+   bessel_minimal_array<T, bessel_jy_recurrence<T> >(T(v + constants::half<T>()), x, T(1), f.data(), f.size(), exact, "boost::math::sph_bessel_array<%1%>(%1%,%1%)", pol);
+}
+
+template <class T, class Policy>
+void sph_neumann_array_imp(unsigned v, T x, std::vector<T>& f, const Policy& pol)
+{
+   auto exact = [&](std::size_t k) { return boost::math::sph_neumann(static_cast<unsigned>(v + k), x, pol); };
+   if(!bessel_array_use_recurrence(T(v), x))
+   {
+      for(std::size_t k = 0; k < f.size(); ++k)
+         f[k] = exact(k);
+      return;
+   }
+   bessel_dominant_array(T(v + constants::half<T>()), x, T(-1), f.data(), f.size(), exact, "boost::math::sph_neumann_array<%1%>(%1%,%1%)", pol);
+}
+
+template <class Result, class T, class OutputIterator, class Policy>
+inline OutputIterator bessel_array_copy(const std::vector<T>& f, OutputIterator out_it, const char* function, const Policy&)
+{
+   for(std::size_t k = 0; k < f.size(); ++k)
+   {
+      *out_it = policies::checked_narrowing_cast<Result, Policy>(f[k], function);
+      ++out_it;
+   }
+   return out_it;
+}
+
+} // namespace detail
+
+template <class T1, class T2, class OutputIterator, class Policy>
+inline OutputIterator cyl_bessel_j_array(T1 v, unsigned number_of_orders, T2 x, OutputIterator out_it, const Policy& pol)
+{
+   BOOST_FPU_EXCEPTION_GUARD
+   typedef typename detail::bessel_traits<T1, T2, Policy>::result_type result_type;
+   typedef typename policies::evaluation<result_type, Policy>::type value_type;
+   typedef typename policies::normalise<
+      Policy,
+      policies::promote_float<false>,
+      policies::promote_double<false>,
+      policies::discrete_quantile<>,
+      policies::assert_undefined<> >::type forwarding_policy;
+   std::vector<value_type> f(number_of_orders);
+   detail::cyl_bessel_j_array_imp(static_cast<value_type>(v), static_cast<value_type>(x), f, forwarding_policy());
+   return detail::bessel_array_copy<result_type>(f, out_it, "boost::math::cyl_bessel_j_array<%1%>(%1%,%1%)", pol);
+}
+
+template <class T1, class T2, class OutputIterator>
+inline OutputIterator cyl_bessel_j_array(T1 v, unsigned number_of_orders, T2 x, OutputIterator out_it)
+{
+   return cyl_bessel_j_array(v, number_of_orders, x, out_it, policies::policy<>());
+}
+
+template <class T1, class T2, class OutputIterator, class Policy>
+inline OutputIterator cyl_neumann_array(T1 v, unsigned number_of_orders, T2 x, OutputIterator out_it, const Policy& pol)
+{
+   BOOST_FPU_EXCEPTION_GUARD
+   typedef typename detail::bessel_traits<T1, T2, Policy>::result_type result_type;
+   typedef typename policies::evaluation<result_type, Policy>::type value_type;
+   typedef typename policies::normalise<
+      Policy,
+      policies::promote_float<false>,
+      policies::promote_double<false>,
+      policies::discrete_quantile<>,
+      policies::assert_undefined<> >::type forwarding_policy;
+   std::vector<value_type> f(number_of_orders);
+   detail::cyl_neumann_array_imp(static_cast<value_type>(v), static_cast<value_type>(x), f, forwarding_policy());
+   return detail::bessel_array_copy<result_type>(f, out_it, "boost::math::cyl_neumann_array<%1%>(%1%,%1%)", pol);
+}
+
+template <class T1, class T2, class OutputIterator>
+inline OutputIterator cyl_neumann_array(T1 v, unsigned number_of_orders, T2 x, OutputIterator out_it)
+{
+   return cyl_neumann_array(v, number_of_orders, x, out_it, policies::policy<>());
+}
+
+template <class T1, class T2, class OutputIterator, class Policy>
+inline OutputIterator cyl_bessel_i_array(T1 v, unsigned number_of_orders, T2 x, OutputIterator out_it, const Policy& pol)
+{
+   BOOST_FPU_EXCEPTION_GUARD
+   typedef typename detail::bessel_traits<T1, T2, Policy>::result_type result_type;
+   typedef typename policies::evaluation<result_type, Policy>::type value_type;
+   typedef typename policies::normalise<
+      Policy,
+      policies::promote_float<false>,
+      policies::promote_double<false>,
+      policies::discrete_quantile<>,
+      policies::assert_undefined<> >::type forwarding_policy;
+   std::vector<value_type> f(number_of_orders);
+   detail::cyl_bessel_i_array_imp(static_cast<value_type>(v), static_cast<value_type>(x), f, forwarding_policy());
+   return detail::bessel_array_copy<result_type>(f, out_it, "boost::math::cyl_bessel_i_array<%1%>(%1%,%1%)", pol);
+}
+
+template <class T1, class T2, class OutputIterator>
+inline OutputIterator cyl_bessel_i_array(T1 v, unsigned number_of_orders, T2 x, OutputIterator out_it)
+{
+   return cyl_bessel_i_array(v, number_of_orders, x, out_it, policies::policy<>());
+}
+
+template <class T1, class T2, class OutputIterator, class Policy>
+inline OutputIterator cyl_bessel_k_array(T1 v, unsigned number_of_orders, T2 x, OutputIterator out_it, const Policy& pol)
+{
+   BOOST_FPU_EXCEPTION_GUARD
+   typedef typename detail::bessel_traits<T1, T2, Policy>::result_type result_type;
+   typedef typename policies::evaluation<result_type, Policy>::type value_type;
+   typedef typename policies::normalise<
+      Policy,
+      policies::promote_float<false>,
+      policies::promote_double<false>,
+      policies::discrete_quantile<>,
+      policies::assert_undefined<> >::type forwarding_policy;
+   std::vector<value_type> f(number_of_orders);
+   detail::cyl_bessel_k_array_imp(static_cast<value_type>(v), static_cast<value_type>(x), f, forwarding_policy());
+   return detail::bessel_array_copy<result_type>(f, out_it, "boost::math::cyl_bessel_k_array<%1%>(%1%,%1%)", pol);
+}
+
+template <class T1, class T2, class OutputIterator>
+inline OutputIterator cyl_bessel_k_array(T1 v, unsigned number_of_orders, T2 x, OutputIterator out_it)
+{
+   return cyl_bessel_k_array(v, number_of_orders, x, out_it, policies::policy<>());
+}
+
+template <class T, class OutputIterator, class Policy>
+inline OutputIterator sph_bessel_array(unsigned v, unsigned number_of_orders, T x, OutputIterator out_it, const Policy& pol)
+{
+   BOOST_FPU_EXCEPTION_GUARD
+   typedef typename detail::bessel_traits<T, T, Policy>::result_type result_type;
+   typedef typename policies::evaluation<result_type, Policy>::type value_type;
+   typedef typename policies::normalise<
+      Policy,
+      policies::promote_float<false>,
+      policies::promote_double<false>,
+      policies::discrete_quantile<>,
+      policies::assert_undefined<> >::type forwarding_policy;
+   std::vector<value_type> f(number_of_orders);
+   detail::sph_bessel_array_imp(v, static_cast<value_type>(x), f, forwarding_policy());
+   return detail::bessel_array_copy<result_type>(f, out_it, "boost::math::sph_bessel_array<%1%>(%1%,%1%)", pol);
+}
+
+template <class T, class OutputIterator>
+inline OutputIterator sph_bessel_array(unsigned v, unsigned number_of_orders, T x, OutputIterator out_it)
+{
+   return sph_bessel_array(v, number_of_orders, x, out_it, policies::policy<>());
+}
+
+template <class T, class OutputIterator, class Policy>
+inline OutputIterator sph_neumann_array(unsigned v, unsigned number_of_orders, T x, OutputIterator out_it, const Policy& pol)
+{
+   BOOST_FPU_EXCEPTION_GUARD
+   typedef typename detail::bessel_traits<T, T, Policy>::result_type result_type;
+   typedef typename policies::evaluation<result_type, Policy>::type value_type;
+   typedef typename policies::normalise<
+      Policy,
+      policies::promote_float<false>,
+      policies::promote_double<false>,
+      policies::discrete_quantile<>,
+      policies::assert_undefined<> >::type forwarding_policy;
+   std::vector<value_type> f(number_of_orders);
+   detail::sph_neumann_array_imp(v, static_cast<value_type>(x), f, forwarding_policy());
+   return detail::bessel_array_copy<result_type>(f, out_it, "boost::math::sph_neumann_array<%1%>(%1%,%1%)", pol);
+}
+
+template <class T, class OutputIterator>
+inline OutputIterator sph_neumann_array(unsigned v, unsigned number_of_orders, T x, OutputIterator out_it)
+{
+   return sph_neumann_array(v, number_of_orders, x, out_it, policies::policy<>());
+}
+
+#if !defined(BOOST_NO_CXX17_HDR_EXECUTION) && !defined(BOOST_NO_CXX17_IF_CONSTEXPR)
+//
+// Many arguments at once: row i of the number_of_points by number_of_orders row-major
+// matrix out holds the orders v, v+1, ... at x[i].  The arguments are distributed
+// across the execution policy; each row is computed by the single argument function.
+//
+namespace detail{
+
+template <class ExecutionPolicy, class T, class F>
+void bessel_array_over_points(ExecutionPolicy&& exec, unsigned number_of_orders, const T* x, std::size_t number_of_points, T* out, F f)
+{
+   std::vector<std::size_t> rows(number_of_points);
+   std::iota(rows.begin(), rows.end(), std::size_t(0));
+   std::for_each(exec, rows.begin(), rows.end(), [&](std::size_t i)
+   {
+      f(x[i], out + i * number_of_orders);
+   });
+}
+
+} // namespace detail
+
+template <class ExecutionPolicy, class T, class = typename std::enable_if<std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value>::type>
+void cyl_bessel_j_array(ExecutionPolicy&& exec, T v, unsigned number_of_orders, const T* x, std::size_t number_of_points, T* out)
+{
+   detail::bessel_array_over_points(exec, number_of_orders, x, number_of_points, out, [&](T z, T* row) { cyl_bessel_j_array(v, number_of_orders, z, row); });
+}
+
+template <class ExecutionPolicy, class T, class = typename std::enable_if<std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value>::type>
+void cyl_neumann_array(ExecutionPolicy&& exec, T v, unsigned number_of_orders, const T* x, std::size_t number_of_points, T* out)
+{
+   detail::bessel_array_over_points(exec, number_of_orders, x, number_of_points, out, [&](T z, T* row) { cyl_neumann_array(v, number_of_orders, z, row); });
+}
+
+template <class ExecutionPolicy, class T, class = typename std::enable_if<std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value>::type>
+void cyl_bessel_i_array(ExecutionPolicy&& exec, T v, unsigned number_of_orders, const T* x, std::size_t number_of_points, T* out)
+{
+   detail::bessel_array_over_points(exec, number_of_orders, x, number_of_points, out, [&](T z, T* row) { cyl_bessel_i_array(v, number_of_orders, z, row); });
+}
+
+template <class ExecutionPolicy, class T, class = typename std::enable_if<std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value>::type>
+void cyl_bessel_k_array(ExecutionPolicy&& exec, T v, unsigned number_of_orders, const T* x, std::size_t number_of_points, T* out)
+{
+   detail::bessel_array_over_points(exec, number_of_orders, x, number_of_points, out, [&](T z, T* row) { cyl_bessel_k_array(v, number_of_orders, z, row); });
+}
+
+template <class ExecutionPolicy, class T, class = typename std::enable_if<std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value>::type>
+void sph_bessel_array(ExecutionPolicy&& exec, unsigned v, unsigned number_of_orders, const T* x, std::size_t number_of_points, T* out)
+{
+   detail::bessel_array_over_points(exec, number_of_orders, x, number_of_points, out, [&](T z, T* row) { sph_bessel_array(v, number_of_orders, z, row); });
+}
+
+template <class ExecutionPolicy, class T, class = typename std::enable_if<std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value>::type>
+void sph_neumann_array(ExecutionPolicy&& exec, unsigned v, unsigned number_of_orders, const T* x, std::size_t number_of_points, T* out)
+{
+   detail::bessel_array_over_points(exec, number_of_orders, x, number_of_points, out, [&](T z, T* row) { sph_neumann_array(v, number_of_orders, z, row); });
+}
+#endif
+
+}} // namespaces
+
+#endif // BOOST_MATH_BESSEL_ARRAY_HPP
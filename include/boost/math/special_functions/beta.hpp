@@ -192,6 +192,54 @@ T beta_imp(T a, T b, const lanczos::undefined_lanczos& l, const Policy& pol)
 } // template <class T>T beta_imp(T a, T b, const lanczos::undefined_lanczos& l)
 
 
+//
+// The ratio of gamma functions that normalises the power terms of the
+// incomplete beta depends on a and b alone, so incomplete_beta_evaluator
+// computes it once for many x.  It's symmetric in a and b, and is used
+// whichever way round ibeta_imp has swapped them.  Each value is computed
+// with exactly the expression used where it's consumed, so that cached
+// and uncached evaluations give the same bits:
+//
+template <class T>
+struct ibeta_parameter_cache
+{
+   template <class Policy, class Lanczos>
+   ibeta_parameter_cache(T a_, T b_, const Policy&, const Lanczos&)
+      : a(a_), b(b_), lanczos_ratio(0), scaled_gamma_c(0), scaled_gamma_ab(0), has_lanczos_ratio(false), has_scaled_gamma(false)
+   {
+      if((a > 0) && (b > 0) && (boost::math::isfinite)(a) && (boost::math::isfinite)(b))
+      {
+         T c = a + b;
+         lanczos_ratio = Lanczos::lanczos_sum_expG_scaled(c) / (Lanczos::lanczos_sum_expG_scaled(a) * Lanczos::lanczos_sum_expG_scaled(b));
+         has_lanczos_ratio = true;
+      }
+   }
+   template <class Policy>
+   ibeta_parameter_cache(T a_, T b_, const Policy& pol, const boost::math::lanczos::undefined_lanczos&)
+      : a(a_), b(b_), lanczos_ratio(0), scaled_gamma_c(0), scaled_gamma_ab(0), has_lanczos_ratio(false), has_scaled_gamma(false)
+   {
+      const T min_sterling = minimum_argument_for_bernoulli_recursion<T>();
+      if((a >= min_sterling) && (b >= min_sterling) && (boost::math::isfinite)(a) && (boost::math::isfinite)(b))
+      {
+         T c = a + b;
+         scaled_gamma_c = scaled_tgamma_no_lanczos(c, pol);
+         scaled_gamma_ab = scaled_tgamma_no_lanczos(a, pol) * scaled_tgamma_no_lanczos(b, pol);
+         has_scaled_gamma = true;
+      }
+   }
+   bool matches(T x, T y)const
+   {
+      return ((x == a) && (y == b)) || ((x == b) && (y == a));
+   }
+
+   T a, b;
+   T lanczos_ratio;    // L(a+b) / (L(a) * L(b)).
+   T scaled_gamma_c;   // Scaled gamma at a + b, and the product of those at a and b.
+   T scaled_gamma_ab;
+   bool has_lanczos_ratio, has_scaled_gamma;
+};
+
+
 //
 // Compute the leading power terms in the incomplete Beta:
 //
@@ -212,7 +260,8 @@ T ibeta_power_terms(T a,
                         bool normalised,
                         const Policy& pol,
                         T prefix = 1,
-                        const char* function = "boost::math::ibeta<%1%>(%1%, %1%, %1%)")
+                        const char* function = "boost::math::ibeta<%1%>(%1%, %1%, %1%)",
+                        const ibeta_parameter_cache<T>* cache = 0)
 {
    BOOST_MATH_STD_USING
 
@@ -230,7 +279,10 @@ T ibeta_power_terms(T a,
    T agh = static_cast<T>(a + Lanczos::g() - 0.5f);
    T bgh = static_cast<T>(b + Lanczos::g() - 0.5f);
    T cgh = static_cast<T>(c + Lanczos::g() - 0.5f);
-   result = Lanczos::lanczos_sum_expG_scaled(c) / (Lanczos::lanczos_sum_expG_scaled(a) * Lanczos::lanczos_sum_expG_scaled(b));
+   if(cache && cache->has_lanczos_ratio && cache->matches(a, b))
+      result = cache->lanczos_ratio;
+   else
+      result = Lanczos::lanczos_sum_expG_scaled(c) / (Lanczos::lanczos_sum_expG_scaled(a) * Lanczos::lanczos_sum_expG_scaled(b));
    result *= prefix;
    // combine with the leftover terms from the Lanczos approximation:
    result *= sqrt(bgh / boost::math::constants::e<T>());
@@ -440,7 +492,8 @@ T ibeta_power_terms(T a,
                         bool normalised,
                         const Policy& pol,
                         T prefix = 1,
-                        const char* = "boost::math::ibeta<%1%>(%1%, %1%, %1%)")
+                        const char* = "boost::math::ibeta<%1%>(%1%, %1%, %1%)",
+                        const ibeta_parameter_cache<T>* cache = 0)
 {
    BOOST_MATH_STD_USING
 
@@ -474,11 +527,16 @@ T ibeta_power_terms(T a,
          power1 = pow((x * y * c * c) / (a * b), b);
          power2 = pow((x * c) / a, a - b);
       }
+      bool cached = cache && cache->has_scaled_gamma && cache->matches(a, b);
       if (!(boost::math::isnormal)(power1) || !(boost::math::isnormal)(power2))
       {
          // We have to use logs :(
+         if (cached)
+            return prefix * exp(a * log(x * c / a) + b * log(y * c / b)) * cache->scaled_gamma_c / cache->scaled_gamma_ab;
          return prefix * exp(a * log(x * c / a) + b * log(y * c / b)) * scaled_tgamma_no_lanczos(c, pol) / (scaled_tgamma_no_lanczos(a, pol) * scaled_tgamma_no_lanczos(b, pol));
       }
+      if (cached)
+         return prefix * power1 * power2 * cache->scaled_gamma_c / cache->scaled_gamma_ab;
       return prefix * power1 * power2 * scaled_tgamma_no_lanczos(c, pol) / (scaled_tgamma_no_lanczos(a, pol) * scaled_tgamma_no_lanczos(b, pol));
    }
 
@@ -543,7 +601,7 @@ private:
 };
 
 template <class T, class Lanczos, class Policy>
-T ibeta_series(T a, T b, T x, T s0, const Lanczos&, bool normalised, T* p_derivative, T y, const Policy& pol)
+T ibeta_series(T a, T b, T x, T s0, const Lanczos&, bool normalised, T* p_derivative, T y, const Policy& pol, const ibeta_parameter_cache<T>* cache = 0)
 {
    BOOST_MATH_STD_USING
 
@@ -559,7 +617,10 @@ T ibeta_series(T a, T b, T x, T s0, const Lanczos&, bool normalised, T* p_deriva
       T agh = static_cast<T>(a + Lanczos::g() - 0.5f);
       T bgh = static_cast<T>(b + Lanczos::g() - 0.5f);
       T cgh = static_cast<T>(c + Lanczos::g() - 0.5f);
-      result = Lanczos::lanczos_sum_expG_scaled(c) / (Lanczos::lanczos_sum_expG_scaled(a) * Lanczos::lanczos_sum_expG_scaled(b));
+      if(cache && cache->has_lanczos_ratio && cache->matches(a, b))
+         result = cache->lanczos_ratio;
+      else
+         result = Lanczos::lanczos_sum_expG_scaled(c) / (Lanczos::lanczos_sum_expG_scaled(a) * Lanczos::lanczos_sum_expG_scaled(b));
 
       T l1 = log(cgh / bgh) * (b - 0.5f);
       T l2 = log(x * cgh / agh) * a;
@@ -612,7 +673,7 @@ T ibeta_series(T a, T b, T x, T s0, const Lanczos&, bool normalised, T* p_deriva
 // Incomplete Beta series again, this time without Lanczos support:
 //
 template <class T, class Policy>
-T ibeta_series(T a, T b, T x, T s0, const boost::math::lanczos::undefined_lanczos& l, bool normalised, T* p_derivative, T y, const Policy& pol)
+T ibeta_series(T a, T b, T x, T s0, const boost::math::lanczos::undefined_lanczos& l, bool normalised, T* p_derivative, T y, const Policy& pol, const ibeta_parameter_cache<T>* cache = 0)
 {
    BOOST_MATH_STD_USING
 
@@ -635,7 +696,10 @@ T ibeta_series(T a, T b, T x, T s0, const boost::math::lanczos::undefined_lanczo
 
       if ((shift_a == 0) && (shift_b == 0))
       {
-         result = pow(x * c / a, a) * pow(c / b, b) * scaled_tgamma_no_lanczos(c, pol) / (scaled_tgamma_no_lanczos(a, pol) * scaled_tgamma_no_lanczos(b, pol));
+         if (cache && cache->has_scaled_gamma && cache->matches(a, b))
+            result = pow(x * c / a, a) * pow(c / b, b) * cache->scaled_gamma_c / cache->scaled_gamma_ab;
+         else
+            result = pow(x * c / a, a) * pow(c / b, b) * scaled_tgamma_no_lanczos(c, pol) / (scaled_tgamma_no_lanczos(a, pol) * scaled_tgamma_no_lanczos(b, pol));
       }
       else if ((a < 1) && (b > 1))
          result = pow(x, a) / (boost::math::tgamma(a, pol) * boost::math::tgamma_delta_ratio(b, a, pol));
@@ -703,11 +767,11 @@ private:
 // Evaluate the incomplete beta via the continued fraction representation:
 //
 template <class T, class Policy>
-inline T ibeta_fraction2(T a, T b, T x, T y, const Policy& pol, bool normalised, T* p_derivative)
+inline T ibeta_fraction2(T a, T b, T x, T y, const Policy& pol, bool normalised, T* p_derivative, const ibeta_parameter_cache<T>* cache = 0)
 {
    typedef typename lanczos::lanczos<T, Policy>::type lanczos_type;
    BOOST_MATH_STD_USING
-   T result = ibeta_power_terms(a, b, x, y, lanczos_type(), normalised, pol);
+   T result = ibeta_power_terms(a, b, x, y, lanczos_type(), normalised, pol, T(1), "boost::math::ibeta<%1%>(%1%, %1%, %1%)", cache);
    if(p_derivative)
    {
       *p_derivative = result;
@@ -726,13 +790,13 @@ inline T ibeta_fraction2(T a, T b, T x, T y, const Policy& pol, bool normalised,
 // Computes the difference between ibeta(a,b,x) and ibeta(a+k,b,x):
 //
 template <class T, class Policy>
-T ibeta_a_step(T a, T b, T x, T y, int k, const Policy& pol, bool normalised, T* p_derivative)
+T ibeta_a_step(T a, T b, T x, T y, int k, const Policy& pol, bool normalised, T* p_derivative, const ibeta_parameter_cache<T>* cache = 0)
 {
    typedef typename lanczos::lanczos<T, Policy>::type lanczos_type;
 
    BOOST_MATH_INSTRUMENT_VARIABLE(k);
 
-   T prefix = ibeta_power_terms(a, b, x, y, lanczos_type(), normalised, pol);
+   T prefix = ibeta_power_terms(a, b, x, y, lanczos_type(), normalised, pol, T(1), "boost::math::ibeta<%1%>(%1%, %1%, %1%)", cache);
    if(p_derivative)
    {
       *p_derivative = prefix;
@@ -990,7 +1054,7 @@ T binomial_ccdf(T n, T k, T x, T y, const Policy& pol)
 // each domain:
 //
 template <class T, class Policy>
-T ibeta_imp(T a, T b, T x, const Policy& pol, bool inv, bool normalised, T* p_derivative)
+T ibeta_imp(T a, T b, T x, const Policy& pol, bool inv, bool normalised, T* p_derivative, const ibeta_parameter_cache<T>* cache = 0)
 {
    static const char* function = "boost::math::ibeta<%1%>(%1%, %1%, %1%)";
    typedef typename lanczos::lanczos<T, Policy>::type lanczos_type;
@@ -1118,14 +1182,14 @@ T ibeta_imp(T a, T b, T x, const Policy& pol, bool inv, bool normalised, T* p_de
          {
             if(!invert)
             {
-               fract = ibeta_series(a, b, x, T(0), lanczos_type(), normalised, p_derivative, y, pol);
+               fract = ibeta_series(a, b, x, T(0), lanczos_type(), normalised, p_derivative, y, pol, cache);
                BOOST_MATH_INSTRUMENT_VARIABLE(fract);
             }
             else
             {
                fract = -(normalised ? 1 : boost::math::beta(a, b, pol));
                invert = false;
-               fract = -ibeta_series(a, b, x, fract, lanczos_type(), normalised, p_derivative, y, pol);
+               fract = -ibeta_series(a, b, x, fract, lanczos_type(), normalised, p_derivative, y, pol, cache);
                BOOST_MATH_INSTRUMENT_VARIABLE(fract);
             }
          }
@@ -1138,14 +1202,14 @@ T ibeta_imp(T a, T b, T x, const Policy& pol, bool inv, bool normalised, T* p_de
             {
                if(!invert)
                {
-                  fract = ibeta_series(a, b, x, T(0), lanczos_type(), normalised, p_derivative, y, pol);
+                  fract = ibeta_series(a, b, x, T(0), lanczos_type(), normalised, p_derivative, y, pol, cache);
                   BOOST_MATH_INSTRUMENT_VARIABLE(fract);
                }
                else
                {
                   fract = -(normalised ? 1 : boost::math::beta(a, b, pol));
                   invert = false;
-                  fract = -ibeta_series(a, b, x, fract, lanczos_type(), normalised, p_derivative, y, pol);
+                  fract = -ibeta_series(a, b, x, fract, lanczos_type(), normalised, p_derivative, y, pol, cache);
                   BOOST_MATH_INSTRUMENT_VARIABLE(fract);
                }
             }
@@ -1161,7 +1225,7 @@ T ibeta_imp(T a, T b, T x, const Policy& pol, bool inv, bool normalised, T* p_de
                {
                   prefix = 1;
                }
-               fract = ibeta_a_step(a, b, x, y, 20, pol, normalised, p_derivative);
+               fract = ibeta_a_step(a, b, x, y, 20, pol, normalised, p_derivative, cache);
                if(!invert)
                {
                   fract = beta_small_b_large_a_series(T(a + 20), b, x, y, fract, prefix, pol, normalised);
@@ -1184,14 +1248,14 @@ T ibeta_imp(T a, T b, T x, const Policy& pol, bool inv, bool normalised, T* p_de
          {
             if(!invert)
             {
-               fract = ibeta_series(a, b, x, T(0), lanczos_type(), normalised, p_derivative, y, pol);
+               fract = ibeta_series(a, b, x, T(0), lanczos_type(), normalised, p_derivative, y, pol, cache);
                BOOST_MATH_INSTRUMENT_VARIABLE(fract);
             }
             else
             {
                fract = -(normalised ? 1 : boost::math::beta(a, b, pol));
                invert = false;
-               fract = -ibeta_series(a, b, x, fract, lanczos_type(), normalised, p_derivative, y, pol);
+               fract = -ibeta_series(a, b, x, fract, lanczos_type(), normalised, p_derivative, y, pol, cache);
                BOOST_MATH_INSTRUMENT_VARIABLE(fract);
             }
          }
@@ -1205,14 +1269,14 @@ T ibeta_imp(T a, T b, T x, const Policy& pol, bool inv, bool normalised, T* p_de
             {
                if(!invert)
                {
-                  fract = ibeta_series(a, b, x, T(0), lanczos_type(), normalised, p_derivative, y, pol);
+                  fract = ibeta_series(a, b, x, T(0), lanczos_type(), normalised, p_derivative, y, pol, cache);
                   BOOST_MATH_INSTRUMENT_VARIABLE(fract);
                }
                else
                {
                   fract = -(normalised ? 1 : boost::math::beta(a, b, pol));
                   invert = false;
-                  fract = -ibeta_series(a, b, x, fract, lanczos_type(), normalised, p_derivative, y, pol);
+                  fract = -ibeta_series(a, b, x, fract, lanczos_type(), normalised, p_derivative, y, pol, cache);
                   BOOST_MATH_INSTRUMENT_VARIABLE(fract);
                }
             }
@@ -1243,7 +1307,7 @@ T ibeta_imp(T a, T b, T x, const Policy& pol, bool inv, bool normalised, T* p_de
                {
                   prefix = 1;
                }
-               fract = ibeta_a_step(a, b, x, y, 20, pol, normalised, p_derivative);
+               fract = ibeta_a_step(a, b, x, y, 20, pol, normalised, p_derivative, cache);
                BOOST_MATH_INSTRUMENT_VARIABLE(fract);
                if(!invert)
                {
@@ -1297,14 +1361,14 @@ T ibeta_imp(T a, T b, T x, const Policy& pol, bool inv, bool normalised, T* p_de
          {
             if(!invert)
             {
-               fract = ibeta_series(a, b, x, T(0), lanczos_type(), normalised, p_derivative, y, pol);
+               fract = ibeta_series(a, b, x, T(0), lanczos_type(), normalised, p_derivative, y, pol, cache);
                BOOST_MATH_INSTRUMENT_VARIABLE(fract);
             }
             else
             {
                fract = -(normalised ? 1 : boost::math::beta(a, b, pol));
                invert = false;
-               fract = -ibeta_series(a, b, x, fract, lanczos_type(), normalised, p_derivative, y, pol);
+               fract = -ibeta_series(a, b, x, fract, lanczos_type(), normalised, p_derivative, y, pol, cache);
                BOOST_MATH_INSTRUMENT_VARIABLE(fract);
             }
          }
@@ -1355,13 +1419,13 @@ T ibeta_imp(T a, T b, T x, const Policy& pol, bool inv, bool normalised, T* p_de
          }
          else
          {
-            fract = ibeta_fraction2(a, b, x, y, pol, normalised, p_derivative);
+            fract = ibeta_fraction2(a, b, x, y, pol, normalised, p_derivative, cache);
             BOOST_MATH_INSTRUMENT_VARIABLE(fract);
          }
       }
       else
       {
-         fract = ibeta_fraction2(a, b, x, y, pol, normalised, p_derivative);
+         fract = ibeta_fraction2(a, b, x, y, pol, normalised, p_derivative, cache);
          BOOST_MATH_INSTRUMENT_VARIABLE(fract);
       }
    }
@@ -1369,7 +1433,7 @@ T ibeta_imp(T a, T b, T x, const Policy& pol, bool inv, bool normalised, T* p_de
    {
       if(*p_derivative < 0)
       {
-         *p_derivative = ibeta_power_terms(a, b, x, y, lanczos_type(), true, pol);
+         *p_derivative = ibeta_power_terms(a, b, x, y, lanczos_type(), true, pol, T(1), "boost::math::ibeta<%1%>(%1%, %1%, %1%)", cache);
       }
       T div = y * x;
 
@@ -14,9 +14,61 @@
 #include <boost/math/special_functions/factorials.hpp>
 #include <boost/math/special_functions/beta.hpp>
 #include <boost/math/policies/error_handling.hpp>
+#include <algorithm>
+#include <vector>
 
 namespace boost{ namespace math{
 
+namespace detail{
+//
+// Runs the recurrence C(n, j+1) = C(n, j) (n - j) / (j + 1) from C(n, 0) = 1 for as
+// long as it is exact, to at most j = k.  Each product is then an integer less than
+// 2^digits, and the division is exact too.  Returns the last j reached, with *result
+// set to C(n, j), and C(n, 0), ..., C(n, j) appended to *terms if it is non-null:
+//
+template <class T>
+unsigned binomial_coefficient_exact(unsigned n, unsigned k, T* result, std::vector<T>* terms = 0)
+{
+   BOOST_MATH_STD_USING
+   const T limit = ldexp(T(1), tools::digits<T>());
+   T c = 1;
+   unsigned j = 0;
+   if(terms)
+      terms->push_back(c);
+   while(j < k)
+   {
+      T product = c * (n - j);
+      if(product >= limit)
+         break;
+      c = product / (j + 1);
+      ++j;
+      if(terms)
+         terms->push_back(c);
+   }
+   *result = c;
+   return j;
+}
+//
+// C(n, k) for n beyond the table of factorials, from the beta function:
+//
+template <class T, class Policy>
+T binomial_coefficient_beta(unsigned n, unsigned k, const char* function, const Policy& pol)
+{
+   BOOST_MATH_STD_USING
+   T result;
+   if(k < n - k)
+      result = k * boost::math::beta(static_cast<T>(k), static_cast<T>(n-k+1), pol);
+   else
+      result = (n - k) * boost::math::beta(static_cast<T>(k+1), static_cast<T>(n-k), pol);
+   if(result == 0)
+      return policies::raise_overflow_error<T>(function, 0, pol);
+   result = 1 / result;
+   // convert to nearest integer:
+   return ceil(result - 0.5f);
+}
+
+} // namespace detail
+
 template <class T, class Policy>
 T binomial_coefficient(unsigned n, unsigned k, const Policy& pol)
 {
@@ -40,20 +92,15 @@ T binomial_coefficient(unsigned n, unsigned k, const Policy& pol)
       result = unchecked_factorial<T>(n);
       result /= unchecked_factorial<T>(n-k);
       result /= unchecked_factorial<T>(k);
+      // convert to nearest integer:
+      return ceil(result - 0.5f);
    }
-   else
-   {
-      // Use the beta function:
-      if(k < n - k)
-         result = k * beta(static_cast<T>(k), static_cast<T>(n-k+1), pol);
-      else
-         result = (n - k) * beta(static_cast<T>(k+1), static_cast<T>(n-k), pol);
-      if(result == 0)
-         return policies::raise_overflow_error<T>(function, 0, pol);
-      result = 1 / result;
-   }
-   // convert to nearest integer:
-   return ceil(result - 0.5f);
+   // Use exact integer arithmetic while the result is small enough,
+   // otherwise the beta function:
+   unsigned m = (std::min)(k, n - k);
+   if(detail::binomial_coefficient_exact(n, m, &result) == m)
+      return result;
+   return detail::binomial_coefficient_beta<T>(n, k, function, pol);
 }
 //
 // Type float can only store the first 35 factorials, in order to
@@ -78,6 +125,64 @@ inline T binomial_coefficient(unsigned n, unsigned k)
    return binomial_coefficient<T>(n, k, policies::policy<>());
 }
 
+namespace detail{
+
+template <class T, class OutputIterator, class Policy>
+OutputIterator binomial_coefficient_row_imp(unsigned n, OutputIterator out, const Policy& pol, const T*)
+{
+   static const char* function = "boost::math::binomial_coefficient_row<%1%>(unsigned, OutputIterator)";
+   if(n <= max_factorial<T>::value)
+   {
+      for(unsigned k = 0; k <= n; ++k)
+         *out++ = binomial_coefficient<T>(n, k, pol);
+      return out;
+   }
+   //
+   // C(n, 0), ..., C(n, n/2) by the exact recurrence for as long as it stays exact,
+   // and the rest of the row by symmetry.  Beyond that each comes from the beta
+   // function, as it would from binomial_coefficient:
+   //
+   std::vector<T> exact;
+   T c;
+   detail::binomial_coefficient_exact(n, n / 2, &c, &exact);
+   for(unsigned k = 0; k <= n; ++k)
+   {
+      unsigned m = (std::min)(k, n - k);
+      if(m < exact.size())
+         *out++ = exact[m];
+      else if(m == 1)
+         *out++ = static_cast<T>(n);
+      else
+         *out++ = binomial_coefficient_beta<T>(n, k, function, pol);
+   }
+   return out;
+}
+//
+// Type float promotes to double, as binomial_coefficient does:
+//
+template <class OutputIterator>
+OutputIterator binomial_coefficient_row_imp(unsigned n, OutputIterator out, const policies::policy<>& pol, const float*)
+{
+   for(unsigned k = 0; k <= n; ++k)
+      *out++ = binomial_coefficient<float>(n, k, pol);
+   return out;
+}
+
+} // namespace detail
+
+template <class T, class OutputIterator, class Policy>
+inline OutputIterator binomial_coefficient_row(unsigned n, OutputIterator out, const Policy& pol)
+{
+   BOOST_STATIC_ASSERT(!boost::is_integral<T>::value);
+   return detail::binomial_coefficient_row_imp(n, out, pol, static_cast<const T*>(0));
+}
+
+template <class T, class OutputIterator>
+inline OutputIterator binomial_coefficient_row(unsigned n, OutputIterator out)
+{
+   return binomial_coefficient_row<T>(n, out, policies::policy<>());
+}
+
 } // namespace math
 } // namespace boost
 
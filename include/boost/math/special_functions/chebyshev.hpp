@@ -6,10 +6,14 @@
 #ifndef BOOST_MATH_SPECIAL_CHEBYSHEV_HPP
 #define BOOST_MATH_SPECIAL_CHEBYSHEV_HPP
 #include <cmath>
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
 #include <boost/math/special_functions/math_fwd.hpp>
 #include <boost/math/policies/error_handling.hpp>
 #include <boost/math/constants/constants.hpp>
 #include <boost/math/tools/promotion.hpp>
+#include <boost/utility/enable_if.hpp>
 
 #if (__cplusplus > 201103) || (defined(_CPPLIB_VER) && (_CPPLIB_VER >= 610))
 #  define BOOST_MATH_CHEB_USE_STD_ACOSH
@@ -158,6 +162,102 @@ inline typename tools::promote_args<Real>::type chebyshev_t_prime(unsigned n, Re
    return chebyshev_t_prime(n, x, policies::policy<>());
 }
 
+namespace detail {
+
+template<class Real, bool second, class OutputIterator, class Policy>
+OutputIterator chebyshev_array_imp(unsigned n, Real const & x, OutputIterator out_it, const Policy&, const char* function)
+{
+    typedef typename tools::promote_args<Real>::type result_type;
+    typedef typename policies::evaluation<result_type, Policy>::type value_type;
+    value_type z = static_cast<value_type>(x);
+    value_type T0 = 1;
+    value_type T1 = second ? 2*z : z;
+    *out_it++ = policies::checked_narrowing_cast<result_type, Policy>(T0, function);
+    if (n == 0)
+    {
+        return out_it;
+    }
+    *out_it++ = policies::checked_narrowing_cast<result_type, Policy>(T1, function);
+    for (unsigned l = 1; l < n; ++l)
+    {
+        std::swap(T0, T1);
+        T1 = boost::math::chebyshev_next(z, T0, T1);
+        *out_it++ = policies::checked_narrowing_cast<result_type, Policy>(T1, function);
+    }
+    return out_it;
+}
+
+template<class Real, bool second>
+void chebyshev_array_imp(unsigned n, const Real* x, size_t number_of_points, Real* out)
+{
+    for (size_t i = 0; i < number_of_points; ++i)
+    {
+        out[i] = 1;
+    }
+    if (n == 0)
+    {
+        return;
+    }
+    for (size_t i = 0; i < number_of_points; ++i)
+    {
+        out[number_of_points + i] = second ? 2*x[i] : x[i];
+    }
+    for (unsigned l = 1; l < n; ++l)
+    {
+        const Real* T0 = out + (l - 1)*number_of_points;
+        const Real* T1 = out + l*number_of_points;
+        Real* T2 = out + (l + 1)*number_of_points;
+        for (size_t i = 0; i < number_of_points; ++i)
+        {
+            T2[i] = 2*x[i]*T1[i] - T0[i];
+        }
+    }
+}
+
+} // namespace detail
+
+// All the degrees 0, 1, ..., n at once.  The three term recurrence is used for every x, including |x| > 1,
+// where it is stable but where chebyshev_t and chebyshev_u use closed forms instead.
+template<class Real, class OutputIterator, class Policy>
+inline typename boost::enable_if_c<policies::is_policy<Policy>::value, OutputIterator>::type
+chebyshev_t_array(unsigned n, Real const & x, OutputIterator out_it, const Policy& pol)
+{
+    return detail::chebyshev_array_imp<Real, false>(n, x, out_it, pol, "boost::math::chebyshev_t_array<%1%>(unsigned, %1%)");
+}
+
+template<class Real, class OutputIterator>
+inline OutputIterator chebyshev_t_array(unsigned n, Real const & x, OutputIterator out_it)
+{
+    return chebyshev_t_array(n, x, out_it, policies::policy<>());
+}
+
+template<class Real, class OutputIterator, class Policy>
+inline typename boost::enable_if_c<policies::is_policy<Policy>::value, OutputIterator>::type
+chebyshev_u_array(unsigned n, Real const & x, OutputIterator out_it, const Policy& pol)
+{
+    return detail::chebyshev_array_imp<Real, true>(n, x, out_it, pol, "boost::math::chebyshev_u_array<%1%>(unsigned, %1%)");
+}
+
+template<class Real, class OutputIterator>
+inline OutputIterator chebyshev_u_array(unsigned n, Real const & x, OutputIterator out_it)
+{
+    return chebyshev_u_array(n, x, out_it, policies::policy<>());
+}
+
+// Many points at once: T_k(x[i]) is written to out[k*number_of_points + i] for k = 0, ..., n,
+// so that the inner loop runs over contiguous points and vectorizes.  No checking is performed.
+template<class Real>
+inline void chebyshev_t_array(unsigned n, const Real* x, size_t number_of_points, Real* out)
+{
+    detail::chebyshev_array_imp<Real, false>(n, x, number_of_points, out);
+}
+
+template<class Real>
+inline void chebyshev_u_array(unsigned n, const Real* x, size_t number_of_points, Real* out)
+{
+    detail::chebyshev_array_imp<Real, true>(n, x, number_of_points, out);
+}
+
 /*
  * This is Algorithm 3.1 of
  * Gil, Amparo, Javier Segura, and Nico M. Temme.
@@ -284,6 +384,133 @@ inline Real chebyshev_clenshaw_recurrence(const Real* const c, size_t length, co
     return detail::unchecked_chebyshev_clenshaw_recurrence(c, length, a, b, x);
 }
 
+namespace detail {
+
+// The same reduction of x to [-1, 1] as used by unchecked_chebyshev_clenshaw_recurrence:
+template<class Real>
+inline void chebyshev_clenshaw_reduce(const Real & a, const Real & b, const Real & x, Real & u, Real & t)
+{
+    if (x - a < b - x)
+    {
+        u = 2*(x-a)/(b-a);
+        t = u - 1;
+    }
+    else
+    {
+        u = -2*(b-x)/(b-a);
+        t = u + 1;
+    }
+}
+
+// Evaluates the series at the points x[idx[i]] with a fixed recurrence for each of `lanes` points at once.
+// The points of a block advance through the coefficients together, so the inner loop has no branches and vectorizes.
+// If sign == 0, this is the Clenshaw recurrence in t; otherwise it is Reinsch's modification about t = -sign.
+template<class Real, class RandomAccessIterator1, class RandomAccessIterator2>
+void chebyshev_clenshaw_block(const Real* const c, size_t length, const Real & a, const Real & b, int sign,
+                              RandomAccessIterator1 x, std::vector<size_t> const & idx, RandomAccessIterator2 out)
+{
+    const size_t lanes = 8;
+    Real t[lanes];
+    Real u[lanes];
+    Real b1[lanes];
+    Real b2[lanes];
+    Real d[lanes];
+    for (size_t i = 0; i < idx.size(); i += lanes)
+    {
+        size_t active = (std::min)(lanes, idx.size() - i);
+        for (size_t l = 0; l < lanes; ++l)
+        {
+            Real xl = l < active ? Real(x[idx[i + l]]) : a;
+            chebyshev_clenshaw_reduce(a, b, xl, u[l], t[l]);
+            b1[l] = c[length - 1];
+            b2[l] = 0;
+            d[l] = c[length - 1];
+        }
+        if (sign == 0)
+        {
+            for (size_t j = length - 2; j >= 1; --j)
+            {
+                for (size_t l = 0; l < lanes; ++l)
+                {
+                    Real tmp = 2*t[l]*b1[l] - b2[l] + c[j];
+                    b2[l] = b1[l];
+                    b1[l] = tmp;
+                }
+            }
+        }
+        else
+        {
+            const Real s = static_cast<Real>(sign);
+            for (size_t j = length - 2; j >= 1; --j)
+            {
+                for (size_t l = 0; l < lanes; ++l)
+                {
+                    d[l] = 2*u[l]*b1[l] - s*d[l] + c[j];
+                    b2[l] = b1[l];
+                    b1[l] = d[l] - s*b1[l];
+                }
+            }
+        }
+        for (size_t l = 0; l < active; ++l)
+        {
+            out[idx[i + l]] = t[l]*b1[l] - b2[l] + c[0]/2;
+        }
+    }
+}
+
+} // namespace detail
+
+// Evaluates the series at every point of [first, last) and writes the results to out.
+// The points are first bucketed by the recurrence that is stable for them, as in the scalar version,
+// then each bucket is evaluated several points at a time.
+template<class Real, class RandomAccessIterator1, class RandomAccessIterator2>
+void chebyshev_clenshaw_recurrence(const Real* const c, size_t length, const Real & a, const Real & b,
+                                   RandomAccessIterator1 first, RandomAccessIterator1 last, RandomAccessIterator2 out)
+{
+    size_t n = static_cast<size_t>(last - first);
+    for (size_t i = 0; i < n; ++i)
+    {
+        if (first[i] < a || first[i] > b)
+        {
+            throw std::domain_error("x in [a, b] is required.");
+        }
+    }
+    if (length < 2)
+    {
+        for (size_t i = 0; i < n; ++i)
+        {
+            out[i] = length == 0 ? Real(0) : c[0]/2;
+        }
+        return;
+    }
+    // Same cutoff as detail::unchecked_chebyshev_clenshaw_recurrence:
+    const Real cutoff = 0.6;
+    std::vector<size_t> lower;
+    std::vector<size_t> middle;
+    std::vector<size_t> upper;
+    for (size_t i = 0; i < n; ++i)
+    {
+        Real u;
+        Real t;
+        detail::chebyshev_clenshaw_reduce(a, b, Real(first[i]), u, t);
+        if (t <= -cutoff)
+        {
+            lower.push_back(i);
+        }
+        else if (t >= cutoff)
+        {
+            upper.push_back(i);
+        }
+        else
+        {
+            middle.push_back(i);
+        }
+    }
+    detail::chebyshev_clenshaw_block(c, length, a, b, 0, first, middle, out);
+    detail::chebyshev_clenshaw_block(c, length, a, b, 1, first, lower, out);
+    detail::chebyshev_clenshaw_block(c, length, a, b, -1, first, upper, out);
+}
+
 
 }}
 #endif
@@ -5,11 +5,24 @@
 
 #ifndef BOOST_MATH_SPECIAL_CHEBYSHEV_TRANSFORM_HPP
 #define BOOST_MATH_SPECIAL_CHEBYSHEV_TRANSFORM_HPP
+#include <algorithm>
 #include <cmath>
+#include <memory>
 #include <type_traits>
-#include <fftw3.h>
+#include <vector>
+#include <boost/config.hpp>
 #include <boost/math/constants/constants.hpp>
 #include <boost/math/special_functions/chebyshev.hpp>
+#include <boost/math/tools/detail/fft.hpp>
+// Define BOOST_MATH_CHEBYSHEV_TRANSFORM_USE_FFTW to use FFTW for the discrete cosine transforms.
+// Otherwise a header-only mixed-radix transform is used.
+#ifdef BOOST_MATH_CHEBYSHEV_TRANSFORM_USE_FFTW
+#include <fftw3.h>
+#endif
+
+#if !defined(BOOST_NO_CXX17_HDR_EXECUTION) && !defined(BOOST_NO_CXX17_IF_CONSTEXPR)
+#include <execution>
+#endif
 
 #ifdef BOOST_HAS_FLOAT128
 #include <quadmath.h>
@@ -19,6 +32,8 @@ namespace boost { namespace math {
 
 namespace detail{
 
+#ifdef BOOST_MATH_CHEBYSHEV_TRANSFORM_USE_FFTW
+
 template <class T>
 struct fftw_cos_transform;
 
@@ -106,6 +121,36 @@ private:
    fftwq_plan plan;
 };
 
+#endif
+
+template<class Real>
+class chebyshev_dct
+{
+public:
+   chebyshev_dct(size_t n, Real* data1, Real* data2) : m_plan(static_cast<int>(n), data1, data2) {}
+   void execute(Real* data1, Real* data2)
+   {
+      m_plan.execute(data1, data2);
+   }
+private:
+   fftw_cos_transform<Real> m_plan;
+};
+
+#else
+
+template<class Real>
+class chebyshev_dct
+{
+public:
+   chebyshev_dct(size_t n, Real*, Real*) : m_plan(boost::math::tools::detail::get_fft_plan<boost::math::tools::detail::dct_ii<Real>>(n)) {}
+   void execute(Real* data1, Real* data2)
+   {
+      m_plan->execute(data1, data2);
+   }
+private:
+   std::shared_ptr<const boost::math::tools::detail::dct_ii<Real>> m_plan;
+};
+
 #endif
 }
 
@@ -118,67 +163,45 @@ public:
        Real tol = 500 * std::numeric_limits<Real>::epsilon(),
        size_t max_refinements = 16) : m_a(a), m_b(b)
     {
-        if (a >= b)
+        auto sampler = [&f](std::vector<Real> const & x, std::vector<Real>& y)
         {
-            throw std::domain_error("a < b is required.\n");
-        }
-        using boost::math::constants::half;
-        using boost::math::constants::pi;
-        using std::cos;
-        using std::abs;
-        Real bma = (b-a)*half<Real>();
-        Real bpa = (b+a)*half<Real>();
-        size_t n = 256;
-        std::vector<Real> vf;
-
-        size_t refinements = 0;
-        while(refinements < max_refinements)
-        {
-            vf.resize(n);
-            m_coeffs.resize(n);
-
-            detail::fftw_cos_transform<Real> plan(static_cast<int>(n), vf.data(), m_coeffs.data());
-            Real inv_n = 1/static_cast<Real>(n);
-            for(size_t j = 0; j < n/2; ++j)
-            {
-                // Use symmetry cos((j+1/2)pi/n) = - cos((n-1-j+1/2)pi/n)
-                Real y = detail::fftw_cos_transform<Real>::cos(pi<Real>()*(j+half<Real>())*inv_n);
-                vf[j] = f(y*bma + bpa)*inv_n;
-                vf[n-1-j]= f(bpa-y*bma)*inv_n;
-            }
-
-            plan.execute(vf.data(), m_coeffs.data());
-            Real max_coeff = 0;
-            for (auto const & coeff : m_coeffs)
-            {
-                if (detail::fftw_cos_transform<Real>::fabs(coeff) > max_coeff)
-                {
-                    max_coeff = detail::fftw_cos_transform<Real>::fabs(coeff);
-                }
-            }
-            size_t j = m_coeffs.size() - 1;
-            while (abs(m_coeffs[j])/max_coeff < tol)
+            for (size_t i = 0; i < x.size(); ++i)
             {
-                --j;
-            }
-            // If ten coefficients are eliminated, the we say we've done all
-            // we need to do:
-            if (n - j > 10)
-            {
-                m_coeffs.resize(j+1);
-                return;
+                y[i] = f(x[i]);
             }
+        };
+        this->build(sampler, tol, max_refinements);
+    }
 
-            n *= 2;
-            ++refinements;
-        }
+#if !defined(BOOST_NO_CXX17_HDR_EXECUTION) && !defined(BOOST_NO_CXX17_IF_CONSTEXPR)
+    // Samples f in parallel; useful when f is expensive or the transform has high degree.
+    template<class ExecutionPolicy, class F,
+             typename std::enable_if<std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value, bool>::type = true>
+    chebyshev_transform(ExecutionPolicy&& exec, const F& f, Real a, Real b,
+       Real tol = 500 * std::numeric_limits<Real>::epsilon(),
+       size_t max_refinements = 16) : m_a(a), m_b(b)
+    {
+        auto sampler = [&exec, &f](std::vector<Real> const & x, std::vector<Real>& y)
+        {
+            std::transform(exec, x.begin(), x.end(), y.begin(), f);
+        };
+        this->build(sampler, tol, max_refinements);
     }
+#endif
 
     inline Real operator()(Real x) const
     {
         return chebyshev_clenshaw_recurrence(m_coeffs.data(), m_coeffs.size(), m_a, m_b, x);
     }
 
+    // Evaluates the series at every point of [first, last), writing the results to out.
+    // Much faster than repeated calls to operator() when many points are required.
+    template<class RandomAccessIterator1, class RandomAccessIterator2>
+    void operator()(RandomAccessIterator1 first, RandomAccessIterator1 last, RandomAccessIterator2 out) const
+    {
+        chebyshev_clenshaw_recurrence(m_coeffs.data(), m_coeffs.size(), m_a, m_b, first, last, out);
+    }
+
     // Integral over entire domain [a, b]
     Real integrate() const
     {
@@ -221,6 +244,116 @@ public:
     }
 
 private:
+    // The Chebyshev points of the first kind on n points are a subset of those on 3n points,
+    // so refining by a factor of three reuses every sample of f.
+    // (Doubling the grid would throw away every previous sample.)
+    template<class Sampler>
+    void build(Sampler& sampler, Real tol, size_t max_refinements)
+    {
+        if (m_a >= m_b)
+        {
+            throw std::domain_error("a < b is required.\n");
+        }
+        using boost::math::constants::half;
+        using boost::math::constants::pi;
+        using std::abs;
+        // Never use more points than the sequence 256, 512, ..., 256*2^(max_refinements-1) would have used:
+        size_t max_n = 256;
+        for (size_t i = 1; i < max_refinements && max_n < (std::numeric_limits<size_t>::max)()/6; ++i)
+        {
+            max_n *= 2;
+        }
+        Real bma = (m_b-m_a)*half<Real>();
+        Real bpa = (m_b+m_a)*half<Real>();
+
+        size_t n = 256;
+        std::vector<Real> samples(n);
+        std::vector<Real> nodes(n);
+        for(size_t j = 0; j < n; ++j)
+        {
+            nodes[j] = bpa + bma*chebyshev_node(j, n);
+        }
+        sampler(nodes, samples);
+
+        std::vector<Real> vf;
+        std::vector<Real> new_nodes;
+        std::vector<Real> new_samples;
+        while (true)
+        {
+            vf.resize(n);
+            m_coeffs.resize(n);
+            Real inv_n = 1/static_cast<Real>(n);
+            for (size_t j = 0; j < n; ++j)
+            {
+                vf[j] = samples[j]*inv_n;
+            }
+            detail::chebyshev_dct<Real> plan(n, vf.data(), m_coeffs.data());
+            plan.execute(vf.data(), m_coeffs.data());
+            Real max_coeff = 0;
+            for (auto const & coeff : m_coeffs)
+            {
+                if (abs(coeff) > max_coeff)
+                {
+                    max_coeff = abs(coeff);
+                }
+            }
+            size_t j = m_coeffs.size() - 1;
+            while (j > 0 && abs(m_coeffs[j])/max_coeff < tol)
+            {
+                --j;
+            }
+            // If ten coefficients are eliminated, the we say we've done all
+            // we need to do:
+            if (n - j > 10)
+            {
+                m_coeffs.resize(j+1);
+                return;
+            }
+            if (3*n > max_n)
+            {
+                return;
+            }
+
+            // Sample f only at the points which are new; the point (j+1/2)/n is the point (3j+1 + 1/2)/(3n).
+            size_t new_n = 3*n;
+            new_nodes.resize(2*n);
+            new_samples.resize(2*n);
+            for (size_t k = 0; k < n; ++k)
+            {
+                new_nodes[2*k] = bpa + bma*chebyshev_node(3*k, new_n);
+                new_nodes[2*k+1] = bpa + bma*chebyshev_node(3*k+2, new_n);
+            }
+            sampler(new_nodes, new_samples);
+            samples.resize(new_n);
+            for (size_t k = n; k-- > 0;)
+            {
+                samples[3*k+1] = samples[k];
+            }
+            for (size_t k = 0; k < n; ++k)
+            {
+                samples[3*k] = new_samples[2*k];
+                samples[3*k+2] = new_samples[2*k+1];
+            }
+            n = new_n;
+        }
+    }
+
+    // cos(pi*(j+1/2)/n), using cos(pi - x) = -cos(x) so that the nodes are exactly antisymmetric.
+    static Real chebyshev_node(size_t j, size_t n)
+    {
+        using boost::math::constants::pi;
+        using boost::math::constants::half;
+        if (2*j + 1 == n)
+        {
+            return 0;
+        }
+        if (2*j + 1 > n)
+        {
+            return -chebyshev_node(n - 1 - j, n);
+        }
+        return boost::math::tools::detail::fft_cos<Real>(pi<Real>()*(j+half<Real>())/static_cast<Real>(n));
+    }
+
     std::vector<Real> m_coeffs;
     Real m_a;
     Real m_b;
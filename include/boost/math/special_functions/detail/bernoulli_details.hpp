@@ -14,6 +14,11 @@
 #include <boost/math/tools/toms748_solve.hpp>
 #include <boost/math/tools/cxx03_warn.hpp>
 #include <boost/math/special_functions/fpclassify.hpp>
+#include <climits>
+#include <istream>
+#include <limits>
+#include <ostream>
+#include <string>
 #include <vector>
 
 namespace boost{ namespace math{ namespace detail{
@@ -410,8 +415,7 @@ public:
       }
       if(start + n >= bn.size())
       {
-         std::size_t new_size = (std::min)((std::max)((std::max)(std::size_t(start + n), std::size_t(bn.size() + 20)), std::size_t(50)), std::size_t(bn.capacity()));
-         tangent_numbers_series(new_size);
+         tangent_numbers_series(growth_size(start + n));
       }
 
       for(std::size_t i = (std::max)(std::size_t(max_bernoulli_b2n<T>::value + 1), start); i < start + n; ++i)
@@ -433,8 +437,7 @@ public:
       }
       if(start + n >= bn.size())
       {
-         std::size_t new_size = (std::min)((std::max)((std::max)(std::size_t(start + n), std::size_t(bn.size() + 20)), std::size_t(50)), std::size_t(bn.capacity()));
-         tangent_numbers_series(new_size);
+         tangent_numbers_series(growth_size(start + n));
       }
 
       for(std::size_t i = (std::max)(std::size_t(max_bernoulli_b2n<T>::value + 1), start); i < start + n; ++i)
@@ -468,8 +471,7 @@ public:
             }
             if(start + n >= bn.size())
             {
-               std::size_t new_size = (std::min)((std::max)((std::max)(std::size_t(start + n), std::size_t(bn.size() + 20)), std::size_t(50)), std::size_t(bn.capacity()));
-               tangent_numbers_series(new_size);
+               tangent_numbers_series(growth_size(start + n));
             }
             m_counter.store(static_cast<atomic_integer_type>(bn.size()), BOOST_MATH_ATOMIC_NS::memory_order_release);
          }
@@ -537,8 +539,7 @@ public:
       }
       if(start + n >= bn.size())
       {
-         std::size_t new_size = (std::min)((std::max)((std::max)(start + n, std::size_t(bn.size() + 20)), std::size_t(50)), std::size_t(bn.capacity()));
-         tangent_numbers_series(new_size);
+         tangent_numbers_series(growth_size(start + n));
       }
 
       for(std::size_t i = start; i < start + n; ++i)
@@ -568,8 +569,7 @@ public:
       }
       if(start + n >= bn.size())
       {
-         std::size_t new_size = (std::min)((std::max)((std::max)(start + n, std::size_t(bn.size() + 20)), std::size_t(50)), std::size_t(bn.capacity()));
-         tangent_numbers_series(new_size);
+         tangent_numbers_series(growth_size(start + n));
       }
 
       for(std::size_t i = start; i < start + n; ++i)
@@ -611,8 +611,7 @@ public:
             }
             if(start + n >= bn.size())
             {
-               std::size_t new_size = (std::min)((std::max)((std::max)(start + n, std::size_t(bn.size() + 20)), std::size_t(50)), std::size_t(bn.capacity()));
-               tangent_numbers_series(new_size);
+               tangent_numbers_series(growth_size(start + n));
             }
             m_counter.store(static_cast<atomic_integer_type>(bn.size()), BOOST_MATH_ATOMIC_NS::memory_order_release);
          }
@@ -636,7 +635,115 @@ public:
       return out;
    }
 
+   //
+   // Writes the state of the table, extended to hold at least n numbers, so that load()
+   // can restore it without recomputation.  The values are written in decimal with
+   // enough digits to round trip:
+   //
+   void save(std::ostream& os, std::size_t n)
+   {
+      n = (std::min)(n, static_cast<std::size_t>(bn.capacity()));
+#ifdef BOOST_HAS_THREADS
+      boost::detail::lightweight_mutex::scoped_lock l(m_mutex);
+#endif
+      if(static_cast<int>(m_current_precision) < boost::math::tools::digits<T>())
+      {
+         bn.clear();
+         tn.clear();
+         m_intermediates.clear();
+#if defined(BOOST_HAS_THREADS) && !defined(BOOST_MATH_NO_ATOMIC_INT)
+         m_counter.store(0, BOOST_MATH_ATOMIC_NS::memory_order_release);
+#endif
+         m_current_precision = boost::math::tools::digits<T>();
+      }
+      if(n > bn.size())
+      {
+         tangent_numbers_series(n);
+#if defined(BOOST_HAS_THREADS) && !defined(BOOST_MATH_NO_ATOMIC_INT)
+         m_counter.store(static_cast<atomic_integer_type>(bn.size()), BOOST_MATH_ATOMIC_NS::memory_order_release);
+#endif
+      }
+      std::streamsize precision = os.precision(2 + static_cast<std::streamsize>(boost::math::tools::digits<T>()) * 30103L / 100000L);
+      os << "bernoulli " << boost::math::tools::digits<T>() << " " << bn.size() << " " << m_overflow_limit << "\n";
+      for(typename container_type::size_type i = 0; i < bn.size(); ++i)
+         os << bn[i] << " " << tn[i] << " " << m_intermediates[i] << "\n";
+      os.precision(precision);
+   }
+   //
+   // Reads a table written by save() for the current precision of T, returning false if
+   // the stream does not hold one:
+   //
+   static bool read(std::istream& is, std::vector<T>& b, std::vector<T>& t, std::vector<T>& intermediates, std::size_t& overflow_limit)
+   {
+      std::string tag;
+      int digits;
+      std::size_t m;
+      if(!(is >> tag >> digits >> m >> overflow_limit) || (tag != "bernoulli") || (digits != boost::math::tools::digits<T>()))
+         return false;
+      b.resize(m);
+      t.resize(m);
+      intermediates.resize(m);
+      for(std::size_t i = 0; i < m; ++i)
+      {
+         if(!(is >> b[i] >> t[i] >> intermediates[i]))
+            return false;
+      }
+      return true;
+   }
+   //
+   // Restores a table read by read(): the numbers already present are left alone, and
+   // the remainder appended, so that readers of the table need not stop:
+   //
+   bool load(const std::vector<T>& b, const std::vector<T>& t, const std::vector<T>& intermediates, std::size_t overflow_limit)
+   {
+      if(b.size() > bn.capacity())
+         return false;
+      typename container_type::size_type m = static_cast<typename container_type::size_type>(b.size());
+#ifdef BOOST_HAS_THREADS
+      boost::detail::lightweight_mutex::scoped_lock l(m_mutex);
+#endif
+      if(static_cast<int>(m_current_precision) > boost::math::tools::digits<T>())
+         return false;
+      if(static_cast<int>(m_current_precision) < boost::math::tools::digits<T>())
+      {
+         bn.clear();
+         tn.clear();
+         m_intermediates.clear();
+#if defined(BOOST_HAS_THREADS) && !defined(BOOST_MATH_NO_ATOMIC_INT)
+         m_counter.store(0, BOOST_MATH_ATOMIC_NS::memory_order_release);
+#endif
+         m_current_precision = boost::math::tools::digits<T>();
+      }
+      if(m > bn.size())
+      {
+         typename container_type::size_type old_size = bn.size();
+         bn.resize(m);
+         tn.resize(m);
+         for(typename container_type::size_type i = old_size; i < m; ++i)
+         {
+            bn[i] = b[i];
+            tn[i] = t[i];
+         }
+         m_intermediates = intermediates;
+         m_overflow_limit = overflow_limit;
+#if defined(BOOST_HAS_THREADS) && !defined(BOOST_MATH_NO_ATOMIC_INT)
+         m_counter.store(static_cast<atomic_integer_type>(bn.size()), BOOST_MATH_ATOMIC_NS::memory_order_release);
+#endif
+      }
+      return true;
+   }
+
 private:
+   //
+   // Each extension of the table is made under the lock, and every thread which needs
+   // a number beyond the end must wait for it: so grow geometrically, which keeps the
+   // number of extensions, and hence of stalls, logarithmic in the final size:
+   //
+   std::size_t growth_size(std::size_t required)const
+   {
+      std::size_t size = bn.size();
+      return (std::min)((std::max)((std::max)(required, size + (std::max)(size / 2, std::size_t(20))), std::size_t(50)), std::size_t(bn.capacity()));
+   }
    //
    // The caches for Bernoulli and tangent numbers, once allocated,
    // these must NEVER EVER reallocate as it breaks our thread
@@ -657,6 +764,39 @@ private:
 #endif
 };
 
+//
+// By default there is one table per type and policy, shared by all threads.  Types whose
+// precision may change at run time get a table per thread instead, since a thread which
+// raised the precision would otherwise discard the table under the feet of the others;
+// defining BOOST_MATH_BERNOULLI_THREAD_LOCAL_CACHE does the same for every type, so that
+// no thread ever waits for another, at the cost of each computing its own numbers:
+//
+template <class T>
+struct bernoulli_cache_is_thread_local
+{
+#if defined(BOOST_NO_CXX11_THREAD_LOCAL) || defined(BOOST_INTEL) || defined(BOOST_MATH_NO_THREAD_LOCAL_WITH_NON_TRIVIAL_TYPES)
+   BOOST_STATIC_CONSTANT(bool, value = false);
+#elif defined(BOOST_MATH_BERNOULLI_THREAD_LOCAL_CACHE)
+   BOOST_STATIC_CONSTANT(bool, value = true);
+#else
+   BOOST_STATIC_CONSTANT(bool, value = (std::numeric_limits<T>::digits == 0) || (std::numeric_limits<T>::digits == INT_MAX));
+#endif
+};
+
+template <class T, class Policy>
+inline bernoulli_numbers_cache<T, Policy>& get_bernoulli_numbers_cache(const boost::false_type&)
+{
+   static bernoulli_numbers_cache<T, Policy> data;
+   return data;
+}
+
+template <class T, class Policy>
+inline bernoulli_numbers_cache<T, Policy>& get_bernoulli_numbers_cache(const boost::true_type&)
+{
+   static BOOST_MATH_THREAD_LOCAL bernoulli_numbers_cache<T, Policy> data;
+   return data;
+}
+
 template <class T, class Policy>
 inline bernoulli_numbers_cache<T, Policy>& get_bernoulli_numbers_cache()
 {
@@ -665,8 +805,7 @@ inline bernoulli_numbers_cache<T, Policy>& get_bernoulli_numbers_cache()
    // get initialized then (thread safety).
    //
    bernoulli_initializer<T, Policy>::force_instantiate();
-   static bernoulli_numbers_cache<T, Policy> data;
-   return data;
+   return get_bernoulli_numbers_cache<T, Policy>(boost::integral_constant<bool, bernoulli_cache_is_thread_local<T>::value>());
 }
 
 }}}
@@ -22,6 +22,59 @@
 
   namespace detail {
 
+     //
+     // Gamma function values used in the prefix of the asymptotic series below.
+     // When a and b are fixed and only z varies (see hypergeometric_1F1_evaluator),
+     // these need only be calculated once: the series needs Gamma(b) and either Gamma(a)
+     // or, after Kummer's relation, Gamma(b-a), so all three are stored.  Entries are
+     // looked up by value, so a cache for other parameters is simply not used.
+     //
+     template <class T>
+     class hypergeometric_1F1_gamma_cache
+     {
+     public:
+        struct entry
+        {
+           T x;
+           T tgamma_x;  // only calculated for |x| < 10
+           T lgamma_x;
+           int sign;
+           bool valid;  // false at the poles
+        };
+
+        template <class Policy>
+        hypergeometric_1F1_gamma_cache(const T& a, const T& b, const Policy& pol)
+           : m_a(make_entry(a, pol)), m_b_minus_a(make_entry(T(b - a), pol)), m_b(make_entry(b, pol)) {}
+
+        const entry* find(const T& x)const
+        {
+           if (m_a.valid && (m_a.x == x))
+              return &m_a;
+           if (m_b_minus_a.valid && (m_b_minus_a.x == x))
+              return &m_b_minus_a;
+           if (m_b.valid && (m_b.x == x))
+              return &m_b;
+           return 0;
+        }
+
+     private:
+        template <class Policy>
+        static entry make_entry(const T& x, const Policy& pol)
+        {
+           BOOST_MATH_STD_USING
+           entry e = { x, T(0), T(0), 1, (boost::math::isfinite)(x) && !((x <= 0) && (floor(x) == x)) };
+           if (e.valid)
+           {
+              if (fabs(x) < 10)
+                 e.tgamma_x = boost::math::tgamma(x, pol);
+              e.lgamma_x = boost::math::lgamma(x, &e.sign, pol);
+           }
+           return e;
+        }
+
+        entry m_a, m_b_minus_a, m_b;
+     };
+
      //
      // Asymptotic series based on https://dlmf.nist.gov/13.7#E1
      //
@@ -29,7 +82,7 @@
      // we require z > 0 and so apply Kummer's relation for z < 0.
      //
      template <class T, class Policy>
-     inline T hypergeometric_1F1_asym_large_z_series(T a, const T& b, T z, const Policy& pol, int& log_scaling)
+     inline T hypergeometric_1F1_asym_large_z_series(T a, const T& b, T z, const Policy& pol, int& log_scaling, const hypergeometric_1F1_gamma_cache<T>* cache = 0)
      {
         BOOST_MATH_STD_USING
         static const char* function = "boost::math::hypergeometric_1F1_asym_large_z_series<%1%>(%1%, %1%, %1%)";
@@ -47,9 +100,11 @@
            log_scaling += e;
            prefix = exp(z - e);
         }
+        const typename hypergeometric_1F1_gamma_cache<T>::entry* gamma_a = cache ? cache->find(a) : 0;
+        const typename hypergeometric_1F1_gamma_cache<T>::entry* gamma_b = cache ? cache->find(b) : 0;
         if ((fabs(a) < 10) && (fabs(b) < 10))
         {
-           prefix *= pow(z, a) * pow(z, -b) * boost::math::tgamma(b, pol) / boost::math::tgamma(a, pol);
+           prefix *= pow(z, a) * pow(z, -b) * (gamma_b ? gamma_b->tgamma_x : boost::math::tgamma(b, pol)) / (gamma_a ? gamma_a->tgamma_x : boost::math::tgamma(a, pol));
         }
         else
         {
@@ -58,12 +113,24 @@
            log_scaling += e;
            prefix *= exp(t - e);
 
-           t = boost::math::lgamma(b, &s, pol);
+           if (gamma_b)
+           {
+              t = gamma_b->lgamma_x;
+              s = gamma_b->sign;
+           }
+           else
+              t = boost::math::lgamma(b, &s, pol);
            e = itrunc(t, pol);
            log_scaling += e;
            prefix *= s * exp(t - e);
 
-           t = boost::math::lgamma(a, &s, pol);
+           if (gamma_a)
+           {
+              t = gamma_a->lgamma_x;
+              s = gamma_a->sign;
+           }
+           else
+              t = boost::math::lgamma(a, &s, pol);
            e = itrunc(t, pol);
            log_scaling -= e;
            prefix /= s * exp(t - e);
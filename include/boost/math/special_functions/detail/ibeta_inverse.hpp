@@ -15,6 +15,7 @@
 #include <boost/math/special_functions/erf.hpp>
 #include <boost/math/tools/roots.hpp>
 #include <boost/math/special_functions/detail/t_distribution_inv.hpp>
+#include <boost/math/special_functions/detail/transform_execution.hpp>
 
 namespace boost{ namespace math{ namespace detail{
 
@@ -413,8 +414,8 @@ T temme_method_3_ibeta_inverse(T a, T b, T p, T q, const Policy& pol)
 template <class T, class Policy>
 struct ibeta_roots
 {
-   ibeta_roots(T _a, T _b, T t, bool inv = false)
-      : a(_a), b(_b), target(t), invert(inv) {}
+   ibeta_roots(T _a, T _b, T t, bool inv = false, const ibeta_parameter_cache<T>* c = 0)
+      : a(_a), b(_b), target(t), invert(inv), cache(c) {}
 
    boost::math::tuple<T, T, T> operator()(T x)
    {
@@ -424,7 +425,7 @@ struct ibeta_roots
       
       T f1;
       T y = 1 - x;
-      T f = ibeta_imp(a, b, x, Policy(), invert, true, &f1) - target;
+      T f = ibeta_imp(a, b, x, Policy(), invert, true, &f1, cache) - target;
       if(invert)
          f1 = -f1;
       if(y == 0)
@@ -447,10 +448,11 @@ struct ibeta_roots
 private:
    T a, b, target;
    bool invert;
+   const ibeta_parameter_cache<T>* cache;
 };
 
 template <class T, class Policy>
-T ibeta_inv_imp(T a, T b, T p, T q, const Policy& pol, T* py)
+T ibeta_inv_imp(T a, T b, T p, T q, const Policy& pol, T* py, const ibeta_parameter_cache<T>* cache = 0)
 {
    BOOST_MATH_STD_USING  // For ADL of math functions.
 
@@ -874,7 +876,7 @@ T ibeta_inv_imp(T a, T b, T p, T q, const Policy& pol, T* py)
    //
    boost::uintmax_t max_iter = policies::get_max_root_iterations<Policy>();
    x = boost::math::tools::halley_iterate(
-      boost::math::detail::ibeta_roots<T, Policy>(a, b, (p < q ? p : q), (p < q ? false : true)), x, lower, upper, digits, max_iter);
+      boost::math::detail::ibeta_roots<T, Policy>(a, b, (p < q ? p : q), (p < q ? false : true), cache), x, lower, upper, digits, max_iter);
    policies::check_root_iterations<T>("boost::math::ibeta<%1%>(%1%, %1%, %1%)", max_iter, pol);
    //
    // We don't really want these asserts here, but they are useful for sanity
@@ -1010,6 +1012,135 @@ inline typename tools::promote_args<RT1, RT2, RT3>::type
    return ibetac_inv(a, b, q, static_cast<result_type*>(0), pol);
 }
 
+//
+// Evaluates the regularised incomplete beta functions, and their inverses,
+// for fixed a and b at many x (or p, or q).  The ratio of gamma functions
+// that depends only on a and b is calculated once on construction; the method
+// used for each argument is the same as the free functions, and so are the results.
+//
+template <class T, class Policy = policies::policy<> >
+class incomplete_beta_evaluator
+{
+public:
+   typedef typename tools::promote_args<T>::type result_type;
+
+   incomplete_beta_evaluator(T a, T b, const Policy& pol = Policy())
+      : m_a(static_cast<value_type>(a)), m_b(static_cast<value_type>(b)), m_cache(m_a, m_b, forwarding_policy(), lanczos_type())
+   {
+      (void)pol;
+   }
+
+   result_type a()const { return static_cast<result_type>(m_a); }
+   result_type b()const { return static_cast<result_type>(m_b); }
+
+   result_type ibeta(T x)const
+   {
+      BOOST_FPU_EXCEPTION_GUARD
+      return policies::checked_narrowing_cast<result_type, forwarding_policy>(detail::ibeta_imp(m_a, m_b, static_cast<value_type>(x), forwarding_policy(), false, true, static_cast<value_type*>(0), &m_cache), "boost::math::ibeta<%1%>(%1%,%1%,%1%)");
+   }
+   result_type ibetac(T x)const
+   {
+      BOOST_FPU_EXCEPTION_GUARD
+      return policies::checked_narrowing_cast<result_type, forwarding_policy>(detail::ibeta_imp(m_a, m_b, static_cast<value_type>(x), forwarding_policy(), true, true, static_cast<value_type*>(0), &m_cache), "boost::math::ibetac<%1%>(%1%,%1%,%1%)");
+   }
+   result_type ibeta_inv(T p)const
+   {
+      static const char* function = "boost::math::ibeta_inv<%1%>(%1%,%1%,%1%)";
+      BOOST_FPU_EXCEPTION_GUARD
+      if(m_a <= 0)
+         return policies::raise_domain_error<result_type>(function, "The argument a to the incomplete beta function inverse must be greater than zero (got a=%1%).", a(), Policy());
+      if(m_b <= 0)
+         return policies::raise_domain_error<result_type>(function, "The argument b to the incomplete beta function inverse must be greater than zero (got b=%1%).", b(), Policy());
+      if((p < 0) || (p > 1))
+         return policies::raise_domain_error<result_type>(function, "Argument p outside the range [0,1] in the incomplete beta function inverse (got p=%1%).", static_cast<result_type>(p), Policy());
+      value_type ry;
+      value_type rx = detail::ibeta_inv_imp(m_a, m_b, static_cast<value_type>(p), static_cast<value_type>(1 - p), forwarding_policy(), &ry, &m_cache);
+      return policies::checked_narrowing_cast<result_type, forwarding_policy>(rx, function);
+   }
+   result_type ibetac_inv(T q)const
+   {
+      static const char* function = "boost::math::ibetac_inv<%1%>(%1%,%1%,%1%)";
+      BOOST_FPU_EXCEPTION_GUARD
+      if(m_a <= 0)
+         return policies::raise_domain_error<result_type>(function, "The argument a to the incomplete beta function inverse must be greater than zero (got a=%1%).", a(), Policy());
+      if(m_b <= 0)
+         return policies::raise_domain_error<result_type>(function, "The argument b to the incomplete beta function inverse must be greater than zero (got b=%1%).", b(), Policy());
+      if((q < 0) || (q > 1))
+         return policies::raise_domain_error<result_type>(function, "Argument q outside the range [0,1] in the incomplete beta function inverse (got q=%1%).", static_cast<result_type>(q), Policy());
+      value_type ry;
+      value_type rx = detail::ibeta_inv_imp(m_a, m_b, static_cast<value_type>(1 - q), static_cast<value_type>(q), forwarding_policy(), &ry, &m_cache);
+      return policies::checked_narrowing_cast<result_type, forwarding_policy>(rx, function);
+   }
+
+   template <class InputIterator, class OutputIterator>
+   OutputIterator ibeta(InputIterator first, InputIterator last, OutputIterator out)const
+   {
+      for (; first != last; ++first, ++out)
+         *out = ibeta(*first);
+      return out;
+   }
+   template <class InputIterator, class OutputIterator>
+   OutputIterator ibetac(InputIterator first, InputIterator last, OutputIterator out)const
+   {
+      for (; first != last; ++first, ++out)
+         *out = ibetac(*first);
+      return out;
+   }
+   template <class InputIterator, class OutputIterator>
+   OutputIterator ibeta_inv(InputIterator first, InputIterator last, OutputIterator out)const
+   {
+      for (; first != last; ++first, ++out)
+         *out = ibeta_inv(*first);
+      return out;
+   }
+   template <class InputIterator, class OutputIterator>
+   OutputIterator ibetac_inv(InputIterator first, InputIterator last, OutputIterator out)const
+   {
+      for (; first != last; ++first, ++out)
+         *out = ibetac_inv(*first);
+      return out;
+   }
+
+#if !defined(BOOST_NO_CXX17_HDR_EXECUTION) && !defined(BOOST_NO_CXX17_IF_CONSTEXPR)
+   //
+   // As above, with the arguments distributed across the execution policy exec:
+   //
+   template <class ExecutionPolicy, class ForwardIterator, class OutputIterator, class = typename std::enable_if<std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value>::type>
+   OutputIterator ibeta(ExecutionPolicy&& exec, ForwardIterator first, ForwardIterator last, OutputIterator out)const
+   {
+      return detail::transform_with_execution_policy(exec, first, last, out, [this](T x) { return ibeta(x); });
+   }
+   template <class ExecutionPolicy, class ForwardIterator, class OutputIterator, class = typename std::enable_if<std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value>::type>
+   OutputIterator ibetac(ExecutionPolicy&& exec, ForwardIterator first, ForwardIterator last, OutputIterator out)const
+   {
+      return detail::transform_with_execution_policy(exec, first, last, out, [this](T x) { return ibetac(x); });
+   }
+   template <class ExecutionPolicy, class ForwardIterator, class OutputIterator, class = typename std::enable_if<std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value>::type>
+   OutputIterator ibeta_inv(ExecutionPolicy&& exec, ForwardIterator first, ForwardIterator last, OutputIterator out)const
+   {
+      return detail::transform_with_execution_policy(exec, first, last, out, [this](T p) { return ibeta_inv(p); });
+   }
+   template <class ExecutionPolicy, class ForwardIterator, class OutputIterator, class = typename std::enable_if<std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value>::type>
+   OutputIterator ibetac_inv(ExecutionPolicy&& exec, ForwardIterator first, ForwardIterator last, OutputIterator out)const
+   {
+      return detail::transform_with_execution_policy(exec, first, last, out, [this](T q) { return ibetac_inv(q); });
+   }
+#endif
+
+private:
+   typedef typename policies::evaluation<result_type, Policy>::type value_type;
+   typedef typename policies::normalise<
+      Policy,
+      policies::promote_float<false>,
+      policies::promote_double<false>,
+      policies::discrete_quantile<>,
+      policies::assert_undefined<> >::type forwarding_policy;
+   typedef typename lanczos::lanczos<value_type, forwarding_policy>::type lanczos_type;
+
+   value_type m_a, m_b;
+   detail::ibeta_parameter_cache<value_type> m_cache;
+};
+
 } // namespace math
 } // namespace boost
 
@@ -15,6 +15,7 @@
 #include <boost/math/special_functions/sign.hpp>
 #include <boost/math/tools/roots.hpp>
 #include <boost/math/policies/error_handling.hpp>
+#include <boost/math/special_functions/detail/transform_execution.hpp>
 
 namespace boost{ namespace math{
 
@@ -315,7 +316,15 @@ T find_inverse_gamma(T a, T p, T q, const Policy& pol, bool* p_has_10_digits)
 template <class T, class Policy>
 struct gamma_p_inverse_func
 {
-   gamma_p_inverse_func(T a_, T p_, bool inv) : a(a_), p(p_), invert(inv)
+   typedef typename policies::evaluation<T, Policy>::type value_type;
+   typedef typename policies::normalise<
+      Policy, 
+      policies::promote_float<false>, 
+      policies::promote_double<false>, 
+      policies::discrete_quantile<>,
+      policies::assert_undefined<> >::type forwarding_policy;
+
+   gamma_p_inverse_func(T a_, T p_, bool inv, const igamma_parameter_cache<value_type>* c = 0) : a(a_), p(p_), invert(inv), cache(c)
    {
       //
       // If p is too near 1 then P(x) - p suffers from cancellation
@@ -340,15 +349,6 @@ struct gamma_p_inverse_func
       // Calculate P(x) - p and the first two derivates, or if the invert
       // flag is set, then Q(x) - q and it's derivatives.
       //
-      typedef typename policies::evaluation<T, Policy>::type value_type;
-      // typedef typename lanczos::lanczos<T, Policy>::type evaluation_type;
-      typedef typename policies::normalise<
-         Policy, 
-         policies::promote_float<false>, 
-         policies::promote_double<false>, 
-         policies::discrete_quantile<>,
-         policies::assert_undefined<> >::type forwarding_policy;
-
       BOOST_MATH_STD_USING  // For ADL of std functions.
 
       T f, f1;
@@ -357,7 +357,7 @@ struct gamma_p_inverse_func
                static_cast<value_type>(a), 
                static_cast<value_type>(x), 
                true, invert,
-               forwarding_policy(), &ft));
+               forwarding_policy(), &ft, cache));
       f1 = static_cast<T>(ft);
       T f2;
       T div = (a - x - 1) / x;
@@ -383,10 +383,11 @@ struct gamma_p_inverse_func
 private:
    T a, p;
    bool invert;
+   const igamma_parameter_cache<value_type>* cache;
 };
 
 template <class T, class Policy>
-T gamma_p_inv_imp(T a, T p, const Policy& pol)
+T gamma_p_inv_imp(T a, T p, const Policy& pol, const igamma_parameter_cache<typename policies::evaluation<T, Policy>::type>* cache = 0)
 {
    BOOST_MATH_STD_USING  // ADL of std functions.
 
@@ -435,7 +436,7 @@ T gamma_p_inv_imp(T a, T p, const Policy& pol)
    //
    boost::uintmax_t max_iter = policies::get_max_root_iterations<Policy>();
    guess = tools::halley_iterate(
-      detail::gamma_p_inverse_func<T, Policy>(a, p, false),
+      detail::gamma_p_inverse_func<T, Policy>(a, p, false, cache),
       guess,
       lower,
       tools::max_value<T>(),
@@ -449,7 +450,7 @@ T gamma_p_inv_imp(T a, T p, const Policy& pol)
 }
 
 template <class T, class Policy>
-T gamma_q_inv_imp(T a, T q, const Policy& pol)
+T gamma_q_inv_imp(T a, T q, const Policy& pol, const igamma_parameter_cache<typename policies::evaluation<T, Policy>::type>* cache = 0)
 {
    BOOST_MATH_STD_USING  // ADL of std functions.
 
@@ -494,7 +495,7 @@ T gamma_q_inv_imp(T a, T q, const Policy& pol)
    //
    boost::uintmax_t max_iter = policies::get_max_root_iterations<Policy>();
    guess = tools::halley_iterate(
-      detail::gamma_p_inverse_func<T, Policy>(a, q, true),
+      detail::gamma_p_inverse_func<T, Policy>(a, q, true, cache),
       guess,
       lower,
       tools::max_value<T>(),
@@ -542,6 +543,119 @@ inline typename tools::promote_args<T1, T2>::type
    return gamma_q_inv(a, p, policies::policy<>());
 }
 
+//
+// Evaluates the regularised incomplete gamma functions, and their inverses,
+// for fixed a at many x (or p, or q).  The gamma function values that depend
+// only on a are calculated once on construction; the method used for each
+// argument is the same as the free functions, and so are the results.
+//
+template <class T, class Policy = policies::policy<> >
+class incomplete_gamma_evaluator
+{
+public:
+   typedef typename tools::promote_args<T>::type result_type;
+
+   incomplete_gamma_evaluator(T a, const Policy& pol = Policy())
+      : m_a(static_cast<value_type>(a)), m_cache(m_a, forwarding_policy(), lanczos_type())
+   {
+      (void)pol;
+      detail::igamma_initializer<value_type, forwarding_policy>::force_instantiate();
+   }
+
+   result_type a()const { return static_cast<result_type>(m_a); }
+
+   result_type gamma_p(T x)const
+   {
+      BOOST_FPU_EXCEPTION_GUARD
+      return policies::checked_narrowing_cast<result_type, forwarding_policy>(
+         detail::gamma_incomplete_imp(m_a, static_cast<value_type>(x), true, false,
+         forwarding_policy(), static_cast<value_type*>(0), &m_cache), "gamma_p<%1%>(%1%, %1%)");
+   }
+   result_type gamma_q(T x)const
+   {
+      BOOST_FPU_EXCEPTION_GUARD
+      return policies::checked_narrowing_cast<result_type, forwarding_policy>(
+         detail::gamma_incomplete_imp(m_a, static_cast<value_type>(x), true, true,
+         forwarding_policy(), static_cast<value_type*>(0), &m_cache), "gamma_q<%1%>(%1%, %1%)");
+   }
+   result_type gamma_p_inv(T p)const
+   {
+      return detail::gamma_p_inv_imp(static_cast<result_type>(m_a), static_cast<result_type>(p), Policy(), &m_cache);
+   }
+   result_type gamma_q_inv(T q)const
+   {
+      return detail::gamma_q_inv_imp(static_cast<result_type>(m_a), static_cast<result_type>(q), Policy(), &m_cache);
+   }
+
+   template <class InputIterator, class OutputIterator>
+   OutputIterator gamma_p(InputIterator first, InputIterator last, OutputIterator out)const
+   {
+      for (; first != last; ++first, ++out)
+         *out = gamma_p(*first);
+      return out;
+   }
+   template <class InputIterator, class OutputIterator>
+   OutputIterator gamma_q(InputIterator first, InputIterator last, OutputIterator out)const
+   {
+      for (; first != last; ++first, ++out)
+         *out = gamma_q(*first);
+      return out;
+   }
+   template <class InputIterator, class OutputIterator>
+   OutputIterator gamma_p_inv(InputIterator first, InputIterator last, OutputIterator out)const
+   {
+      for (; first != last; ++first, ++out)
+         *out = gamma_p_inv(*first);
+      return out;
+   }
+   template <class InputIterator, class OutputIterator>
+   OutputIterator gamma_q_inv(InputIterator first, InputIterator last, OutputIterator out)const
+   {
+      for (; first != last; ++first, ++out)
+         *out = gamma_q_inv(*first);
+      return out;
+   }
+
+#if !defined(BOOST_NO_CXX17_HDR_EXECUTION) && !defined(BOOST_NO_CXX17_IF_CONSTEXPR)
+   //
+   // As above, with the arguments distributed across the execution policy exec:
+   //
+   template <class ExecutionPolicy, class ForwardIterator, class OutputIterator, class = typename std::enable_if<std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value>::type>
+   OutputIterator gamma_p(ExecutionPolicy&& exec, ForwardIterator first, ForwardIterator last, OutputIterator out)const
+   {
+      return detail::transform_with_execution_policy(exec, first, last, out, [this](T x) { return gamma_p(x); });
+   }
+   template <class ExecutionPolicy, class ForwardIterator, class OutputIterator, class = typename std::enable_if<std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value>::type>
+   OutputIterator gamma_q(ExecutionPolicy&& exec, ForwardIterator first, ForwardIterator last, OutputIterator out)const
+   {
+      return detail::transform_with_execution_policy(exec, first, last, out, [this](T x) { return gamma_q(x); });
+   }
+   template <class ExecutionPolicy, class ForwardIterator, class OutputIterator, class = typename std::enable_if<std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value>::type>
+   OutputIterator gamma_p_inv(ExecutionPolicy&& exec, ForwardIterator first, ForwardIterator last, OutputIterator out)const
+   {
+      return detail::transform_with_execution_policy(exec, first, last, out, [this](T p) { return gamma_p_inv(p); });
+   }
+   template <class ExecutionPolicy, class ForwardIterator, class OutputIterator, class = typename std::enable_if<std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value>::type>
+   OutputIterator gamma_q_inv(ExecutionPolicy&& exec, ForwardIterator first, ForwardIterator last, OutputIterator out)const
+   {
+      return detail::transform_with_execution_policy(exec, first, last, out, [this](T q) { return gamma_q_inv(q); });
+   }
+#endif
+
+private:
+   typedef typename policies::evaluation<result_type, Policy>::type value_type;
+   typedef typename policies::normalise<
+      Policy,
+      policies::promote_float<false>,
+      policies::promote_double<false>,
+      policies::discrete_quantile<>,
+      policies::assert_undefined<> >::type forwarding_policy;
+   typedef typename lanczos::lanczos<value_type, forwarding_policy>::type lanczos_type;
+
+   value_type m_a;
+   detail::igamma_parameter_cache<value_type> m_cache;
+};
+
 } // namespace math
 } // namespace boost
 
@@ -0,0 +1,65 @@
+//  Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// This header contains the implementation shared by the execution policy
+// overloads of incomplete_gamma_evaluator and incomplete_beta_evaluator.
+//
+#ifndef BOOST_MATH_SF_DETAIL_TRANSFORM_EXECUTION_HPP
+#define BOOST_MATH_SF_DETAIL_TRANSFORM_EXECUTION_HPP
+
+#ifdef _MSC_VER
+#  pragma once
+#endif
+
+#include <boost/config.hpp>
+
+#if !defined(BOOST_NO_CXX17_HDR_EXECUTION) && !defined(BOOST_NO_CXX17_IF_CONSTEXPR)
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <execution>
+#include <iterator>
+#include <type_traits>
+#include <vector>
+
+namespace boost{ namespace math{ namespace detail{
+
+//
+// Evaluates f at each of [first, last) under the execution policy exec and
+// writes the results to out in order.  The first exception thrown by any
+// evaluation is rethrown once all have finished.
+//
+template <class ExecutionPolicy, class ForwardIterator, class OutputIterator, class F>
+OutputIterator transform_with_execution_policy(ExecutionPolicy&& exec, ForwardIterator first, ForwardIterator last, OutputIterator out, F f)
+{
+   typedef typename std::iterator_traits<ForwardIterator>::value_type argument_type;
+   typedef decltype(f(*first)) result_type;
+   const std::vector<argument_type> arguments(first, last);
+   std::vector<result_type> results(arguments.size());
+   std::atomic<bool> failed(false);
+   std::exception_ptr error;
+   result_type* const start = results.data();
+   std::for_each(exec, results.begin(), results.end(), [&](result_type& r)
+   {
+      try
+      {
+         r = f(arguments[&r - start]);
+      }
+      catch(...)
+      {
+         if(!failed.exchange(true))
+            error = std::current_exception();
+      }
+   });
+   if(error)
+      std::rethrow_exception(error);
+   return std::copy(results.begin(), results.end(), out);
+}
+
+}}} // namespaces
+
+#endif
+
+#endif // BOOST_MATH_SF_DETAIL_TRANSFORM_EXECUTION_HPP
@@ -0,0 +1,71 @@
+//  Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// This header contains the implementation shared by the execution policy
+// overloads of the Bessel and Airy zero functions.
+//
+#ifndef BOOST_MATH_SF_DETAIL_ZEROS_EXECUTION_HPP
+#define BOOST_MATH_SF_DETAIL_ZEROS_EXECUTION_HPP
+
+#ifdef _MSC_VER
+#  pragma once
+#endif
+
+#include <boost/config.hpp>
+
+#if !defined(BOOST_NO_CXX17_HDR_EXECUTION) && !defined(BOOST_NO_CXX17_IF_CONSTEXPR)
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <execution>
+#include <type_traits>
+#include <vector>
+
+namespace boost{ namespace math{ namespace detail{
+
+//
+// Each zero is found independently of the others, from its own asymptotic
+// initial guess, so a run of them may be found concurrently.  Evaluates
+// zero(start_index), ..., zero(start_index + number_of_zeros - 1) under the
+// execution policy exec and writes them to out_it in order.  The first
+// exception thrown by any of them is rethrown once all have finished.
+//
+template <class ExecutionPolicy, class OutputIterator, class Zero>
+OutputIterator zeros_with_execution_policy(ExecutionPolicy&& exec,
+                                           int start_index,
+                                           unsigned number_of_zeros,
+                                           OutputIterator out_it,
+                                           Zero zero)
+{
+   typedef decltype(zero(start_index)) result_type;
+   std::vector<result_type> zeros(number_of_zeros);
+   std::atomic<bool> failed(false);
+   std::exception_ptr error;
+   result_type* const first = zeros.data();
+   std::for_each(exec, zeros.begin(), zeros.end(), [&](result_type& z)
+   {
+      try
+      {
+         z = zero(start_index + static_cast<int>(&z - first));
+      }
+      catch(...)
+      {
+         if(!failed.exchange(true))
+            error = std::current_exception();
+      }
+   });
+   if(error)
+      std::rethrow_exception(error);
+   return std::copy(zeros.begin(), zeros.end(), out_it);
+}
+
+template <class ExecutionPolicy>
+using enable_if_execution_policy = typename std::enable_if<std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value>::type;
+
+}}} // namespaces
+
+#endif
+
+#endif // BOOST_MATH_SF_DETAIL_ZEROS_EXECUTION_HPP
@@ -22,10 +22,136 @@
 #pragma warning(pop)
 #endif
 #include <boost/config/no_tr1/cmath.hpp>
+#include <type_traits>
+#include <vector>
+
+#ifndef BOOST_MATH_MAX_CACHED_FACTORIAL
+#  define BOOST_MATH_MAX_CACHED_FACTORIAL 1000
+#endif
 
 namespace boost { namespace math
 {
 
+namespace detail{
+//
+// Factorials beyond the table in unchecked_factorial come from the gamma function,
+// and their logarithms from log or lgamma, all of which are expensive for a
+// multiprecision type.  Up to BOOST_MATH_MAX_CACHED_FACTORIAL they are kept once
+// found, per thread, and found again only if the precision changes.  Where T can't
+// be thread_local there is no cache, and each value is computed afresh:
+//
+template <class T>
+struct factorial_cache_is_enabled
+{
+#if defined(BOOST_NO_CXX11_THREAD_LOCAL) || defined(BOOST_INTEL)
+   BOOST_STATIC_CONSTANT(bool, value = false);
+#elif defined(BOOST_MATH_NO_THREAD_LOCAL_WITH_NON_TRIVIAL_TYPES)
+   BOOST_STATIC_CONSTANT(bool, value = std::is_trivially_destructible<T>::value);
+#else
+   BOOST_STATIC_CONSTANT(bool, value = true);
+#endif
+};
+
+template <class T, class Policy>
+class factorial_cache
+{
+public:
+   factorial_cache() : m_digits(0) {}
+
+   // Sets *result to i! and returns true, or returns false if i! is in the table,
+   // beyond the cache, or overflows:
+   static bool get(unsigned i, T* result)
+   {
+      if((i <= max_factorial<T>::value) || (i > BOOST_MATH_MAX_CACHED_FACTORIAL))
+         return false;
+      factorial_cache* cache = instance(std::integral_constant<bool, factorial_cache_is_enabled<T>::value>());
+      if(!cache)
+         return compute(i, result);
+      std::size_t index = i - max_factorial<T>::value - 1;
+      if(index >= cache->m_values.size())
+         cache->m_values.resize(index + 1, T(0));
+      if(cache->m_values[index] == 0)
+      {
+         if(!compute(i, &cache->m_values[index]))
+            return false;
+      }
+      *result = cache->m_values[index];
+      return true;
+   }
+   // Sets *result to log(i!) and returns true, or returns false if i > 1 is beyond
+   // the cache, or i! overflows:
+   static bool get_log(unsigned i, T* result)
+   {
+      if(i < 2)
+      {
+         *result = 0;
+         return true;
+      }
+      if(i > BOOST_MATH_MAX_CACHED_FACTORIAL)
+         return false;
+      factorial_cache* cache = instance(std::integral_constant<bool, factorial_cache_is_enabled<T>::value>());
+      if(!cache)
+         return compute_log(i, result);
+      std::size_t index = i - 2;
+      if(index >= cache->m_logs.size())
+         cache->m_logs.resize(index + 1, T(0));
+      if(cache->m_logs[index] == 0)
+      {
+         if(!compute_log(i, &cache->m_logs[index]))
+            return false;
+      }
+      *result = cache->m_logs[index];
+      return true;
+   }
+
+private:
+   // The same value as factorial, but an overflow is left to the caller to report:
+   static bool compute(unsigned i, T* result)
+   {
+      BOOST_MATH_STD_USING
+      typedef typename policies::normalise<Policy, policies::overflow_error<policies::ignore_error> >::type cache_policy;
+      T value = boost::math::tgamma(static_cast<T>(i+1), cache_policy());
+      if(value >= tools::max_value<T>())
+         return false;
+      *result = floor(value + 0.5f);
+      return true;
+   }
+   static bool compute_log(unsigned i, T* result)
+   {
+      BOOST_MATH_STD_USING
+      T value;
+      if(i <= max_factorial<T>::value)
+         value = unchecked_factorial<T>(i);
+      else if(!get(i, &value))
+         return false;
+      *result = log(value);
+      return true;
+   }
+   static factorial_cache* instance(const std::false_type&)
+   {
+      return 0;
+   }
+   static factorial_cache* instance(const std::true_type&)
+   {
+      static BOOST_MATH_THREAD_LOCAL factorial_cache data;
+      int current_digits = tools::digits<T>();
+      if(data.m_digits != current_digits)
+      {
+         data.m_values.clear();
+         data.m_logs.clear();
+         data.m_digits = current_digits;
+      }
+      return &data;
+   }
+
+   int m_digits;
+   // i! for i = max_factorial + 1, ..., and log(i!) for i = 2, ..., zero when not yet found:
+   std::vector<T> m_values;
+   std::vector<T> m_logs;
+};
+
+} // namespace detail
+
 template <class T, class Policy>
 inline T factorial(unsigned i, const Policy& pol)
 {
@@ -41,7 +167,10 @@ inline T factorial(unsigned i, const Policy& pol)
 
    if(i <= max_factorial<T>::value)
       return unchecked_factorial<T>(i);
-   T result = boost::math::tgamma(static_cast<T>(i+1), pol);
+   T result;
+   if(detail::factorial_cache<T, Policy>::get(i, &result))
+      return result;
+   result = boost::math::tgamma(static_cast<T>(i+1), pol);
    if(result > tools::max_value<T>())
       return result; // Overflowed value! (But tgamma will have signalled the error already).
    return floor(result + 0.5f);
@@ -52,6 +181,23 @@ inline T factorial(unsigned i)
 {
    return factorial<T>(i, policies::policy<>());
 }
+
+template <class T, class Policy>
+inline T log_factorial(unsigned i, const Policy& pol)
+{
+   BOOST_STATIC_ASSERT(!boost::is_integral<T>::value);
+
+   T result;
+   if(detail::factorial_cache<T, Policy>::get_log(i, &result))
+      return result;
+   return boost::math::lgamma(static_cast<T>(i+1), pol);
+}
+
+template <class T>
+inline T log_factorial(unsigned i)
+{
+   return log_factorial<T>(i, policies::policy<>());
+}
 /*
 // Can't have these in a policy enabled world?
 template<>
@@ -860,11 +860,84 @@ T full_igamma_prefix(T a, T z, const Policy& pol)
    return prefix;
 }
 //
+// The parts of the regularised incomplete gamma functions that depend
+// on a alone, computed once by incomplete_gamma_evaluator so that many
+// x at the same a can share them.  Each value is computed with exactly
+// the expression used at the point where it's consumed, so a cached
+// evaluation gives the same bits as an uncached one.  Values that could
+// raise an error are only computed where the uncached code would compute
+// them without one, and each is only used when called with the cached a:
+//
+template <class T>
+struct igamma_parameter_cache
+{
+   template <class Policy, class Lanczos>
+   igamma_parameter_cache(T a_, const Policy& pol, const Lanczos& l)
+      : a(a_), prefix_scale(0), scaled_gamma_argument(0), scaled_gamma(0), gamma_a(0), tgamma1pm1_a(0),
+        has_prefix_scale(false), has_scaled_gamma(false), has_gamma_a(false), has_tgamma1pm1_a(false)
+   {
+      BOOST_MATH_STD_USING
+      if(!(a > 0) || !(boost::math::isfinite)(a))
+         return;
+      if(a < 1)
+      {
+         if(a > tools::min_value<T>())
+         {
+            gamma_a = gamma_imp(a, pol, l);
+            has_gamma_a = true;
+         }
+         tgamma1pm1_a = boost::math::tgamma1pm1(a, pol);
+         has_tgamma1pm1_a = true;
+      }
+      else
+      {
+         T agh = a + static_cast<T>(Lanczos::g()) - T(0.5);
+         prefix_scale = sqrt(agh / boost::math::constants::e<T>()) / Lanczos::lanczos_sum_expG_scaled(a);
+         has_prefix_scale = true;
+      }
+   }
+   template <class Policy>
+   igamma_parameter_cache(T a_, const Policy& pol, const lanczos::undefined_lanczos&)
+      : a(a_), prefix_scale(0), scaled_gamma_argument(0), scaled_gamma(0), gamma_a(0), tgamma1pm1_a(0),
+        has_prefix_scale(false), has_scaled_gamma(false), has_gamma_a(false), has_tgamma1pm1_a(false)
+   {
+      if(!(a > 0) || !(boost::math::isfinite)(a))
+         return;
+      if(a < 1)
+      {
+         if(a > tools::min_value<T>())
+         {
+            gamma_a = boost::math::tgamma(a, pol);
+            has_gamma_a = true;
+         }
+         tgamma1pm1_a = boost::math::tgamma1pm1(a, pol);
+         has_tgamma1pm1_a = true;
+      }
+      // The prefix is computed from the scaled gamma function at a,
+      // or at a + shift when a is too small for the asymptotic expansion:
+      const int min_z = minimum_argument_for_bernoulli_recursion<T>();
+      if(a > min_z)
+         scaled_gamma_argument = a;
+      else
+         scaled_gamma_argument = T(a + (1 + ltrunc(min_z - a)));
+      scaled_gamma = scaled_tgamma_no_lanczos(scaled_gamma_argument, pol);
+      has_scaled_gamma = true;
+   }
+
+   T a;
+   T prefix_scale;          // sqrt(agh / e) / L(a) for a >= 1.
+   T scaled_gamma_argument;
+   T scaled_gamma;          // scaled_tgamma_no_lanczos(scaled_gamma_argument).
+   T gamma_a;               // tgamma(a) for a < 1.
+   T tgamma1pm1_a;          // tgamma1pm1(a) for a < 1.
+   bool has_prefix_scale, has_scaled_gamma, has_gamma_a, has_tgamma1pm1_a;
+};
+//
 // Compute (z^a)(e^-z)/tgamma(a)
 // most if the error occurs in this function:
 //
 template <class T, class Policy, class Lanczos>
-T regularised_gamma_prefix(T a, T z, const Policy& pol, const Lanczos& l)
+T regularised_gamma_prefix(T a, T z, const Policy& pol, const Lanczos& l, const igamma_parameter_cache<T>* cache = 0)
 {
    BOOST_MATH_STD_USING
    if (z >= tools::max_value<T>())
@@ -893,7 +966,7 @@ T regularised_gamma_prefix(T a, T z, const Policy& pol, const Lanczos& l)
       {
          // direct calculation, no danger of overflow as gamma(a) < 1/a
          // for small a.
-         return pow(z, a) * exp(-z) / gamma_imp(a, pol, l);
+         return pow(z, a) * exp(-z) / ((cache && cache->has_gamma_a && (cache->a == a)) ? cache->gamma_a : gamma_imp(a, pol, l));
       }
    }
    else if((fabs(d*d*a) <= 100) && (a > 150))
@@ -941,25 +1014,28 @@ T regularised_gamma_prefix(T a, T z, const Policy& pol, const Lanczos& l)
          prefix = pow(z / agh, a) * exp(amz);
       }
    }
-   prefix *= sqrt(agh / boost::math::constants::e<T>()) / Lanczos::lanczos_sum_expG_scaled(a);
+   if(cache && cache->has_prefix_scale && (cache->a == a))
+      prefix *= cache->prefix_scale;
+   else
+      prefix *= sqrt(agh / boost::math::constants::e<T>()) / Lanczos::lanczos_sum_expG_scaled(a);
    return prefix;
 }
 //
 // And again, without Lanczos support:
 //
 template <class T, class Policy>
-T regularised_gamma_prefix(T a, T z, const Policy& pol, const lanczos::undefined_lanczos& l)
+T regularised_gamma_prefix(T a, T z, const Policy& pol, const lanczos::undefined_lanczos& l, const igamma_parameter_cache<T>* cache = 0)
 {
    BOOST_MATH_STD_USING
 
    if((a < 1) && (z < 1))
    {
       // No overflow possible since the power terms tend to unity as a,z -> 0
-      return pow(z, a) * exp(-z) / boost::math::tgamma(a, pol);
+      return pow(z, a) * exp(-z) / ((cache && cache->has_gamma_a && (cache->a == a)) ? cache->gamma_a : boost::math::tgamma(a, pol));
    }
    else if(a > minimum_argument_for_bernoulli_recursion<T>())
    {
-      T scaled_gamma = scaled_tgamma_no_lanczos(a, pol);
+      T scaled_gamma = (cache && cache->has_scaled_gamma && (cache->scaled_gamma_argument == a)) ? cache->scaled_gamma : scaled_tgamma_no_lanczos(a, pol);
       T power_term = pow(z / a, a / 2);
       T a_minus_z = a - z;
       if ((0 == power_term) || (fabs(a_minus_z) > tools::log_max_value<T>()))
@@ -977,7 +1053,7 @@ T regularised_gamma_prefix(T a, T z, const Policy& pol, const lanczos::undefined
       //
       const int min_z = minimum_argument_for_bernoulli_recursion<T>();
       long shift = 1 + ltrunc(min_z - a);
-      T result = regularised_gamma_prefix(T(a + shift), z, pol, l);
+      T result = regularised_gamma_prefix(T(a + shift), z, pol, l, cache);
       if (result != 0)
       {
          for (long i = 0; i < shift; ++i)
@@ -994,7 +1070,7 @@ T regularised_gamma_prefix(T a, T z, const Policy& pol, const lanczos::undefined
          // we calculate z^a e^-z / tgamma(a+shift), combining power terms
          // as we go.  And again recurse down to the result.
          //
-         T scaled_gamma = scaled_tgamma_no_lanczos(T(a + shift), pol);
+         T scaled_gamma = (cache && cache->has_scaled_gamma && (cache->scaled_gamma_argument == a + shift)) ? cache->scaled_gamma : scaled_tgamma_no_lanczos(T(a + shift), pol);
          T power_term_1 = pow(z / (a + shift), a);
          T power_term_2 = pow(a + shift, -shift);
          T power_term_3 = exp(a + shift - z);
@@ -1017,14 +1093,14 @@ T regularised_gamma_prefix(T a, T z, const Policy& pol, const lanczos::undefined
 // Upper gamma fraction for very small a:
 //
 template <class T, class Policy>
-inline T tgamma_small_upper_part(T a, T x, const Policy& pol, T* pgam = 0, bool invert = false, T* pderivative = 0)
+inline T tgamma_small_upper_part(T a, T x, const Policy& pol, T* pgam = 0, bool invert = false, T* pderivative = 0, const igamma_parameter_cache<T>* cache = 0)
 {
    BOOST_MATH_STD_USING  // ADL of std functions.
    //
    // Compute the full upper fraction (Q) when a is very small:
    //
    T result;
-   result = boost::math::tgamma1pm1(a, pol);
+   result = (cache && cache->has_tgamma1pm1_a && (cache->a == a)) ? cache->tgamma1pm1_a : boost::math::tgamma1pm1(a, pol);
    if(pgam)
       *pgam = (result + 1) / a;
    T p = boost::math::powm1(x, a, pol);
@@ -1143,7 +1219,7 @@ T incomplete_tgamma_large_x(const T& a, const T& x, const Policy& pol)
 //
 template <class T, class Policy>
 T gamma_incomplete_imp(T a, T x, bool normalised, bool invert, 
-                       const Policy& pol, T* p_derivative)
+                       const Policy& pol, T* p_derivative, const igamma_parameter_cache<T>* cache = 0)
 {
    static const char* function = "boost::math::gamma_p<%1%>(%1%, %1%)";
    if(a <= 0)
@@ -1188,7 +1264,7 @@ T gamma_incomplete_imp(T a, T x, bool normalised, bool invert,
       }
       else
       {
-         result = gamma_incomplete_imp(a, x, true, invert, pol, p_derivative);
+         result = gamma_incomplete_imp(a, x, true, invert, pol, p_derivative, cache);
          if(result == 0)
          {
             if(invert)
@@ -1362,13 +1438,13 @@ T gamma_incomplete_imp(T a, T x, bool normalised, bool invert,
          if(!normalised)
             result *= boost::math::tgamma(a, pol);
          if(p_derivative && (*p_derivative == 0))
-            *p_derivative = regularised_gamma_prefix(a, x, pol, lanczos_type());
+            *p_derivative = regularised_gamma_prefix(a, x, pol, lanczos_type(), cache);
          break;
       }
    case 2:
       {
          // Compute P:
-         result = normalised ? regularised_gamma_prefix(a, x, pol, lanczos_type()) : full_igamma_prefix(a, x, pol);
+         result = normalised ? regularised_gamma_prefix(a, x, pol, lanczos_type(), cache) : full_igamma_prefix(a, x, pol);
          if(p_derivative)
             *p_derivative = result;
          if(result != 0)
@@ -1418,7 +1494,7 @@ T gamma_incomplete_imp(T a, T x, bool normalised, bool invert,
          // Compute Q:
          invert = !invert;
          T g;
-         result = tgamma_small_upper_part(a, x, pol, &g, invert, p_derivative);
+         result = tgamma_small_upper_part(a, x, pol, &g, invert, p_derivative, cache);
          invert = false;
          if(normalised)
             result /= g;
@@ -1427,7 +1503,7 @@ T gamma_incomplete_imp(T a, T x, bool normalised, bool invert,
    case 4:
       {
          // Compute Q:
-         result = normalised ? regularised_gamma_prefix(a, x, pol, lanczos_type()) : full_igamma_prefix(a, x, pol);
+         result = normalised ? regularised_gamma_prefix(a, x, pol, lanczos_type(), cache) : full_igamma_prefix(a, x, pol);
          if(p_derivative)
             *p_derivative = result;
          if(result != 0)
@@ -1457,7 +1533,7 @@ T gamma_incomplete_imp(T a, T x, bool normalised, bool invert,
          if(x >= a)
             invert = !invert;
          if(p_derivative)
-            *p_derivative = regularised_gamma_prefix(a, x, pol, lanczos_type());
+            *p_derivative = regularised_gamma_prefix(a, x, pol, lanczos_type(), cache);
          break;
       }
    case 6:
@@ -1483,14 +1559,14 @@ T gamma_incomplete_imp(T a, T x, bool normalised, bool invert,
          }
          result *= 1 - a * x / (a + 1);
          if (p_derivative)
-            *p_derivative = regularised_gamma_prefix(a, x, pol, lanczos_type());
+            *p_derivative = regularised_gamma_prefix(a, x, pol, lanczos_type(), cache);
          break;
       }
    case 7:
    {
       // x is large,
       // Compute Q:
-      result = normalised ? regularised_gamma_prefix(a, x, pol, lanczos_type()) : full_igamma_prefix(a, x, pol);
+      result = normalised ? regularised_gamma_prefix(a, x, pol, lanczos_type(), cache) : full_igamma_prefix(a, x, pol);
       if (p_derivative)
          *p_derivative = result;
       result /= x;
@@ -69,6 +69,87 @@ Real gegenbauer_prime(unsigned n, Real lambda, Real x) {
     return gegenbauer_derivative<Real>(n, lambda, x, 1);
 }
 
+// All the degrees 0, 1, ..., n at once, from the same recurrence as gegenbauer:
+template<typename Real, class OutputIterator>
+OutputIterator gegenbauer_array(unsigned n, Real lambda, Real x, OutputIterator out_it)
+{
+    static_assert(!std::is_integral<Real>::value, "Gegenbauer polynomials required floating point arguments.");
+    if (lambda <= -1/Real(2)) {
+        throw std::domain_error("lambda > -1/2 is required.");
+    }
+    Real y0 = 1;
+    *out_it++ = y0;
+    if (n == 0) {
+        return out_it;
+    }
+    Real y1 = 2*lambda*x;
+    *out_it++ = y1;
+    Real gamma = 2*(lambda - 1);
+    for (unsigned j = 2; j <= n; ++j) {
+        Real k = j;
+        Real yk = ( (2 + gamma/k)*x*y1 - (1+gamma/k)*y0);
+        y0 = y1;
+        y1 = yk;
+        *out_it++ = yk;
+    }
+    return out_it;
+}
+
+// Many points at once: C_k^lambda(x[i]) is written to out[k*number_of_points + i] for k = 0, ..., n,
+// so that the inner loop runs over contiguous points and vectorizes.
+template<typename Real>
+void gegenbauer_array(unsigned n, Real lambda, const Real* x, size_t number_of_points, Real* out)
+{
+    static_assert(!std::is_integral<Real>::value, "Gegenbauer polynomials required floating point arguments.");
+    if (lambda <= -1/Real(2)) {
+        throw std::domain_error("lambda > -1/2 is required.");
+    }
+    for (size_t i = 0; i < number_of_points; ++i) {
+        out[i] = 1;
+    }
+    if (n == 0) {
+        return;
+    }
+    for (size_t i = 0; i < number_of_points; ++i) {
+        out[number_of_points + i] = 2*lambda*x[i];
+    }
+    Real gamma = 2*(lambda - 1);
+    for (unsigned j = 2; j <= n; ++j) {
+        Real k = j;
+        Real a = 2 + gamma/k;
+        Real b = 1 + gamma/k;
+        const Real* y0 = out + (j - 2)*number_of_points;
+        const Real* y1 = out + (j - 1)*number_of_points;
+        Real* yk = out + j*number_of_points;
+        for (size_t i = 0; i < number_of_points; ++i) {
+            yk[i] = a*x[i]*y1[i] - b*y0[i];
+        }
+    }
+}
+
+// The sum of c[k] C_k^lambda(x) for k = 0, ..., length-1, by Clenshaw's recurrence:
+template<typename Real>
+Real gegenbauer_clenshaw_recurrence(const Real* const c, size_t length, Real lambda, Real x)
+{
+    static_assert(!std::is_integral<Real>::value, "Gegenbauer polynomials required floating point arguments.");
+    if (lambda <= -1/Real(2)) {
+        throw std::domain_error("lambda > -1/2 is required.");
+    }
+    if (length == 0) {
+        return Real(0);
+    }
+    Real gamma = 2*(lambda - 1);
+    Real b2 = 0;
+    Real b1 = 0;
+    for (size_t k = length - 1; k >= 1; --k) {
+        Real tmp = c[k] + (2 + gamma/(k+1))*x*b1 - (1 + gamma/(k+2))*b2;
+        b2 = b1;
+        b1 = tmp;
+    }
+    // c[0] C_0 + b_1 C_1 - (1 + gamma/2) b_2 C_0, and 1 + gamma/2 = lambda:
+    return c[0] + 2*lambda*x*b1 - lambda*b2;
+}
+
 
 }}
 #endif
@@ -14,6 +14,7 @@
 #include <boost/math/special_functions/math_fwd.hpp>
 #include <boost/math/tools/config.hpp>
 #include <boost/math/policies/error_handling.hpp>
+#include <boost/utility/enable_if.hpp>
 
 namespace boost{
 namespace math{
@@ -67,6 +68,86 @@ inline typename tools::promote_args<T>::type
    return boost::math::hermite(n, x, policies::policy<>());
 }
 
+//
+// All the degrees 0, 1, ..., n at once, from the same recurrence as hermite:
+//
+template <class T, class OutputIterator, class Policy>
+inline typename boost::enable_if_c<policies::is_policy<Policy>::value, OutputIterator>::type
+   hermite_array(unsigned n, T x, OutputIterator out_it, const Policy&)
+{
+   typedef typename tools::promote_args<T>::type result_type;
+   typedef typename policies::evaluation<result_type, Policy>::type value_type;
+   static const char* function = "boost::math::hermite_array<%1%>(unsigned, %1%)";
+   value_type p0 = 1;
+   value_type p1 = 2 * static_cast<value_type>(x);
+   *out_it++ = policies::checked_narrowing_cast<result_type, Policy>(p0, function);
+   if(n == 0)
+      return out_it;
+   *out_it++ = policies::checked_narrowing_cast<result_type, Policy>(p1, function);
+   for(unsigned c = 1; c < n; ++c)
+   {
+      std::swap(p0, p1);
+      p1 = hermite_next(c, static_cast<value_type>(x), p0, p1);
+      *out_it++ = policies::checked_narrowing_cast<result_type, Policy>(p1, function);
+   }
+   return out_it;
+}
+
+template <class T, class OutputIterator>
+inline OutputIterator hermite_array(unsigned n, T x, OutputIterator out_it)
+{
+   return boost::math::hermite_array(n, x, out_it, policies::policy<>());
+}
+
+//
+// Many points at once: H_k(x[i]) is written to out[k * number_of_points + i] for k = 0, ..., n,
+// so that the inner loop runs over contiguous points and vectorizes.  No checking is performed.
+//
+template <class T>
+void hermite_array(unsigned n, const T* x, std::size_t number_of_points, T* out)
+{
+   for(std::size_t i = 0; i < number_of_points; ++i)
+   {
+      out[i] = 1;
+   }
+   if(n == 0)
+      return;
+   for(std::size_t i = 0; i < number_of_points; ++i)
+   {
+      out[number_of_points + i] = 2 * x[i];
+   }
+   for(unsigned c = 1; c < n; ++c)
+   {
+      const T* p0 = out + (c - 1) * number_of_points;
+      const T* p1 = out + c * number_of_points;
+      T* p2 = out + (c + 1) * number_of_points;
+      for(std::size_t i = 0; i < number_of_points; ++i)
+      {
+         p2[i] = 2 * x[i] * p1[i] - 2 * c * p0[i];
+      }
+   }
+}
+
+//
+// The sum of c[k] H_k(x) for k = 0, ..., length-1, by Clenshaw's recurrence:
+//
+template <class Real, class T2>
+inline Real hermite_clenshaw_recurrence(const Real* const c, std::size_t length, const T2& x)
+{
+   if(length == 0)
+      return 0;
+   Real b2 = 0;
+   Real b1 = 0;
+   for(std::size_t k = length - 1; k >= 1; --k)
+   {
+      Real tmp = c[k] + 2 * x * b1 - 2 * (k + 1) * b2;
+      b2 = b1;
+      b1 = tmp;
+   }
+   // c[0] H_0 + b_1 H_1 - 2 b_2 H_0:
+   return c[0] + 2 * x * b1 - 2 * b2;
+}
+
 } // namespace math
 } // namespace boost
 
@@ -303,7 +303,7 @@ namespace boost { namespace math { namespace detail {
 
       
    template <class T, class Policy>
-   T hypergeometric_1F1_imp(const T& a, const T& b, const T& z, const Policy& pol, int& log_scaling)
+   T hypergeometric_1F1_imp(const T& a, const T& b, const T& z, const Policy& pol, int& log_scaling, const hypergeometric_1F1_gamma_cache<T>* cache)
    {
       BOOST_MATH_STD_USING // exp, fabs, sqrt
 
@@ -372,7 +372,7 @@ namespace boost { namespace math { namespace detail {
                // Fractional parts of a and b are genuinely equal, we might as well
                // apply Kummer's relation and get a truncated series:
                int scaling = itrunc(z);
-               T r = exp(z - scaling) * detail::hypergeometric_1F1_imp<T>(b_minus_a, b, -z, pol, log_scaling);
+               T r = exp(z - scaling) * detail::hypergeometric_1F1_imp<T>(b_minus_a, b, -z, pol, log_scaling, cache);
                log_scaling += scaling;
                return r;
             }
@@ -404,7 +404,7 @@ namespace boost { namespace math { namespace detail {
          int saved_scale = log_scaling;
          try
          {
-            return hypergeometric_1F1_asym_large_z_series(a, b, z, pol, log_scaling);
+            return hypergeometric_1F1_asym_large_z_series(a, b, z, pol, log_scaling, cache);
          }
          catch (const evaluation_error&)
          {
@@ -445,7 +445,7 @@ namespace boost { namespace math { namespace detail {
          // by Kummer's transformation
          // (we also don't transform if z belongs to [-1,0])
          int scaling = itrunc(z);
-         T r = exp(z - scaling) * detail::hypergeometric_1F1_imp<T>(b_minus_a, b, -z, pol, log_scaling);
+         T r = exp(z - scaling) * detail::hypergeometric_1F1_imp<T>(b_minus_a, b, -z, pol, log_scaling, cache);
          log_scaling += scaling;
          return r;
       }
@@ -582,11 +582,17 @@ namespace boost { namespace math { namespace detail {
    }
 
    template <class T, class Policy>
-   inline T hypergeometric_1F1_imp(const T& a, const T& b, const T& z, const Policy& pol)
+   T hypergeometric_1F1_imp(const T& a, const T& b, const T& z, const Policy& pol, int& log_scaling)
+   {
+      return hypergeometric_1F1_imp(a, b, z, pol, log_scaling, static_cast<const hypergeometric_1F1_gamma_cache<T>*>(0));
+   }
+
+   template <class T, class Policy>
+   inline T hypergeometric_1F1_scaled_imp(const T& a, const T& b, const T& z, const Policy& pol, const hypergeometric_1F1_gamma_cache<T>* cache)
    {
       BOOST_MATH_STD_USING // exp, fabs, sqrt
       int log_scaling = 0;
-      T result = hypergeometric_1F1_imp(a, b, z, pol, log_scaling);
+      T result = hypergeometric_1F1_imp(a, b, z, pol, log_scaling, cache);
       //
       // Actual result will be result * e^log_scaling.
       //
@@ -614,11 +620,17 @@ namespace boost { namespace math { namespace detail {
    }
 
    template <class T, class Policy>
-   inline T log_hypergeometric_1F1_imp(const T& a, const T& b, const T& z, int* sign, const Policy& pol)
+   inline T hypergeometric_1F1_imp(const T& a, const T& b, const T& z, const Policy& pol)
+   {
+      return hypergeometric_1F1_scaled_imp(a, b, z, pol, static_cast<const hypergeometric_1F1_gamma_cache<T>*>(0));
+   }
+
+   template <class T, class Policy>
+   inline T log_hypergeometric_1F1_imp(const T& a, const T& b, const T& z, int* sign, const Policy& pol, const hypergeometric_1F1_gamma_cache<T>* cache = 0)
    {
       BOOST_MATH_STD_USING // exp, fabs, sqrt
       int log_scaling = 0;
-      T result = hypergeometric_1F1_imp(a, b, z, pol, log_scaling);
+      T result = hypergeometric_1F1_imp(a, b, z, pol, log_scaling, cache);
       if (sign)
       *sign = result < 0 ? -1 : 1;
      result = log(fabs(result)) + log_scaling;
@@ -626,16 +638,19 @@ namespace boost { namespace math { namespace detail {
    }
 
    template <class T, class Policy>
-   inline T hypergeometric_1F1_regularized_imp(const T& a, const T& b, const T& z, const Policy& pol)
+   inline T hypergeometric_1F1_regularized_imp(const T& a, const T& b, const T& z, const Policy& pol, const hypergeometric_1F1_gamma_cache<T>* cache = 0)
    {
       BOOST_MATH_STD_USING // exp, fabs, sqrt
       int log_scaling = 0;
-      T result = hypergeometric_1F1_imp(a, b, z, pol, log_scaling);
+      T result = hypergeometric_1F1_imp(a, b, z, pol, log_scaling, cache);
       //
       // Actual result will be result * e^log_scaling / tgamma(b).
       //
     int result_sign = 1;
-    T scale = log_scaling - boost::math::lgamma(b, &result_sign, pol);
+    const typename hypergeometric_1F1_gamma_cache<T>::entry* gamma_b = cache ? cache->find(b) : 0;
+    if (gamma_b)
+       result_sign = gamma_b->sign;
+    T scale = log_scaling - (gamma_b ? gamma_b->lgamma_x : boost::math::lgamma(b, &result_sign, pol));
 #ifndef BOOST_NO_CXX11_THREAD_LOCAL
       static const thread_local T max_scaling = boost::math::tools::log_max_value<T>() - 2;
     static const thread_local T max_scale_factor = exp(max_scaling);
@@ -771,6 +786,71 @@ inline typename tools::promote_args<T1, T2, T3>::type log_hypergeometric_1F1(T1
   return log_hypergeometric_1F1(a, b, z, sign, policies::policy<>());
 }
 
+//
+// Evaluates 1F1(a; b; z) for fixed a and b at many z.  The gamma function
+// values that depend only on a and b are calculated once on construction, the
+// method used for each z is the same as hypergeometric_1F1, and so are the results.
+//
+template <class T, class Policy = policies::policy<> >
+class hypergeometric_1F1_evaluator
+{
+public:
+   typedef typename tools::promote_args<T>::type result_type;
+
+   hypergeometric_1F1_evaluator(T a, T b, const Policy& pol = Policy())
+      : m_a(static_cast<value_type>(a)), m_b(static_cast<value_type>(b)), m_cache(m_a, m_b, forwarding_policy())
+   {
+      (void)pol;
+   }
+
+   result_type a()const { return static_cast<result_type>(m_a); }
+   result_type b()const { return static_cast<result_type>(m_b); }
+
+   result_type operator()(T z)const
+   {
+      BOOST_FPU_EXCEPTION_GUARD
+      return policies::checked_narrowing_cast<result_type, Policy>(
+         detail::hypergeometric_1F1_scaled_imp<value_type>(m_a, m_b, static_cast<value_type>(z), forwarding_policy(), &m_cache),
+         "boost::math::hypergeometric_1F1<%1%>(%1%,%1%,%1%)");
+   }
+
+   template <class InputIterator, class OutputIterator>
+   OutputIterator operator()(InputIterator first, InputIterator last, OutputIterator out)const
+   {
+      for (; first != last; ++first, ++out)
+         *out = (*this)(*first);
+      return out;
+   }
+
+   result_type regularized(T z)const
+   {
+      BOOST_FPU_EXCEPTION_GUARD
+      return policies::checked_narrowing_cast<result_type, Policy>(
+         detail::hypergeometric_1F1_regularized_imp<value_type>(m_a, m_b, static_cast<value_type>(z), forwarding_policy(), &m_cache),
+         "boost::math::hypergeometric_1F1<%1%>(%1%,%1%,%1%)");
+   }
+
+   result_type log(T z, int* sign = 0)const
+   {
+      BOOST_FPU_EXCEPTION_GUARD
+      return policies::checked_narrowing_cast<result_type, Policy>(
+         detail::log_hypergeometric_1F1_imp<value_type>(m_a, m_b, static_cast<value_type>(z), sign, forwarding_policy(), &m_cache),
+         "boost::math::hypergeometric_1F1<%1%>(%1%,%1%,%1%)");
+   }
+
+private:
+   typedef typename policies::evaluation<result_type, Policy>::type value_type;
+   typedef typename policies::normalise<
+      Policy,
+      policies::promote_float<false>,
+      policies::promote_double<false>,
+      policies::discrete_quantile<>,
+      policies::assert_undefined<> >::type forwarding_policy;
+
+   value_type m_a, m_b;
+   detail::hypergeometric_1F1_gamma_cache<value_type> m_cache;
+};
+
 
   } } // namespace boost::math
 
@@ -8,6 +8,7 @@
 
 #include <limits>
 #include <stdexcept>
+#include <type_traits>
 
 namespace boost { namespace math {
 
@@ -65,5 +66,96 @@ Real jacobi_double_prime(unsigned n, Real alpha, Real beta, Real x)
     return jacobi_derivative<Real>(n, alpha, beta, x, 2);
 }
 
+// All the degrees 0, 1, ..., n at once, from the same recurrence as jacobi:
+template<typename Real, class OutputIterator>
+OutputIterator jacobi_array(unsigned n, Real alpha, Real beta, Real x, OutputIterator out_it)
+{
+    static_assert(!std::is_integral<Real>::value, "Jacobi polynomials do not work with integer arguments.");
+    Real y0 = 1;
+    *out_it++ = y0;
+    if (n == 0) {
+        return out_it;
+    }
+    Real y1 = (alpha+1) + (alpha+beta+2)*(x-1)/Real(2);
+    *out_it++ = y1;
+    for (unsigned j = 2; j <= n; ++j) {
+        Real k = j;
+        Real denom = 2*k*(k+alpha+beta)*(2*k+alpha+beta-2);
+        Real gamma1 = (2*k+alpha+beta-1)*( (2*k+alpha+beta)*(2*k+alpha+beta-2)*x + alpha*alpha -beta*beta);
+        Real gamma0 = -2*(k+alpha-1)*(k+beta-1)*(2*k+alpha+beta);
+        Real yk = (gamma1*y1 + gamma0*y0)/denom;
+        y0 = y1;
+        y1 = yk;
+        *out_it++ = yk;
+    }
+    return out_it;
+}
+
+namespace detail {
+
+// The recurrence written as P_k = (a x + b) P_{k-1} + c P_{k-2}, for k >= 2:
+template<typename Real>
+void jacobi_recurrence_coefficients(Real k, Real alpha, Real beta, Real& a, Real& b, Real& c)
+{
+    Real denom = 2*k*(k+alpha+beta)*(2*k+alpha+beta-2);
+    a = (2*k+alpha+beta-1)*(2*k+alpha+beta)*(2*k+alpha+beta-2)/denom;
+    b = (2*k+alpha+beta-1)*(alpha*alpha - beta*beta)/denom;
+    c = -2*(k+alpha-1)*(k+beta-1)*(2*k+alpha+beta)/denom;
+}
+
+} // namespace detail
+
+// Many points at once: P_k^(alpha, beta)(x[i]) is written to out[k*number_of_points + i] for k = 0, ..., n,
+// so that the inner loop runs over contiguous points and vectorizes.
+template<typename Real>
+void jacobi_array(unsigned n, Real alpha, Real beta, const Real* x, size_t number_of_points, Real* out)
+{
+    static_assert(!std::is_integral<Real>::value, "Jacobi polynomials do not work with integer arguments.");
+    for (size_t i = 0; i < number_of_points; ++i) {
+        out[i] = 1;
+    }
+    if (n == 0) {
+        return;
+    }
+    for (size_t i = 0; i < number_of_points; ++i) {
+        out[number_of_points + i] = (alpha+1) + (alpha+beta+2)*(x[i]-1)/Real(2);
+    }
+    for (unsigned j = 2; j <= n; ++j) {
+        Real a, b, c;
+        detail::jacobi_recurrence_coefficients(Real(j), alpha, beta, a, b, c);
+        const Real* y0 = out + (j - 2)*number_of_points;
+        const Real* y1 = out + (j - 1)*number_of_points;
+        Real* yk = out + j*number_of_points;
+        for (size_t i = 0; i < number_of_points; ++i) {
+            yk[i] = (a*x[i] + b)*y1[i] + c*y0[i];
+        }
+    }
+}
+
+// The sum of c[k] P_k^(alpha, beta)(x) for k = 0, ..., length-1, by Clenshaw's recurrence:
+template<typename Real>
+Real jacobi_clenshaw_recurrence(const Real* const c, size_t length, Real alpha, Real beta, Real x)
+{
+    static_assert(!std::is_integral<Real>::value, "Jacobi polynomials do not work with integer arguments.");
+    if (length == 0) {
+        return Real(0);
+    }
+    Real b2 = 0;
+    Real b1 = 0;
+    // The coefficient of P_k in the recurrence for P_{k+2}, carried down from the previous step:
+    Real C_next = 0;
+    for (size_t k = length - 1; k >= 1; --k) {
+        Real A, B, C;
+        detail::jacobi_recurrence_coefficients(Real(k+1), alpha, beta, A, B, C);
+        Real tmp = c[k] + (A*x + B)*b1 + C_next*b2;
+        b2 = b1;
+        b1 = tmp;
+        C_next = C;
+    }
+    // c[0] P_0 + b_1 P_1 + C_2 b_2 P_0, where C_next = C_2 if the loop ran at all, and b_2 = 0 if it did not:
+    Real p1 = (alpha+1) + (alpha+beta+2)*(x-1)/Real(2);
+    return c[0] + p1*b1 + C_next*b2;
+}
+
 }}
 #endif
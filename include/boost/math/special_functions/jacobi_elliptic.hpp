@@ -11,11 +11,50 @@
 #include <boost/math/tools/promotion.hpp>
 #include <boost/math/policies/error_handling.hpp>
 #include <boost/math/special_functions/math_fwd.hpp>
+#include <vector>
 
 namespace boost{ namespace math{
 
 namespace detail{
 
+//
+// The arithmetic-geometric mean sequence of jacobi_recurse, which depends only on
+// the modulus k: the ratios c[n]/a[n] for n = 1 ... N, and 2^N and a[N] for the
+// starting value of the recurrence.  Empty when k takes one of the special cases.
+//
+template <class T>
+struct jacobi_agm_sequence
+{
+   template <class Policy>
+   jacobi_agm_sequence(const T& k, const Policy&)
+      : scale(0), an(0)
+   {
+      BOOST_MATH_STD_USING
+      if(!((k > 0) && (k < 1)) || (k < tools::forth_root_epsilon<T>()))
+         return;
+      T kc = 1 - k;
+      T anm1 = 1;
+      T bnm1 = k < 0.5 ? T(sqrt(1 - k * k)) : T(sqrt(2 * kc - kc * kc));
+      for(unsigned N = 1;; ++N)
+      {
+         T cn = (anm1 - bnm1) / 2;
+         an = (anm1 + bnm1) / 2;
+         ratios.push_back(cn / an);
+         if(cn < policies::get_epsilon<T, Policy>())
+         {
+            scale = ldexp(T(1), (int)N);
+            break;
+         }
+         bnm1 = sqrt(anm1 * bnm1);
+         anm1 = an;
+      }
+   }
+   bool empty()const { return ratios.empty(); }
+
+   std::vector<T> ratios;
+   T scale, an;
+};
+
 template <class T, class Policy>
 T jacobi_recurse(const T& x, const T& k, T anm1, T bnm1, unsigned N, T* pTn, const Policy& pol)
 {
@@ -35,8 +74,22 @@ T jacobi_recurse(const T& x, const T& k, T anm1, T bnm1, unsigned N, T* pTn, con
    return (Tn + asin((cn / an) * sin(Tn))) / 2;
 }
 
+//
+// The same recurrence as jacobi_recurse from a precomputed sequence: returns T0, and sets *pT1.
+//
+template <class T>
+T jacobi_recurse(const T& x, const jacobi_agm_sequence<T>& agm, T* pT1)
+{
+   BOOST_MATH_STD_USING
+   T Tn = agm.scale * x * agm.an;
+   for(std::size_t n = agm.ratios.size(); n > 1; --n)
+      Tn = (Tn + asin(agm.ratios[n - 1] * sin(Tn))) / 2;
+   *pT1 = Tn;
+   return (Tn + asin(agm.ratios[0] * sin(Tn))) / 2;
+}
+
 template <class T, class Policy>
-T jacobi_imp(const T& x, const T& k, T* cn, T* dn, const Policy& pol, const char* function)
+T jacobi_imp(const T& x, const T& k, T* cn, T* dn, const Policy& pol, const char* function, const jacobi_agm_sequence<T>* agm = 0)
 {
    BOOST_MATH_STD_USING
    if(k < 0)
@@ -50,7 +103,7 @@ T jacobi_imp(const T& x, const T& k, T* cn, T* dn, const Policy& pol, const char
       T xp = x * k;
       T kp = 1 / k;
       T snp, cnp, dnp;
-      snp = jacobi_imp(xp, kp, &cnp, &dnp, pol, function);
+      snp = jacobi_imp(xp, kp, &cnp, &dnp, pol, function, agm);
       *cn = dnp;
       *dn = cnp;
       return snp * kp;
@@ -106,9 +159,15 @@ T jacobi_imp(const T& x, const T& k, T* cn, T* dn, const Policy& pol, const char
       return sn + sn2 - sn3;
    }*/
    T T1;
-   T kc = 1 - k;
-   T k_prime = k < 0.5 ? T(sqrt(1 - k * k)) : T(sqrt(2 * kc - kc * kc));
-   T T0 = jacobi_recurse(x, k, T(1), k_prime, 0, &T1, pol);
+   T T0;
+   if(agm)
+      T0 = jacobi_recurse(x, *agm, &T1);
+   else
+   {
+      T kc = 1 - k;
+      T k_prime = k < 0.5 ? T(sqrt(1 - k * k)) : T(sqrt(2 * kc - kc * kc));
+      T0 = jacobi_recurse(x, k, T(1), k_prime, 0, &T1, pol);
+   }
    *cn = cos(T0);
    *dn = cos(T0) / cos(T1 - T0);
    return sin(T0);
@@ -146,6 +205,64 @@ inline typename tools::promote_args<T, U, V>::type jacobi_elliptic(T k, U theta,
    return jacobi_elliptic(k, theta, pcn, pdn, policies::policy<>());
 }
 
+//
+// Evaluates sn, cn and dn for a fixed modulus k at many u.  The arithmetic-geometric
+// mean sequence, which depends only on k, is calculated once on construction, and
+// the results are the same as those of jacobi_elliptic.
+//
+template <class T, class Policy = policies::policy<> >
+class jacobi_elliptic_evaluator
+{
+public:
+   typedef typename tools::promote_args<T>::type result_type;
+
+   jacobi_elliptic_evaluator(T k, const Policy& pol = Policy())
+      : m_k(static_cast<value_type>(k)), m_agm(m_k > 1 ? value_type(1 / m_k) : m_k, forwarding_policy())
+   {
+      (void)pol;
+   }
+
+   result_type k()const { return static_cast<result_type>(m_k); }
+
+   result_type operator()(T u, result_type* pcn = 0, result_type* pdn = 0)const
+   {
+      BOOST_FPU_EXCEPTION_GUARD
+      static const char* function = "boost::math::jacobi_elliptic<%1%>(%1%)";
+
+      value_type sn, cn, dn;
+      sn = detail::jacobi_imp<value_type>(static_cast<value_type>(u), m_k, &cn, &dn, forwarding_policy(), function, m_agm.empty() ? 0 : &m_agm);
+      if(pcn)
+         *pcn = policies::checked_narrowing_cast<result_type, Policy>(cn, function);
+      if(pdn)
+         *pdn = policies::checked_narrowing_cast<result_type, Policy>(dn, function);
+      return policies::checked_narrowing_cast<result_type, Policy>(sn, function);
+   }
+
+   template <class InputIterator, class SnIterator, class CnIterator, class DnIterator>
+   void operator()(InputIterator first, InputIterator last, SnIterator sn, CnIterator cn, DnIterator dn)const
+   {
+      for(; first != last; ++first, ++sn, ++cn, ++dn)
+      {
+         result_type c, d;
+         *sn = (*this)(*first, &c, &d);
+         *cn = c;
+         *dn = d;
+      }
+   }
+
+private:
+   typedef typename policies::evaluation<result_type, Policy>::type value_type;
+   typedef typename policies::normalise<
+      Policy,
+      policies::promote_float<false>,
+      policies::promote_double<false>,
+      policies::discrete_quantile<>,
+      policies::assert_undefined<> >::type forwarding_policy;
+
+   value_type m_k;
+   detail::jacobi_agm_sequence<value_type> m_agm;
+};
+
 template <class U, class T, class Policy>
 inline typename tools::promote_args<T, U>::type jacobi_sn(U k, T theta, const Policy& pol)
 {
@@ -105,6 +105,7 @@
 #include <boost/math/tools/promotion.hpp>
 #include <boost/math/policies/error_handling.hpp>
 #include <boost/math/constants/constants.hpp>
+#include <vector>
 
 namespace boost{ namespace math{
 
@@ -195,6 +196,42 @@ _jacobi_theta_sum(RealType tau, RealType z_n, RealType z_increment, RealType eps
     return partial_result;
 }
 
+// The powers of the nome used by the q-series when tau >= 1, which depend only on
+// tau: exp(-tau*π*(n+1/2)²) for the first and second theta functions, and
+// exp(-tau*π*n²), n > 0, for the third and fourth, each up to the term at which
+// the series converges.
+template <class RealType>
+struct _jacobi_theta_nome_powers
+{
+    template <class Policy>
+    _jacobi_theta_nome_powers(RealType tau, const Policy&) {
+        BOOST_MATH_STD_USING
+        if (!(tau >= 1.0))
+            return;
+
+        RealType eps = policies::get_epsilon<RealType, Policy>();
+        RealType q_n = 0, last_q_n;
+        unsigned n = 0;
+        do {
+            last_q_n = q_n;
+            q_n = exp(-tau * constants::pi<RealType>() * RealType(n + 0.5)*RealType(n + 0.5));
+            half_odd.push_back(q_n);
+            n++;
+        } while (!_jacobi_theta_converged(last_q_n, q_n, eps));
+
+        q_n = 0;
+        n = 1;
+        do {
+            last_q_n = q_n;
+            q_n = exp(-tau * constants::pi<RealType>() * RealType(n)*RealType(n));
+            square.push_back(q_n);
+            n++;
+        } while (!_jacobi_theta_converged(last_q_n, q_n, eps));
+    }
+
+    std::vector<RealType> half_odd, square;
+};
+
 // The following _IMAGINARY theta functions assume imaginary z and are for
 // internal use only. They are designed to increase accuracy and reduce the
 // number of iterations required for convergence for large |q|. The z argument
@@ -284,7 +321,7 @@ _IMAGINARY_jacobi_theta4tau(RealType z, RealType tau, const Policy&) {
 // = 2 * Σ (-1)^n * exp(iπτ*(n+1/2)^2) * sin((2n+1)z)
 template <class RealType, class Policy>
 inline RealType
-jacobi_theta1tau_imp(RealType z, RealType tau, const Policy& pol, const char *function)
+jacobi_theta1tau_imp(RealType z, RealType tau, const Policy& pol, const char *function, const _jacobi_theta_nome_powers<RealType>* powers = 0)
 {
     BOOST_MATH_STD_USING
     unsigned n = 0;
@@ -312,7 +349,7 @@ jacobi_theta1tau_imp(RealType z, RealType tau, const Policy& pol, const char *fu
 
     do {
         last_q_n = q_n;
-        q_n = exp(-tau * constants::pi<RealType>() * RealType(n + 0.5)*RealType(n + 0.5) );
+        q_n = powers ? powers->half_odd[n] : exp(-tau * constants::pi<RealType>() * RealType(n + 0.5)*RealType(n + 0.5) );
         delta = q_n * sin(RealType(2*n+1)*z);
         if (n%2)
             delta = -delta;
@@ -341,7 +378,7 @@ jacobi_theta1_imp(RealType z, RealType q, const Policy& pol, const char *functio
 // = 2 * Σ exp(iπτ*(n+1/2)^2) * cos((2n+1)z)
 template <class RealType, class Policy>
 inline RealType
-jacobi_theta2tau_imp(RealType z, RealType tau, const Policy& pol, const char *function)
+jacobi_theta2tau_imp(RealType z, RealType tau, const Policy& pol, const char *function, const _jacobi_theta_nome_powers<RealType>* powers = 0)
 {
     BOOST_MATH_STD_USING
     unsigned n = 0;
@@ -367,7 +404,7 @@ jacobi_theta2tau_imp(RealType z, RealType tau, const Policy& pol, const char *fu
 
     do {
         last_q_n = q_n;
-        q_n = exp(-tau * constants::pi<RealType>() * RealType(n + 0.5)*RealType(n + 0.5));
+        q_n = powers ? powers->half_odd[n] : exp(-tau * constants::pi<RealType>() * RealType(n + 0.5)*RealType(n + 0.5));
         delta = q_n * cos(RealType(2*n+1)*z);
         result += delta + delta;
         n++;
@@ -395,7 +432,7 @@ jacobi_theta2_imp(RealType z, RealType q, const Policy& pol, const char *functio
 // = 2 * Σ exp(iπτ*(n)^2) * cos(2nz)
 template <class RealType, class Policy>
 inline RealType
-jacobi_theta3m1tau_imp(RealType z, RealType tau, const Policy& pol)
+jacobi_theta3m1tau_imp(RealType z, RealType tau, const Policy& pol, const _jacobi_theta_nome_powers<RealType>* powers = 0)
 {
     BOOST_MATH_STD_USING
 
@@ -408,7 +445,7 @@ jacobi_theta3m1tau_imp(RealType z, RealType tau, const Policy& pol)
 
     do {
         last_q_n = q_n;
-        q_n = exp(-tau * constants::pi<RealType>() * RealType(n)*RealType(n));
+        q_n = powers ? powers->square[n - 1] : exp(-tau * constants::pi<RealType>() * RealType(n)*RealType(n));
         delta = q_n * cos(RealType(2*n)*z);
         result += delta + delta;
         n++;
@@ -421,7 +458,7 @@ jacobi_theta3m1tau_imp(RealType z, RealType tau, const Policy& pol)
 // = 1 + 2 * Σ exp(iπτ*(n)^2) * cos(2nz)
 template <class RealType, class Policy>
 inline RealType
-jacobi_theta3tau_imp(RealType z, RealType tau, const Policy& pol, const char *function)
+jacobi_theta3tau_imp(RealType z, RealType tau, const Policy& pol, const char *function, const _jacobi_theta_nome_powers<RealType>* powers = 0)
 {
     BOOST_MATH_STD_USING
     if (tau <= 0.0) {
@@ -439,7 +476,7 @@ jacobi_theta3tau_imp(RealType z, RealType tau, const Policy& pol, const char *fu
         }
         return _IMAGINARY_jacobi_theta3tau(z, RealType(1/tau), pol);
     }
-    return RealType(1) + jacobi_theta3m1tau_imp(z, tau, pol);
+    return RealType(1) + jacobi_theta3m1tau_imp(z, tau, pol, powers);
 }
 
 // Third Jacobi theta function, minus one (parameterized by q)
@@ -473,7 +510,7 @@ jacobi_theta3_imp(RealType z, RealType q, const Policy& pol, const char *functio
 // = 2 * Σ (-1)^n exp(iπτ*(n)^2) * cos(2nz)
 template <class RealType, class Policy>
 inline RealType
-jacobi_theta4m1tau_imp(RealType z, RealType tau, const Policy& pol)
+jacobi_theta4m1tau_imp(RealType z, RealType tau, const Policy& pol, const _jacobi_theta_nome_powers<RealType>* powers = 0)
 {
     BOOST_MATH_STD_USING
 
@@ -486,7 +523,7 @@ jacobi_theta4m1tau_imp(RealType z, RealType tau, const Policy& pol)
 
     do {
         last_q_n = q_n;
-        q_n = exp(-tau * constants::pi<RealType>() * RealType(n)*RealType(n));
+        q_n = powers ? powers->square[n - 1] : exp(-tau * constants::pi<RealType>() * RealType(n)*RealType(n));
         delta = q_n * cos(RealType(2*n)*z);
         if (n%2)
             delta = -delta;
@@ -502,7 +539,7 @@ jacobi_theta4m1tau_imp(RealType z, RealType tau, const Policy& pol)
 // = 1 + 2 * Σ (-1)^n exp(iπτ*(n)^2) * cos(2nz)
 template <class RealType, class Policy>
 inline RealType
-jacobi_theta4tau_imp(RealType z, RealType tau, const Policy& pol, const char *function)
+jacobi_theta4tau_imp(RealType z, RealType tau, const Policy& pol, const char *function, const _jacobi_theta_nome_powers<RealType>* powers = 0)
 {
     BOOST_MATH_STD_USING
     if (tau <= 0.0) {
@@ -521,7 +558,7 @@ jacobi_theta4tau_imp(RealType z, RealType tau, const Policy& pol, const char *fu
         return _IMAGINARY_jacobi_theta2tau(z, RealType(1/tau), pol);
     }
 
-    return RealType(1) + jacobi_theta4m1tau_imp(z, tau, pol);
+    return RealType(1) + jacobi_theta4m1tau_imp(z, tau, pol, powers);
 }
 
 // Fourth Jacobi theta function, minus one (Parameterized by q)
@@ -551,6 +588,47 @@ jacobi_theta4_imp(RealType z, RealType q, const Policy& pol, const char *functio
     return jacobi_theta4tau_imp(z, RealType(-log(q)/constants::pi<RealType>()), pol, function);
 }
 
+// All four Jacobi theta functions (Parameterized by tau) in one pass. For tau >= 1
+// the first and second share the sines and cosines of (2n+1)z and the third and
+// fourth the terms q^n² * cos(2nz), so that the results are those of the separate
+// functions; otherwise the separate functions are called.
+template <class RealType, class Policy>
+inline void
+jacobi_theta_all_tau_imp(RealType z, RealType tau, RealType* theta1, RealType* theta2, RealType* theta3, RealType* theta4,
+        const Policy& pol, const _jacobi_theta_nome_powers<RealType>& powers)
+{
+    BOOST_MATH_STD_USING
+    if (powers.half_odd.empty()) {
+        *theta1 = jacobi_theta1tau_imp(z, tau, pol, "boost::math::jacobi_theta1tau<%1%>(%1%)");
+        *theta2 = jacobi_theta2tau_imp(z, tau, pol, "boost::math::jacobi_theta2tau<%1%>(%1%)");
+        *theta3 = jacobi_theta3tau_imp(z, tau, pol, "boost::math::jacobi_theta3tau<%1%>(%1%)");
+        *theta4 = jacobi_theta4tau_imp(z, tau, pol, "boost::math::jacobi_theta4tau<%1%>(%1%)");
+        return;
+    }
+
+    RealType delta, result1 = 0, result2 = 0, result3 = 0, result4 = 0;
+    for (unsigned n = 0; n < powers.half_odd.size(); n++) {
+        RealType q_n = powers.half_odd[n];
+        delta = q_n * sin(RealType(2*n+1)*z);
+        if (n%2)
+            delta = -delta;
+        result1 += delta + delta;
+        delta = q_n * cos(RealType(2*n+1)*z);
+        result2 += delta + delta;
+    }
+    for (unsigned n = 1; n <= powers.square.size(); n++) {
+        delta = powers.square[n - 1] * cos(RealType(2*n)*z);
+        result3 += delta + delta;
+        if (n%2)
+            delta = -delta;
+        result4 += delta + delta;
+    }
+    *theta1 = abs(z) == 0.0 ? RealType(0) : result1;
+    *theta2 = result2;
+    *theta3 = RealType(1) + result3;
+    *theta4 = RealType(1) + result4;
+}
+
 // Begin public API
 
 template <class T, class U, class Policy>
@@ -830,6 +908,121 @@ inline typename tools::promote_args<T, U>::type jacobi_theta4(T z, U q) {
     return jacobi_theta4(z, q, policies::policy<>());
 }
 
+// Evaluates the Jacobi theta functions for a fixed tau at many z. The powers of
+// the nome, which depend only on tau, are calculated once on construction, and the
+// results are the same as those of the tau functions above. For a fixed q use
+// tau = -log(q)/π, as the q functions do.
+template <class T, class Policy = policies::policy<> >
+class jacobi_theta_evaluator
+{
+public:
+    typedef typename tools::promote_args<T>::type result_type;
+
+    jacobi_theta_evaluator(T tau, const Policy& pol = Policy())
+        : m_tau(static_cast<result_type>(tau)), m_powers(m_tau, forwarding_policy()) {
+        (void)pol;
+    }
+
+    result_type tau() const { return m_tau; }
+
+    result_type theta1(T z) const {
+        BOOST_FPU_EXCEPTION_GUARD
+        static const char* function = "boost::math::jacobi_theta1tau<%1%>(%1%)";
+        return policies::checked_narrowing_cast<result_type, Policy>(
+                jacobi_theta1tau_imp(static_cast<result_type>(z), m_tau, forwarding_policy(), function, powers()), function);
+    }
+
+    result_type theta2(T z) const {
+        BOOST_FPU_EXCEPTION_GUARD
+        static const char* function = "boost::math::jacobi_theta2tau<%1%>(%1%)";
+        return policies::checked_narrowing_cast<result_type, Policy>(
+                jacobi_theta2tau_imp(static_cast<result_type>(z), m_tau, forwarding_policy(), function, powers()), function);
+    }
+
+    result_type theta3(T z) const {
+        BOOST_FPU_EXCEPTION_GUARD
+        static const char* function = "boost::math::jacobi_theta3tau<%1%>(%1%)";
+        return policies::checked_narrowing_cast<result_type, Policy>(
+                jacobi_theta3tau_imp(static_cast<result_type>(z), m_tau, forwarding_policy(), function, powers()), function);
+    }
+
+    result_type theta4(T z) const {
+        BOOST_FPU_EXCEPTION_GUARD
+        static const char* function = "boost::math::jacobi_theta4tau<%1%>(%1%)";
+        return policies::checked_narrowing_cast<result_type, Policy>(
+                jacobi_theta4tau_imp(static_cast<result_type>(z), m_tau, forwarding_policy(), function, powers()), function);
+    }
+
+    result_type theta3m1(T z) const {
+        BOOST_FPU_EXCEPTION_GUARD
+        static const char* function = "boost::math::jacobi_theta3m1tau<%1%>(%1%)";
+        return policies::checked_narrowing_cast<result_type, Policy>(
+                jacobi_theta3m1tau_imp(static_cast<result_type>(z), m_tau, forwarding_policy(), powers()), function);
+    }
+
+    result_type theta4m1(T z) const {
+        BOOST_FPU_EXCEPTION_GUARD
+        static const char* function = "boost::math::jacobi_theta4m1tau<%1%>(%1%)";
+        return policies::checked_narrowing_cast<result_type, Policy>(
+                jacobi_theta4m1tau_imp(static_cast<result_type>(z), m_tau, forwarding_policy(), powers()), function);
+    }
+
+    // All four theta functions at z in one pass:
+    void operator()(T z, result_type* theta1, result_type* theta2, result_type* theta3, result_type* theta4) const {
+        BOOST_FPU_EXCEPTION_GUARD
+        static const char* function = "boost::math::jacobi_theta_evaluator<%1%>(%1%)";
+        result_type t1, t2, t3, t4;
+        jacobi_theta_all_tau_imp(static_cast<result_type>(z), m_tau, &t1, &t2, &t3, &t4, forwarding_policy(), m_powers);
+        *theta1 = policies::checked_narrowing_cast<result_type, Policy>(t1, function);
+        *theta2 = policies::checked_narrowing_cast<result_type, Policy>(t2, function);
+        *theta3 = policies::checked_narrowing_cast<result_type, Policy>(t3, function);
+        *theta4 = policies::checked_narrowing_cast<result_type, Policy>(t4, function);
+    }
+
+    template <class InputIterator, class OutputIterator>
+    OutputIterator theta1(InputIterator first, InputIterator last, OutputIterator out) const {
+        for (; first != last; ++first, ++out)
+            *out = theta1(*first);
+        return out;
+    }
+
+    template <class InputIterator, class OutputIterator>
+    OutputIterator theta2(InputIterator first, InputIterator last, OutputIterator out) const {
+        for (; first != last; ++first, ++out)
+            *out = theta2(*first);
+        return out;
+    }
+
+    template <class InputIterator, class OutputIterator>
+    OutputIterator theta3(InputIterator first, InputIterator last, OutputIterator out) const {
+        for (; first != last; ++first, ++out)
+            *out = theta3(*first);
+        return out;
+    }
+
+    template <class InputIterator, class OutputIterator>
+    OutputIterator theta4(InputIterator first, InputIterator last, OutputIterator out) const {
+        for (; first != last; ++first, ++out)
+            *out = theta4(*first);
+        return out;
+    }
+
+private:
+    typedef typename policies::normalise<
+        Policy,
+        policies::promote_float<false>,
+        policies::promote_double<false>,
+        policies::discrete_quantile<>,
+        policies::assert_undefined<> >::type forwarding_policy;
+
+    const _jacobi_theta_nome_powers<result_type>* powers() const {
+        return m_powers.half_odd.empty() ? 0 : &m_powers;
+    }
+
+    result_type m_tau;
+    _jacobi_theta_nome_powers<result_type> m_powers;
+};
+
 }}
 
 #endif
@@ -68,6 +68,7 @@ BOOST_MATH_INSTRUMENT_LAMBERT_W_SMALL_Z_SERIES_ITERATIONS  // Show evaluation of
 #include <cmath>
 #include <limits>
 #include <exception>
+#include <cstddef>
 
 // Needed for testing and diagnostics only.
 #include <iostream>
@@ -2115,6 +2116,50 @@ T lambert_wm1_imp(const T z, const Policy&  pol)
     return lambert_w_detail::lambert_wm1_imp(result_type(z), policies::policy<>());
   } // lambert_wm1(T z)
 
+  //! Lambert W0 of each of z[0] ... z[count-1], written to w[0] ... w[count-1], using User-defined policy.
+  //! The values are exactly those of lambert_w0(z[i], pol).
+  template <class T, class Policy>
+  inline void lambert_w0(const T* z, std::size_t count, T* w, const Policy& pol)
+  {
+    // Select the implementation on precision once, as the scalar function does:
+    typedef typename policies::precision<T, Policy>::type precision_type;
+    typedef boost::integral_constant<int,
+      (precision_type::value == 0) || (precision_type::value > 53) ?
+        0  // either variable precision (0), or greater than 64-bit precision.
+      : (precision_type::value <= 24) ? 1 // 32-bit (probably float) precision.
+      : 2  // 64-bit (probably double) precision.
+      > tag_type;
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      w[i] = lambert_w_detail::lambert_w0_imp(z[i], pol, tag_type());
+    }
+  } // lambert_w0(const T* z, std::size_t count, T* w, const Policy& pol)
+
+  //! Lambert W0 of an array using default policy.
+  template <class T>
+  inline void lambert_w0(const T* z, std::size_t count, T* w)
+  {
+    lambert_w0(z, count, w, policies::policy<>());
+  } // lambert_w0(const T* z, std::size_t count, T* w)
+
+  //! Lambert W-1 of each of z[0] ... z[count-1], written to w[0] ... w[count-1], using User-defined policy.
+  //! The values are exactly those of lambert_wm1(z[i], pol).
+  template <class T, class Policy>
+  inline void lambert_wm1(const T* z, std::size_t count, T* w, const Policy& pol)
+  {
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      w[i] = lambert_w_detail::lambert_wm1_imp(z[i], pol);
+    }
+  } // lambert_wm1(const T* z, std::size_t count, T* w, const Policy& pol)
+
+  //! Lambert W-1 of an array using default policy.
+  template <class T>
+  inline void lambert_wm1(const T* z, std::size_t count, T* w)
+  {
+    lambert_wm1(z, count, w, policies::policy<>());
+  } // lambert_wm1(const T* z, std::size_t count, T* w)
+
   // First derivative of Lambert W0 and W-1.
   template <class T, class Policy>
   inline typename tools::promote_args<T>::type
@@ -152,6 +152,10 @@ namespace boost
    T binomial_coefficient(unsigned n, unsigned k, const Policy& pol);
    template <class T>
    T binomial_coefficient(unsigned n, unsigned k);
+   template <class T, class OutputIterator, class Policy>
+   OutputIterator binomial_coefficient_row(unsigned n, OutputIterator out, const Policy& pol);
+   template <class T, class OutputIterator>
+   OutputIterator binomial_coefficient_row(unsigned n, OutputIterator out);
 
    // erf & erfc error functions.
    template <class RT> // Error function.
@@ -424,6 +428,10 @@ namespace boost
    template <class RT, class Policy>
    RT factorial(unsigned int, const Policy& pol);
    template <class RT>
+   RT log_factorial(unsigned int);
+   template <class RT, class Policy>
+   RT log_factorial(unsigned int, const Policy& pol);
+   template <class RT>
    RT unchecked_factorial(unsigned int BOOST_MATH_APPEND_EXPLICIT_TEMPLATE_TYPE(RT));
    template <class RT>
    RT double_factorial(unsigned i);
@@ -934,6 +942,24 @@ namespace boost
    template <class T1, class T2>
    typename tools::promote_args<T1, T2>::type owens_t(T1 h, T2 a);
 
+   template <class T, class Policy>
+   void owens_t(const T* h, const T* a, std::size_t count, T* result, const Policy& pol);
+
+   template <class T>
+   void owens_t(const T* h, const T* a, std::size_t count, T* result);
+
+   template <class T1, class T2, class T3, class Policy>
+   typename tools::promote_args<T1, T2, T3>::type bivariate_normal_cdf(T1 h, T2 k, T3 rho, const Policy& pol);
+
+   template <class T1, class T2, class T3>
+   typename tools::promote_args<T1, T2, T3>::type bivariate_normal_cdf(T1 h, T2 k, T3 rho);
+
+   template <class T, class Policy>
+   void bivariate_normal_cdf(const T* h, const T* k, T rho, std::size_t count, T* result, const Policy& pol);
+
+   template <class T>
+   void bivariate_normal_cdf(const T* h, const T* k, T rho, std::size_t count, T* result);
+
    // Jacobi Functions:
    template <class T, class U, class V, class Policy>
    typename tools::promote_args<T, U, V>::type jacobi_elliptic(T k, U theta, V* pcn, V* pdn, const Policy&);
@@ -1090,6 +1116,12 @@ namespace boost
    template <class T>
    typename tools::promote_args<T>::type zeta(T s);
 
+   template <class T1, class T2, class Policy>
+   typename tools::promote_args<T1, T2>::type hurwitz_zeta(T1 s, T2 a, const Policy&);
+
+   template <class T1, class T2>
+   typename tools::promote_args<T1, T2>::type hurwitz_zeta(T1 s, T2 a);
+
    // pow:
    template <int N, typename T, class Policy>
    BOOST_CXX14_CONSTEXPR typename tools::promote_args<T>::type pow(T base, const Policy& policy);
@@ -1168,6 +1200,14 @@ namespace boost
    template <class T>
    typename boost::math::tools::promote_args<T>::type lambert_wm1(T z);
    template <class T, class Policy>
+   void lambert_w0(const T* z, std::size_t count, T* w, const Policy& pol);
+   template <class T>
+   void lambert_w0(const T* z, std::size_t count, T* w);
+   template <class T, class Policy>
+   void lambert_wm1(const T* z, std::size_t count, T* w, const Policy& pol);
+   template <class T>
+   void lambert_wm1(const T* z, std::size_t count, T* w);
+   template <class T, class Policy>
    typename boost::math::tools::promote_args<T>::type lambert_w0_prime(T z, const Policy& pol);
    template <class T>
    typename boost::math::tools::promote_args<T>::type lambert_w0_prime(T z);
@@ -1281,6 +1321,7 @@ namespace boost
    ibeta_derivative(RT1 a, RT2 b, RT3 x){ return ::boost::math::ibeta_derivative(a, b, x, Policy()); }\
 \
    template <class T> T binomial_coefficient(unsigned n, unsigned k){ return ::boost::math::binomial_coefficient<T, Policy>(n, k, Policy()); }\
+   template <class T, class OutputIterator> OutputIterator binomial_coefficient_row(unsigned n, OutputIterator out){ return ::boost::math::binomial_coefficient_row<T>(n, out, Policy()); }\
 \
    template <class RT>\
    inline typename boost::math::tools::promote_args<RT>::type erf(RT z) { return ::boost::math::erf(z, Policy()); }\
@@ -1412,6 +1453,8 @@ namespace boost
    using boost::math::max_factorial;\
    template <class RT>\
    inline RT factorial(unsigned int i) { return boost::math::factorial<RT>(i, Policy()); }\
+   template <class RT>\
+   inline RT log_factorial(unsigned int i) { return boost::math::log_factorial<RT>(i, Policy()); }\
    using boost::math::unchecked_factorial;\
    template <class RT>\
    inline RT double_factorial(unsigned i){ return boost::math::double_factorial<RT>(i, Policy()); }\
@@ -1608,6 +1651,9 @@ template <class OutputIterator, class T>\
    template <class T>\
    inline typename boost::math::tools::promote_args<T>::type zeta(T s){ return boost::math::zeta(s, Policy()); }\
    \
+   template <class T1, class T2>\
+   inline typename boost::math::tools::promote_args<T1, T2>::type hurwitz_zeta(T1 s, T2 a){ return boost::math::hurwitz_zeta(s, a, Policy()); }\
+   \
    template <class T>\
    inline T round(const T& v){ using boost::math::round; return round(v, Policy()); }\
    \
@@ -1646,6 +1692,10 @@ template <class OutputIterator, class T>\
    \
    template <class RT1, class RT2>\
    inline typename boost::math::tools::promote_args<RT1, RT2>::type owens_t(RT1 a, RT2 z){ return boost::math::owens_t(a, z, Policy()); }\
+   template <class T> inline void owens_t(const T* h, const T* a, std::size_t count, T* result) { boost::math::owens_t(h, a, count, result, Policy()); }\
+   template <class T1, class T2, class T3>\
+   inline typename boost::math::tools::promote_args<T1, T2, T3>::type bivariate_normal_cdf(T1 h, T2 k, T3 rho){ return boost::math::bivariate_normal_cdf(h, k, rho, Policy()); }\
+   template <class T> inline void bivariate_normal_cdf(const T* h, const T* k, T rho, std::size_t count, T* result) { boost::math::bivariate_normal_cdf(h, k, rho, count, result, Policy()); }\
    \
    template <class T1, class T2>\
    inline std::complex<typename boost::math::detail::bessel_traits<T1, T2, Policy >::result_type> cyl_hankel_1(T1 v, T2 x)\
@@ -1809,6 +1859,8 @@ template <class OutputIterator, class T>\
    \
    template <class T> inline typename boost::math::tools::promote_args<T>::type lambert_w0(T z) { return boost::math::lambert_w0(z, Policy()); }\
    template <class T> inline typename boost::math::tools::promote_args<T>::type lambert_wm1(T z) { return boost::math::lambert_w0(z, Policy()); }\
+   template <class T> inline void lambert_w0(const T* z, std::size_t count, T* w) { boost::math::lambert_w0(z, count, w, Policy()); }\
+   template <class T> inline void lambert_wm1(const T* z, std::size_t count, T* w) { boost::math::lambert_wm1(z, count, w, Policy()); }\
    template <class T> inline typename boost::math::tools::promote_args<T>::type lambert_w0_prime(T z) { return boost::math::lambert_w0(z, Policy()); }\
    template <class T> inline typename boost::math::tools::promote_args<T>::type lambert_wm1_prime(T z) { return boost::math::lambert_w0(z, Policy()); }\
    \
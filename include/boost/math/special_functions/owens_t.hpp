@@ -25,6 +25,7 @@
 #include <boost/math/constants/constants.hpp>
 #include <boost/math/tools/big_constant.hpp>
 
+#include <cstddef>
 #include <stdexcept>
 
 #ifdef BOOST_MSVC
@@ -1054,6 +1055,67 @@ namespace boost
          template <class T, class Policy, class tag>
          const typename owens_t_initializer<T, Policy, tag>::init owens_t_initializer<T, Policy, tag>::initializer;
 
+         // T(x, (y - rho*x) / (x*s)), one of the two Owen's T terms of the bivariate
+         // normal distribution, including its limit as x -> 0:
+         template<typename RealType, class Policy>
+         inline RealType bivariate_normal_owens_t_term(const RealType x, const RealType y, const RealType rho, const RealType s, const Policy& pol)
+         {
+            if(x == 0)
+               return y > 0 ? RealType(0.25f) : y < 0 ? RealType(-0.25f) : RealType(0);
+            return owens_t(x, RealType((y - rho * x) / (x * s)), pol);
+         }
+
+         // P(X <= h, Y <= k) for standard normal X and Y with correlation rho,
+         // and s = sqrt(1 - rho^2), from Owen (1956) equation 3.1:
+         //
+         // P = (G(h) + G(k)) / 2 - T(h, (k - rho h) / (h s)) - T(k, (h - rho k) / (k s)) - beta
+         //
+         // where G is the standard normal distribution, and beta is 1/2 when hk < 0, or
+         // hk = 0 and h + k < 0, and zero otherwise.
+         template<typename RealType, class Policy>
+         RealType bivariate_normal_cdf_imp(RealType h, RealType k, const RealType rho, const RealType s, const Policy& pol)
+         {
+            BOOST_MATH_STD_USING
+            static const char* function = "boost::math::bivariate_normal_cdf<%1%>(%1%,%1%,%1%)";
+            if(!(fabs(rho) <= 1))
+               return policies::raise_domain_error<RealType>(function, "Correlation coefficient must be in the range [-1, 1] but got %1%.", rho, pol);
+            if((boost::math::isnan)(h))
+               return policies::raise_domain_error<RealType>(function, "Random variate h must be finite or infinite, but got %1%.", h, pol);
+            if((boost::math::isnan)(k))
+               return policies::raise_domain_error<RealType>(function, "Random variate k must be finite or infinite, but got %1%.", k, pol);
+            if((h <= -tools::max_value<RealType>()) || (k <= -tools::max_value<RealType>()))
+               return 0;
+            if(h >= tools::max_value<RealType>())
+               return owens_t_znorm2(RealType(-k), pol);
+            if(k >= tools::max_value<RealType>())
+               return owens_t_znorm2(RealType(-h), pol);
+            if(rho == 1)
+               return owens_t_znorm2(RealType(-(std::min)(h, k)), pol);
+            if(rho == -1)
+               return h + k > 0 ? RealType(owens_t_znorm2(RealType(-h), pol) - owens_t_znorm2(k, pol)) : RealType(0);
+            if(rho == 0)
+               return owens_t_znorm2(RealType(-h), pol) * owens_t_znorm2(RealType(-k), pol);
+            if((h == 0) && (k == 0))
+               return RealType(0.25f) + asin(rho) * constants::one_div_two_pi<RealType>();
+            // The result is symmetric in h and k, and is calculated so exactly:
+            if(h > k)
+               std::swap(h, k);
+            if((h < 0) && (k > 0))
+            {
+               // beta would be 1/2, and the result small compared to the terms
+               // that cancel to give it, so use P(h, k, rho) = G(h) - P(h, -k, -rho):
+               RealType p = owens_t_znorm2(RealType(-h), pol)
+                  - bivariate_normal_cdf_imp(h, RealType(-k), RealType(-rho), s, pol);
+               return p < 0 ? RealType(0) : p;
+            }
+            RealType p = (owens_t_znorm2(RealType(-h), pol) + owens_t_znorm2(RealType(-k), pol)) / 2
+               - bivariate_normal_owens_t_term(h, k, rho, s, pol)
+               - bivariate_normal_owens_t_term(k, h, rho, s, pol);
+            if((h + k < 0) && ((h == 0) || (k == 0)))
+               p -= constants::half<RealType>();
+            return p < 0 ? RealType(0) : p > 1 ? RealType(1) : p;
+         }
+
       } // namespace detail
 
       template <class T1, class T2, class Policy>
@@ -1078,6 +1140,99 @@ namespace boost
          return owens_t(h, a, policies::policy<>());
       }
 
+      // Owen's T of each of (h[0], a[0]) ... (h[count-1], a[count-1]), written to
+      // result[0] ... result[count-1]; the values are exactly those of owens_t(h[i], a[i], pol).
+      template <class T, class Policy>
+      inline void owens_t(const T* h, const T* a, std::size_t count, T* result, const Policy& pol)
+      {
+         typedef typename policies::evaluation<T, Policy>::type value_type;
+         typedef typename policies::precision<value_type, Policy>::type precision_type;
+         typedef boost::integral_constant<int,
+            precision_type::value <= 0 ? 0 :
+            precision_type::value <= 64 ? 64 : 65
+         > tag_type;
+
+         detail::owens_t_initializer<T, Policy, tag_type>::force_instantiate();
+
+         for(std::size_t i = 0; i < count; ++i)
+            result[i] = policies::checked_narrowing_cast<T, Policy>(detail::owens_t(static_cast<value_type>(h[i]), static_cast<value_type>(a[i]), pol), "boost::math::owens_t<%1%>(%1%,%1%)");
+      }
+
+      template <class T>
+      inline void owens_t(const T* h, const T* a, std::size_t count, T* result)
+      {
+         owens_t(h, a, count, result, policies::policy<>());
+      }
+
+      // The bivariate normal distribution: P(X <= h, Y <= k) for standard normal
+      // X and Y with correlation rho.
+      template <class T1, class T2, class T3, class Policy>
+      inline typename tools::promote_args<T1, T2, T3>::type bivariate_normal_cdf(T1 h, T2 k, T3 rho, const Policy&)
+      {
+         BOOST_FPU_EXCEPTION_GUARD
+         BOOST_MATH_STD_USING
+         typedef typename tools::promote_args<T1, T2, T3>::type result_type;
+         typedef typename policies::evaluation<result_type, Policy>::type value_type;
+         typedef typename policies::normalise<
+            Policy,
+            policies::promote_float<false>,
+            policies::promote_double<false>,
+            policies::discrete_quantile<>,
+            policies::assert_undefined<> >::type forwarding_policy;
+         typedef typename policies::precision<value_type, Policy>::type precision_type;
+         typedef boost::integral_constant<int,
+            precision_type::value <= 0 ? 0 :
+            precision_type::value <= 64 ? 64 : 65
+         > tag_type;
+
+         detail::owens_t_initializer<value_type, forwarding_policy, tag_type>::force_instantiate();
+
+         const value_type r = static_cast<value_type>(rho);
+         const value_type s = sqrt((1 - r) * (1 + r));
+         return policies::checked_narrowing_cast<result_type, forwarding_policy>(detail::bivariate_normal_cdf_imp(static_cast<value_type>(h), static_cast<value_type>(k), r, s, forwarding_policy()), "boost::math::bivariate_normal_cdf<%1%>(%1%,%1%,%1%)");
+      }
+
+      template <class T1, class T2, class T3>
+      inline typename tools::promote_args<T1, T2, T3>::type bivariate_normal_cdf(T1 h, T2 k, T3 rho)
+      {
+         return bivariate_normal_cdf(h, k, rho, policies::policy<>());
+      }
+
+      // The bivariate normal distribution at each of (h[0], k[0]) ... (h[count-1], k[count-1])
+      // for a single correlation rho, written to result[0] ... result[count-1]; the values are
+      // exactly those of bivariate_normal_cdf(h[i], k[i], rho, pol).
+      template <class T, class Policy>
+      inline void bivariate_normal_cdf(const T* h, const T* k, T rho, std::size_t count, T* result, const Policy&)
+      {
+         BOOST_FPU_EXCEPTION_GUARD
+         BOOST_MATH_STD_USING
+         typedef typename policies::evaluation<T, Policy>::type value_type;
+         typedef typename policies::normalise<
+            Policy,
+            policies::promote_float<false>,
+            policies::promote_double<false>,
+            policies::discrete_quantile<>,
+            policies::assert_undefined<> >::type forwarding_policy;
+         typedef typename policies::precision<value_type, Policy>::type precision_type;
+         typedef boost::integral_constant<int,
+            precision_type::value <= 0 ? 0 :
+            precision_type::value <= 64 ? 64 : 65
+         > tag_type;
+
+         detail::owens_t_initializer<value_type, forwarding_policy, tag_type>::force_instantiate();
+
+         const value_type r = static_cast<value_type>(rho);
+         const value_type s = sqrt((1 - r) * (1 + r));
+         for(std::size_t i = 0; i < count; ++i)
+            result[i] = policies::checked_narrowing_cast<T, forwarding_policy>(detail::bivariate_normal_cdf_imp(static_cast<value_type>(h[i]), static_cast<value_type>(k[i]), r, s, forwarding_policy()), "boost::math::bivariate_normal_cdf<%1%>(%1%,%1%,%1%)");
+      }
+
+      template <class T>
+      inline void bivariate_normal_cdf(const T* h, const T* k, T rho, std::size_t count, T* result)
+      {
+         bivariate_normal_cdf(h, k, rho, count, result, policies::policy<>());
+      }
+
 
    } // namespace math
 } // namespace boost
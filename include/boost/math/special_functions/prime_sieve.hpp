@@ -0,0 +1,551 @@
+// Copyright 2026 agent
+//
+// Use, modification and distribution are subject to the
+// Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt
+// or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_SF_PRIME_SIEVE_HPP
+#define BOOST_MATH_SF_PRIME_SIEVE_HPP
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#include <boost/config.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/type_traits/is_integral.hpp>
+#include <boost/math/special_functions/prime.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <vector>
+#if !defined(BOOST_NO_CXX17_HDR_EXECUTION) && !defined(BOOST_NO_CXX17_IF_CONSTEXPR)
+#include <execution>
+#include <type_traits>
+#endif
+
+namespace boost{ namespace math{
+
+namespace detail{
+
+//
+// Deterministic Miller-Rabin test of 64-bit integers.  (a * b) % m without overflow:
+//
+inline boost::uint64_t prime_mulmod(boost::uint64_t a, boost::uint64_t b, boost::uint64_t m)
+{
+#ifdef BOOST_HAS_INT128
+   return static_cast<boost::uint64_t>((static_cast<boost::uint128_type>(a) * b) % m);
+#else
+   if((m >> 32) == 0)
+      return (a * b) % m;
+   // Double and add, with a, b < m:
+   boost::uint64_t result = 0;
+   while(b)
+   {
+      if(b & 1)
+         result = result >= m - a ? result - (m - a) : result + a;
+      a = a >= m - a ? a - (m - a) : a + a;
+      b >>= 1;
+   }
+   return result;
+#endif
+}
+
+inline boost::uint64_t prime_powmod(boost::uint64_t a, boost::uint64_t e, boost::uint64_t m)
+{
+   boost::uint64_t result = 1;
+   while(e)
+   {
+      if(e & 1)
+         result = prime_mulmod(result, a, m);
+      a = prime_mulmod(a, a, m);
+      e >>= 1;
+   }
+   return result;
+}
+
+//
+// True if odd n > a is a strong probable prime to base a, where n - 1 = d 2^s with d odd:
+//
+inline bool is_strong_probable_prime(boost::uint64_t n, boost::uint64_t a, boost::uint64_t d, unsigned s)
+{
+   boost::uint64_t x = prime_powmod(a, d, n);
+   if((x == 1) || (x == n - 1))
+      return true;
+   for(unsigned r = 1; r < s; ++r)
+   {
+      x = prime_mulmod(x, x, n);
+      if(x == n - 1)
+         return true;
+   }
+   return false;
+}
+
+inline bool is_prime_imp(boost::uint64_t n)
+{
+   //
+   // The first i + 1 primes as bases are enough for n below the i'th bound:
+   // these are the smallest strong pseudoprimes to those bases, see
+   // http://oeis.org/A014233.  The first 12 primes suffice for every 64-bit n.
+   //
+   static const boost::uint32_t bases[] = { 2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37 };
+   static const boost::uint64_t bounds[] = {
+      2047uLL, 1373653uLL, 25326001uLL, 3215031751uLL, 2152302898747uLL, 3474749660383uLL,
+      341550071728321uLL, 341550071728321uLL, 3825123056546413051uLL, 3825123056546413051uLL, 3825123056546413051uLL,
+   };
+   if(n < 2)
+      return false;
+   for(unsigned i = 0; i < sizeof(bases) / sizeof(bases[0]); ++i)
+   {
+      if(n % bases[i] == 0)
+         return n == bases[i];
+   }
+   if(n < 41 * 41)
+      return true;
+   boost::uint64_t d = n - 1;
+   unsigned s = 0;
+   while((d & 1) == 0)
+   {
+      d >>= 1;
+      ++s;
+   }
+   for(unsigned i = 0; i < sizeof(bases) / sizeof(bases[0]); ++i)
+   {
+      if(!is_strong_probable_prime(n, bases[i], d, s))
+         return false;
+      if((i < sizeof(bounds) / sizeof(bounds[0])) && (n < bounds[i]))
+         break;
+   }
+   return true;
+}
+
+// Largest r with r * r <= n:
+inline boost::uint64_t prime_sieve_isqrt(boost::uint64_t n)
+{
+   boost::uint64_t r = static_cast<boost::uint64_t>(std::sqrt(static_cast<double>(n)));
+   if(r > 0xFFFFFFFFuLL)
+      r = 0xFFFFFFFFuLL;
+   while(r * r > n)
+      --r;
+   while((r < 0xFFFFFFFFuLL) && ((r + 1) * (r + 1) <= n))
+      ++r;
+   return r;
+}
+
+// Negative values are no different from zero:
+template <class Integer>
+inline boost::uint64_t prime_sieve_bound(Integer x)
+{
+   BOOST_STATIC_ASSERT_MSG(boost::is_integral<Integer>::value && (sizeof(Integer) <= sizeof(boost::uint64_t)), "The primes are found for integer types of at most 64 bits.");
+   return x > 0 ? static_cast<boost::uint64_t>(x) : 0;
+}
+
+//
+// One segment of the sieve is small enough to stay in the level 1 data cache.
+// Only odd numbers are stored, one to a byte:
+//
+static const std::size_t prime_sieve_segment_size = 32768;
+
+//
+// The multiples of 3, 5, 7, 11 and 13 repeat every 15015 odd numbers, and are copied
+// into each segment rather than crossed off.  Element k is set if 2k + 1 is one:
+//
+static const unsigned prime_sieve_presieved = 5;
+static const std::size_t prime_sieve_pattern_size = 3 * 5 * 7 * 11 * 13;
+
+inline const std::vector<unsigned char>& prime_sieve_pattern()
+{
+   static const std::vector<unsigned char> pattern = []()
+   {
+      std::vector<unsigned char> result(prime_sieve_pattern_size, 0);
+      for(unsigned p : { 3u, 5u, 7u, 11u, 13u })
+      {
+         for(std::size_t k = p / 2; k < prime_sieve_pattern_size; k += p)
+            result[k] = 1;
+      }
+      return result;
+   }();
+   return pattern;
+}
+
+//
+// Sieves the odd numbers in [lower, upper), lower odd and at least 3, a segment at
+// a time, with the odd primes up to sqrt(upper - 1) in *base.  If base is null, each
+// number is tested by is_prime_imp instead.
+//
+class prime_sieve_segments
+{
+public:
+   prime_sieve_segments(boost::uint64_t lower, boost::uint64_t upper, const std::vector<boost::uint32_t>* base)
+      : m_next(lower), m_upper(upper), m_low(lower), m_base(base) {}
+
+   // Sieves the next segment, and returns false if there are none left:
+   bool next()
+   {
+      if(m_next >= m_upper)
+         return false;
+      m_low = m_next;
+      boost::uint64_t remaining = (m_upper - m_low + 1) / 2;
+      std::size_t size = remaining < prime_sieve_segment_size ? static_cast<std::size_t>(remaining) : prime_sieve_segment_size;
+      m_next = size == remaining ? m_upper : m_low + 2 * size;
+      m_composite.resize(size);
+      if(m_base)
+         sieve();
+      else
+      {
+         for(std::size_t i = 0; i < size; ++i)
+            m_composite[i] = !is_prime_imp(m_low + 2 * i);
+      }
+      return true;
+   }
+   // After next(), low() + 2i is prime exactly when composite()[i] is zero, for i < size():
+   boost::uint64_t low()const { return m_low; }
+   std::size_t size()const { return m_composite.size(); }
+   const unsigned char* composite()const { return m_composite.empty() ? 0 : &m_composite[0]; }
+
+private:
+   void sieve()
+   {
+      std::size_t size = m_composite.size();
+      boost::uint64_t last = m_low + 2 * (size - 1);
+      //
+      // Start crossing off multiples of each base prime p once the segment reaches p^2.
+      // m_offsets holds the index in this segment of the next odd multiple of each:
+      //
+      while(m_offsets.size() < m_base->size())
+      {
+         boost::uint64_t p = (*m_base)[m_offsets.size()];
+         if(p * p > last)
+            break;
+         boost::uint64_t d;
+         if(p * p >= m_low)
+            d = p * p - m_low;
+         else
+         {
+            d = (p - m_low % p) % p;
+            if(d & 1)
+               d += p;
+         }
+         m_offsets.push_back(d / 2);
+      }
+      unsigned char* composite = &m_composite[0];
+      const std::vector<unsigned char>& pattern = prime_sieve_pattern();
+      std::size_t k = static_cast<std::size_t>((m_low / 2) % prime_sieve_pattern_size);
+      for(std::size_t j = 0; j < size; )
+      {
+         std::size_t n = (std::min)(size - j, prime_sieve_pattern_size - k);
+         std::copy(pattern.begin() + k, pattern.begin() + k + n, composite + j);
+         j += n;
+         k = 0;
+      }
+      // The pattern marks 3, ..., 13 themselves:
+      for(unsigned p : { 3u, 5u, 7u, 11u, 13u })
+      {
+         if((p >= m_low) && (p <= last))
+            composite[(p - m_low) / 2] = 0;
+      }
+      for(std::size_t i = prime_sieve_presieved; i < m_offsets.size(); ++i)
+      {
+         boost::uint64_t p = (*m_base)[i];
+         boost::uint64_t j = m_offsets[i];
+         for(; j < size; j += p)
+            composite[j] = 1;
+         m_offsets[i] = j - size;
+      }
+   }
+
+   boost::uint64_t m_next, m_upper, m_low;
+   const std::vector<boost::uint32_t>* m_base;
+   std::vector<boost::uint64_t> m_offsets;
+   std::vector<unsigned char> m_composite;
+};
+
+// The odd primes up to limit, from the table of primes where possible:
+inline std::vector<boost::uint32_t> prime_sieve_base(boost::uint64_t limit)
+{
+   std::vector<boost::uint32_t> result;
+   if(limit <= boost::math::prime(max_prime))
+   {
+      for(unsigned i = 1; (i <= max_prime) && (boost::math::prime(i) <= limit); ++i)
+         result.push_back(boost::math::prime(i));
+      return result;
+   }
+   std::vector<boost::uint32_t> base = prime_sieve_base(prime_sieve_isqrt(limit));
+   prime_sieve_segments segments(3, limit + 1, &base);
+   while(segments.next())
+   {
+      for(std::size_t i = 0; i < segments.size(); ++i)
+      {
+         if(!segments.composite()[i])
+            result.push_back(static_cast<boost::uint32_t>(segments.low() + 2 * i));
+      }
+   }
+   return result;
+}
+
+//
+// Sieving needs the primes up to r = sqrt(upper), and visits each of them once a
+// segment.  Testing each odd number in turn costs some hundreds of nanoseconds a
+// number: it is quicker for a range that is narrow compared to r, and for any range
+// once r passes 2^28.
+//
+inline bool prime_sieve_by_tests(boost::uint64_t lower, boost::uint64_t upper)
+{
+   boost::uint64_t r = prime_sieve_isqrt(upper - 1);
+   return (upper - lower < r / 64) || (r >= (1uLL << 28));
+}
+
+//
+// The primes in [lower, upper), in order, using the base primes in *base (or testing each
+// number if base is null) or, with the two argument constructor, its own base primes:
+//
+class prime_sieve_state
+{
+public:
+   prime_sieve_state(boost::uint64_t lower, boost::uint64_t upper)
+      : m_two((lower <= 2) && (upper > 2)),
+        m_own_base((upper > lower) && !prime_sieve_by_tests(lower, upper) ? prime_sieve_base(prime_sieve_isqrt(upper - 1)) : std::vector<boost::uint32_t>()),
+        m_segments(odd_lower(lower), upper, (upper > lower) && !prime_sieve_by_tests(lower, upper) ? &m_own_base : 0),
+        m_index(0) {}
+   prime_sieve_state(boost::uint64_t lower, boost::uint64_t upper, const std::vector<boost::uint32_t>* base)
+      : m_two((lower <= 2) && (upper > 2)), m_segments(odd_lower(lower), upper, base), m_index(0) {}
+
+   // Sets *p to the next prime and returns true, or returns false if there are none left:
+   bool next(boost::uint64_t* p)
+   {
+      if(m_two)
+      {
+         m_two = false;
+         *p = 2;
+         return true;
+      }
+      while(true)
+      {
+         const unsigned char* composite = m_segments.composite();
+         while(m_index < m_segments.size())
+         {
+            if(!composite[m_index])
+            {
+               *p = m_segments.low() + 2 * m_index++;
+               return true;
+            }
+            ++m_index;
+         }
+         if(!m_segments.next())
+            return false;
+         m_index = 0;
+      }
+   }
+   // The number of primes not yet returned by next():
+   boost::uint64_t count()
+   {
+      boost::uint64_t result = m_two ? 1 : 0;
+      m_two = false;
+      result += std::count(m_segments.composite() + m_index, m_segments.composite() + m_segments.size(), 0);
+      while(m_segments.next())
+         result += std::count(m_segments.composite(), m_segments.composite() + m_segments.size(), 0);
+      m_index = m_segments.size();
+      return result;
+   }
+
+private:
+   prime_sieve_state(const prime_sieve_state&);
+   prime_sieve_state& operator=(const prime_sieve_state&);
+
+   static boost::uint64_t odd_lower(boost::uint64_t lower)
+   {
+      return lower <= 3 ? 3 : lower | 1;
+   }
+
+   bool m_two;
+   std::vector<boost::uint32_t> m_own_base;
+   prime_sieve_segments m_segments;
+   std::size_t m_index;
+};
+
+} // namespace detail
+
+//
+// Returns true if n is prime, by trial division and a deterministic Miller-Rabin test:
+//
+template <class Integer>
+inline bool is_prime(Integer n)
+{
+   return detail::is_prime_imp(detail::prime_sieve_bound(n));
+}
+
+//
+// The primes p with lower <= p < upper, in increasing order, found by a segmented sieve
+// of Eratosthenes a segment at a time, as they are iterated over:
+//
+template <class Integer>
+class prime_sieve
+{
+public:
+   class iterator
+   {
+   public:
+      typedef std::input_iterator_tag iterator_category;
+      typedef Integer value_type;
+      typedef std::ptrdiff_t difference_type;
+      typedef const Integer* pointer;
+      typedef const Integer& reference;
+
+      iterator() : m_value(0) {}
+
+      reference operator*()const { return m_value; }
+      pointer operator->()const { return &m_value; }
+      iterator& operator++()
+      {
+         advance();
+         return *this;
+      }
+      iterator operator++(int)
+      {
+         iterator result(*this);
+         advance();
+         return result;
+      }
+      friend bool operator==(const iterator& a, const iterator& b) { return a.m_state == b.m_state; }
+      friend bool operator!=(const iterator& a, const iterator& b) { return a.m_state != b.m_state; }
+
+   private:
+      friend class prime_sieve;
+      explicit iterator(const std::shared_ptr<detail::prime_sieve_state>& state) : m_state(state), m_value(0)
+      {
+         advance();
+      }
+      void advance()
+      {
+         boost::uint64_t p;
+         if(m_state->next(&p))
+            m_value = static_cast<Integer>(p);
+         else
+            m_state.reset();
+      }
+
+      std::shared_ptr<detail::prime_sieve_state> m_state;
+      Integer m_value;
+   };
+   typedef iterator const_iterator;
+
+   prime_sieve(Integer lower, Integer upper) : m_lower(lower), m_upper(upper) {}
+
+   Integer lower()const { return m_lower; }
+   Integer upper()const { return m_upper; }
+
+   // Each call to begin() sieves the range afresh:
+   iterator begin()const
+   {
+      return iterator(std::make_shared<detail::prime_sieve_state>(detail::prime_sieve_bound(m_lower), detail::prime_sieve_bound(m_upper)));
+   }
+   iterator end()const { return iterator(); }
+
+private:
+   Integer m_lower, m_upper;
+};
+
+//
+// Writes the primes p with lower <= p < upper to out in increasing order:
+//
+template <class Integer, class OutputIterator>
+OutputIterator prime_range(Integer lower, Integer upper, OutputIterator out)
+{
+   detail::prime_sieve_state state(detail::prime_sieve_bound(lower), detail::prime_sieve_bound(upper));
+   boost::uint64_t p;
+   while(state.next(&p))
+      *out++ = static_cast<Integer>(p);
+   return out;
+}
+
+//
+// The number of primes p <= n:
+//
+template <class Integer>
+Integer prime_count(Integer n)
+{
+   boost::uint64_t x = detail::prime_sieve_bound(n);
+   detail::prime_sieve_state state(0, x);
+   return static_cast<Integer>(state.count() + (detail::is_prime_imp(x) ? 1 : 0));
+}
+
+#if !defined(BOOST_NO_CXX17_HDR_EXECUTION) && !defined(BOOST_NO_CXX17_IF_CONSTEXPR)
+
+namespace detail{
+
+//
+// Under an execution policy the range is split into blocks of 64 segments, which are
+// sieved independently with shared base primes:
+//
+template <class Result>
+struct prime_sieve_block
+{
+   boost::uint64_t lower, upper;
+   Result result;
+};
+
+template <class Result, class ExecutionPolicy, class F>
+std::vector<prime_sieve_block<Result> > prime_sieve_blocks(ExecutionPolicy&& exec, boost::uint64_t lower, boost::uint64_t upper, F f)
+{
+   std::vector<prime_sieve_block<Result> > blocks;
+   if(upper <= lower)
+      return blocks;
+   const boost::uint64_t width = 2 * 64 * static_cast<boost::uint64_t>(prime_sieve_segment_size);
+   for(boost::uint64_t x = lower; x < upper; x = upper - x > width ? x + width : upper)
+   {
+      prime_sieve_block<Result> block = { x, upper - x > width ? x + width : upper, Result() };
+      blocks.push_back(block);
+   }
+   const bool by_tests = prime_sieve_by_tests(lower, upper);
+   const std::vector<boost::uint32_t> base = by_tests ? std::vector<boost::uint32_t>() : prime_sieve_base(prime_sieve_isqrt(upper - 1));
+   const std::vector<boost::uint32_t>* pbase = by_tests ? 0 : &base;
+   std::for_each(exec, blocks.begin(), blocks.end(), [pbase, &f](prime_sieve_block<Result>& block)
+   {
+      prime_sieve_state state(block.lower, block.upper, pbase);
+      f(state, block.result);
+   });
+   return blocks;
+}
+
+} // namespace detail
+
+template <class ExecutionPolicy, class Integer, class OutputIterator, class = typename std::enable_if<std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value>::type>
+OutputIterator prime_range(ExecutionPolicy&& exec, Integer lower, Integer upper, OutputIterator out)
+{
+   typedef std::vector<Integer> result_type;
+   std::vector<detail::prime_sieve_block<result_type> > blocks = detail::prime_sieve_blocks<result_type>(exec,
+      detail::prime_sieve_bound(lower), detail::prime_sieve_bound(upper), [](detail::prime_sieve_state& state, result_type& primes)
+   {
+      boost::uint64_t p;
+      while(state.next(&p))
+         primes.push_back(static_cast<Integer>(p));
+   });
+   for(std::size_t i = 0; i < blocks.size(); ++i)
+      out = std::copy(blocks[i].result.begin(), blocks[i].result.end(), out);
+   return out;
+}
+
+template <class ExecutionPolicy, class Integer, class = typename std::enable_if<std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value>::type>
+Integer prime_count(ExecutionPolicy&& exec, Integer n)
+{
+   boost::uint64_t x = detail::prime_sieve_bound(n);
+   std::vector<detail::prime_sieve_block<boost::uint64_t> > blocks = detail::prime_sieve_blocks<boost::uint64_t>(exec,
+      0, x, [](detail::prime_sieve_state& state, boost::uint64_t& count)
+   {
+      count = state.count();
+   });
+   boost::uint64_t result = detail::is_prime_imp(x) ? 1 : 0;
+   for(std::size_t i = 0; i < blocks.size(); ++i)
+      result += blocks[i].result;
+   return static_cast<Integer>(result);
+}
+
+#endif
+
+}} // namespace boost and math
+
+#endif // BOOST_MATH_SF_PRIME_SIEVE_HPP
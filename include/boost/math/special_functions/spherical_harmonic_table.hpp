@@ -0,0 +1,386 @@
+//  (C) Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Tables of the spherical harmonics Y_l^m(theta, phi), and of the normalized associated Legendre
+// functions Y_l^m(theta, 0), for all 0 <= m <= l <= lmax at once.
+//
+// The table is triangular and stored by degree: the entry for (l, m) is at l(l+1)/2 + m.
+// Each order m is computed by the three term recurrence in the degree for the normalized functions,
+// started from the diagonal value at l = m, which is itself found by recurrence in m.
+// The diagonal values contain the factor sin(theta)^m, which underflows for large m whenever
+// theta is near a pole, even though the values at l > m then grow back into the range of the type;
+// so the values are carried as a mantissa and a binary exponent until they are large enough
+// to be represented directly.
+//
+#ifndef BOOST_MATH_SPHERICAL_HARMONIC_TABLE_HPP
+#define BOOST_MATH_SPHERICAL_HARMONIC_TABLE_HPP
+
+#ifdef _MSC_VER
+#  pragma once
+#endif
+
+#include <algorithm>
+#include <complex>
+#include <limits>
+#include <vector>
+#include <boost/assert.hpp>
+#include <boost/utility/enable_if.hpp>
+#include <boost/math/special_functions/math_fwd.hpp>
+#include <boost/math/special_functions/fpclassify.hpp>
+#include <boost/math/policies/error_handling.hpp>
+#include <boost/math/constants/constants.hpp>
+#if !defined(BOOST_NO_CXX17_HDR_EXECUTION) && !defined(BOOST_NO_CXX17_IF_CONSTEXPR)
+#include <execution>
+#include <numeric>
+#include <type_traits>
+#endif
+
+namespace boost{ namespace math{
+
+// The position of (l, m) in the table, and the size of the table up to degree lmax:
+inline std::size_t sph_legendre_table_index(unsigned l, unsigned m)
+{
+   return static_cast<std::size_t>(l) * (l + 1) / 2 + m;
+}
+
+inline std::size_t sph_legendre_table_size(unsigned lmax)
+{
+   return static_cast<std::size_t>(lmax + 1) * (lmax + 2) / 2;
+}
+
+namespace detail{
+
+//
+// The binary exponent by which values are shifted when they leave the safe range
+// [2^-shift, 2^shift]; a quarter of the exponent range leaves plenty of room either side.
+//
+template <class T>
+inline int sph_legendre_shift()
+{
+   int e = std::numeric_limits<T>::is_specialized ? std::numeric_limits<T>::max_exponent / 4 : 0;
+   return e < 16 ? 16 : (e > 4096 ? 4096 : e);
+}
+
+template <class T>
+inline T sph_legendre_unscale(T p, int e)
+{
+   BOOST_MATH_STD_USING
+   return e == 0 ? p : T(ldexp(p, e));
+}
+
+//
+// The diagonal values Y_m^m(theta, 0) = -sqrt((2m+1)/(2m)) sin(theta) Y_{m-1}^{m-1}(theta, 0) at every point,
+// as mantissa d[m * n + i] and exponent e[m * n + i].  Using the signed sine gives the factor (-1)^m for theta
+// in (pi, 2pi), so the functions have period 2pi in theta as they do in spherical_harmonic.
+//
+template <class T>
+void sph_legendre_diagonal(unsigned lmax, const T* sin_theta, std::size_t n, T* d, int* e)
+{
+   BOOST_MATH_STD_USING
+   const int shift = sph_legendre_shift<T>();
+   const T small = ldexp(T(1), -shift);
+   const T p00 = 1 / (2 * constants::root_pi<T>());
+   for(std::size_t i = 0; i < n; ++i)
+   {
+      d[i] = p00;
+      e[i] = 0;
+   }
+   for(unsigned m = 1; m <= lmax; ++m)
+   {
+      const T c = -sqrt(T(2 * m + 1) / (2 * m));
+      const T* dp = d + (m - 1) * n;
+      const int* ep = e + (m - 1) * n;
+      T* dm = d + m * n;
+      int* em = e + m * n;
+      for(std::size_t i = 0; i < n; ++i)
+      {
+         T v = c * sin_theta[i] * dp[i];
+         int ex = ep[i];
+         if((v != 0) && (fabs(v) < small))
+         {
+            v = ldexp(v, shift);
+            ex -= shift;
+         }
+         dm[i] = v;
+         em[i] = ex;
+      }
+   }
+}
+
+//
+// The orders m_begin <= m < m_end, from the diagonal, by
+//
+// Y_{m+1}^m = sqrt(2m+3) x Y_m^m,    Y_l^m = a_l x Y_{l-1}^m - (a_l / a_{l-1}) Y_{l-2}^m,    a_l = sqrt((4l^2-1)/(l^2-m^2)),
+//
+// with x = cos(theta), which is stable in the direction of increasing l.  The block of orders advances one degree
+// at a time, so that each degree of the block is written to a contiguous part of the table.  The inner loops
+// run over the points, with no branches unless some value at that order is still held in scaled form.
+//
+template <class T, class U>
+void sph_legendre_orders(unsigned m_begin, unsigned m_end, unsigned lmax, const T* x, const T* d, const int* e, std::size_t n, U* out)
+{
+   BOOST_MATH_STD_USING
+   const int shift = sph_legendre_shift<T>();
+   const T big = ldexp(T(1), shift);
+   // Scaled values with an exponent below this underflow to zero:
+   const int negligible = std::numeric_limits<T>::is_specialized ? std::numeric_limits<T>::min_exponent - std::numeric_limits<T>::digits - shift - 1 : (std::numeric_limits<int>::min)();
+   const std::size_t orders = m_end - m_begin;
+   std::vector<T> p0(orders * n), p1(orders * n), a(orders);
+   std::vector<int> ex(orders * n);
+   std::vector<char> scaled(orders);
+   for(unsigned l = m_begin; l <= lmax; ++l)
+   {
+      const T l2 = T(l) * l;
+      const unsigned top = l < m_end ? l + 1 : m_end;
+      for(unsigned m = m_begin; m < top; ++m)
+      {
+         const std::size_t k = m - m_begin;
+         T* q0 = &p0[k * n];
+         T* q1 = &p1[k * n];
+         int* ek = &ex[k * n];
+         U* row = out + sph_legendre_table_index(l, m) * n;
+         if(l == m)
+         {
+            scaled[k] = false;
+            for(std::size_t i = 0; i < n; ++i)
+            {
+               q1[i] = d[m * n + i];
+               ek[i] = e[m * n + i];
+               scaled[k] = scaled[k] || (ek[i] != 0);
+               row[i] = static_cast<U>(sph_legendre_unscale(q1[i], ek[i]));
+            }
+            continue;
+         }
+         T b;
+         if(l == m + 1)
+         {
+            a[k] = sqrt(T(2 * m + 3));
+            b = 0;
+         }
+         else
+         {
+            const T a_prev = a[k];
+            a[k] = sqrt((4 * l2 - 1) / (l2 - T(m) * m));
+            b = a[k] / a_prev;
+         }
+         const T ak = a[k];
+         if(!scaled[k])
+         {
+            for(std::size_t i = 0; i < n; ++i)
+            {
+               T p = ak * x[i] * q1[i] - b * q0[i];
+               q0[i] = q1[i];
+               q1[i] = p;
+               row[i] = static_cast<U>(p);
+            }
+            continue;
+         }
+         for(std::size_t i = 0; i < n; ++i)
+         {
+            T p = ak * x[i] * q1[i] - b * q0[i];
+            q0[i] = q1[i];
+            q1[i] = p;
+         }
+         scaled[k] = false;
+         for(std::size_t i = 0; i < n; ++i)
+         {
+            if(ek[i] != 0)
+            {
+               if(fabs(q1[i]) > big)
+               {
+                  q0[i] = ldexp(q0[i], -shift);
+                  q1[i] = ldexp(q1[i], -shift);
+                  ek[i] += shift;
+                  if(ek[i] >= 0)
+                  {
+                     // The values are now representable directly:
+                     q0[i] = ldexp(q0[i], ek[i]);
+                     q1[i] = ldexp(q1[i], ek[i]);
+                     ek[i] = 0;
+                  }
+               }
+               scaled[k] = scaled[k] || (ek[i] != 0);
+            }
+            row[i] = ek[i] < negligible ? U(0) : static_cast<U>(sph_legendre_unscale(q1[i], ek[i]));
+         }
+      }
+   }
+}
+
+//
+// The number of orders advanced together: enough that each degree is written in a long contiguous run,
+// few enough that the recurrence state for the block stays in cache.
+//
+inline unsigned sph_legendre_block(std::size_t n)
+{
+   BOOST_ASSERT(n > 0);
+   return n >= 2048 ? 1u : static_cast<unsigned>(2048 / n);
+}
+
+//
+// Validates the angles and computes their cosines and sines, and the diagonal of the table.
+//
+template <class T, class U, class Policy>
+void sph_legendre_table_setup(unsigned lmax, const U* theta, std::size_t n, std::vector<T>& x, std::vector<T>& d, std::vector<int>& e, const Policy& pol)
+{
+   BOOST_MATH_STD_USING
+   static const char* function = "boost::math::sph_legendre_table<%1%>(unsigned, %1%)";
+   x.resize(n);
+   std::vector<T> s(n);
+   for(std::size_t i = 0; i < n; ++i)
+   {
+      T t = static_cast<T>(theta[i]);
+      if(!(boost::math::isfinite)(t))
+      {
+         policies::raise_domain_error<T>(function, "The polar angle must be finite, but got %1%.", t, pol);
+         x[i] = s[i] = std::numeric_limits<T>::quiet_NaN();
+         continue;
+      }
+      x[i] = cos(t);
+      s[i] = sin(t);
+   }
+   d.resize((static_cast<std::size_t>(lmax) + 1) * n);
+   e.resize(d.size());
+   sph_legendre_diagonal(lmax, s.data(), n, d.data(), e.data());
+}
+
+// The table at each of n angles: the value for (l, m) at theta[i] is out[sph_legendre_table_index(l, m) * n + i].
+template <class T, class U, class Policy>
+void sph_legendre_table_imp(unsigned lmax, const U* theta, std::size_t n, U* out, const Policy& pol)
+{
+   if(n == 0)
+      return;
+   std::vector<T> x, d;
+   std::vector<int> e;
+   sph_legendre_table_setup(lmax, theta, n, x, d, e, pol);
+   const unsigned block = sph_legendre_block(n);
+   for(unsigned m = 0; m <= lmax; m += block)
+   {
+      sph_legendre_orders(m, (std::min)(m + block, lmax + 1), lmax, x.data(), d.data(), e.data(), n, out);
+   }
+}
+
+template <class T, class Policy>
+std::vector<T> sph_legendre_table_single(unsigned lmax, T theta, const Policy& pol)
+{
+   std::vector<T> f(sph_legendre_table_size(lmax));
+   sph_legendre_table_imp<T>(lmax, &theta, 1, f.data(), pol);
+   return f;
+}
+
+} // namespace detail
+
+template <class T, class OutputIterator, class Policy>
+inline typename boost::enable_if_c<policies::is_policy<Policy>::value, OutputIterator>::type
+   sph_legendre_table(unsigned lmax, T theta, OutputIterator out_it, const Policy& /* pol */)
+{
+   typedef typename tools::promote_args<T>::type result_type;
+   typedef typename policies::evaluation<result_type, Policy>::type value_type;
+   typedef typename policies::normalise<
+      Policy,
+      policies::promote_float<false>,
+      policies::promote_double<false>,
+      policies::discrete_quantile<>,
+      policies::assert_undefined<> >::type forwarding_policy;
+   std::vector<value_type> f = detail::sph_legendre_table_single(lmax, static_cast<value_type>(theta), forwarding_policy());
+   for(std::size_t k = 0; k < f.size(); ++k)
+   {
+      *out_it++ = policies::checked_narrowing_cast<result_type, Policy>(f[k], "boost::math::sph_legendre_table<%1%>(unsigned, %1%)");
+   }
+   return out_it;
+}
+
+template <class T, class OutputIterator>
+inline OutputIterator sph_legendre_table(unsigned lmax, T theta, OutputIterator out_it)
+{
+   return sph_legendre_table(lmax, theta, out_it, policies::policy<>());
+}
+
+template <class T1, class T2, class OutputIterator, class Policy>
+inline typename boost::enable_if_c<policies::is_policy<Policy>::value, OutputIterator>::type
+   spherical_harmonic_table(unsigned lmax, T1 theta, T2 phi, OutputIterator out_it, const Policy& /* pol */)
+{
+   BOOST_MATH_STD_USING
+   typedef typename tools::promote_args<T1, T2>::type result_type;
+   typedef typename policies::evaluation<result_type, Policy>::type value_type;
+   typedef typename policies::normalise<
+      Policy,
+      policies::promote_float<false>,
+      policies::promote_double<false>,
+      policies::discrete_quantile<>,
+      policies::assert_undefined<> >::type forwarding_policy;
+   static const char* function = "boost::math::spherical_harmonic_table<%1%>(unsigned, %1%, %1%)";
+   std::vector<value_type> f = detail::sph_legendre_table_single(lmax, static_cast<value_type>(theta), forwarding_policy());
+   std::vector<value_type> c(lmax + 1), s(lmax + 1);
+   for(unsigned m = 0; m <= lmax; ++m)
+   {
+      c[m] = cos(m * static_cast<value_type>(phi));
+      s[m] = sin(m * static_cast<value_type>(phi));
+   }
+   for(unsigned l = 0; l <= lmax; ++l)
+   {
+      for(unsigned m = 0; m <= l; ++m)
+      {
+         value_type p = f[sph_legendre_table_index(l, m)];
+         *out_it++ = std::complex<result_type>(
+            policies::checked_narrowing_cast<result_type, Policy>(p * c[m], function),
+            policies::checked_narrowing_cast<result_type, Policy>(p * s[m], function));
+      }
+   }
+   return out_it;
+}
+
+template <class T1, class T2, class OutputIterator>
+inline OutputIterator spherical_harmonic_table(unsigned lmax, T1 theta, T2 phi, OutputIterator out_it)
+{
+   return spherical_harmonic_table(lmax, theta, phi, out_it, policies::policy<>());
+}
+
+//
+// Many angles at once: the value for (l, m) at theta[i] is out[sph_legendre_table_index(l, m) * number_of_points + i],
+// so that the inner loops of the recurrence, and of a transform which uses the table, run over contiguous points.
+// The recurrence is stable, so double is not promoted: the inner loops then vectorize.
+//
+namespace detail{
+
+typedef policies::policy<policies::promote_double<false> > sph_legendre_table_policy;
+
+}
+
+template <class T>
+void sph_legendre_table(unsigned lmax, const T* theta, std::size_t number_of_points, T* out)
+{
+   typedef typename policies::evaluation<T, detail::sph_legendre_table_policy>::type value_type;
+   detail::sph_legendre_table_imp<value_type>(lmax, theta, number_of_points, out, detail::sph_legendre_table_policy());
+}
+
+#if !defined(BOOST_NO_CXX17_HDR_EXECUTION) && !defined(BOOST_NO_CXX17_IF_CONSTEXPR)
+//
+// As above, with the orders distributed across the execution policy; the diagonal is computed first,
+// after which every order is independent of every other.
+//
+template <class ExecutionPolicy, class T, class = typename std::enable_if<std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value>::type>
+void sph_legendre_table(ExecutionPolicy&& exec, unsigned lmax, const T* theta, std::size_t number_of_points, T* out)
+{
+   if(number_of_points == 0)
+      return;
+   typedef typename policies::evaluation<T, detail::sph_legendre_table_policy>::type value_type;
+   std::vector<value_type> x, d;
+   std::vector<int> e;
+   detail::sph_legendre_table_setup(lmax, theta, number_of_points, x, d, e, detail::sph_legendre_table_policy());
+   const unsigned block = detail::sph_legendre_block(number_of_points);
+   std::vector<unsigned> blocks(lmax / block + 1);
+   std::iota(blocks.begin(), blocks.end(), 0u);
+   std::for_each(exec, blocks.begin(), blocks.end(), [&](unsigned j)
+   {
+      unsigned m = j * block;
+      detail::sph_legendre_orders(m, (std::min)(m + block, lmax + 1), lmax, x.data(), d.data(), e.data(), number_of_points, out);
+   });
+}
+#endif
+
+}} // namespaces
+
+#endif // BOOST_MATH_SPHERICAL_HARMONIC_TABLE_HPP
@@ -18,6 +18,10 @@
 #include <boost/math/special_functions/gamma.hpp>
 #include <boost/math/special_functions/factorials.hpp>
 #include <boost/math/special_functions/sin_pi.hpp>
+#include <boost/math/special_functions/bernoulli.hpp>
+#include <boost/utility/enable_if.hpp>
+#include <iterator>
+#include <vector>
 
 #if defined(__GNUC__) && defined(BOOST_MATH_USE_FLOAT128)
 //
@@ -140,6 +144,64 @@ inline T zeta_series2_imp(T s, const Policy& pol)
 }
 #endif
 
+//
+// The coefficients of the series below depend only on the precision of T, so they
+// are calculated once per thread, and again only if the precision changes:
+//
+template <class T>
+class zeta_polynomial_coefficients
+{
+public:
+   zeta_polynomial_coefficients() : m_digits(0), m_two_n(0) {}
+
+   static const zeta_polynomial_coefficients& get()
+   {
+#ifdef BOOST_MATH_NO_THREAD_LOCAL_WITH_NON_TRIVIAL_TYPES
+      static_assert(std::is_trivially_destructible<T>::value, "Your platform does not support thread_local with non-trivial types, last checked with Mingw-x64-8.1, Jan 2021.  Please try a Mingw build with the POSIX threading model, see https://sourceforge.net/p/mingw-w64/bugs/527/");
+#endif
+      static BOOST_MATH_THREAD_LOCAL zeta_polynomial_coefficients data;
+      int current_digits = tools::digits<T>();
+      if(data.m_digits != current_digits)
+         data.initialize(current_digits);
+      return data;
+   }
+
+   const T& two_n()const { return m_two_n; }
+   // The coefficient of (j+1)^-s, j = 0, ..., 2n-1:
+   const std::vector<T>& coefficients()const { return m_coefficients; }
+
+private:
+   void initialize(int digits)
+   {
+      BOOST_MATH_STD_USING
+      int n = itrunc(T(log(boost::math::tools::epsilon<T>()) / -2));
+      m_two_n = ldexp(T(1), n);
+      m_coefficients.clear();
+      m_coefficients.reserve(2 * n);
+      int ej_sign = 1;
+      for(int j = 0; j < n; ++j)
+      {
+         m_coefficients.push_back(ej_sign * -m_two_n);
+         ej_sign = -ej_sign;
+      }
+      T ej_sum = 1;
+      T ej_term = 1;
+      for(int j = n; j <= 2 * n - 1; ++j)
+      {
+         m_coefficients.push_back(ej_sign * (ej_sum - m_two_n));
+         ej_sign = -ej_sign;
+         ej_term *= 2 * n - j;
+         ej_term /= j - n + 1;
+         ej_sum += ej_term;
+      }
+      m_digits = digits;
+   }
+
+   int m_digits;
+   T m_two_n;
+   std::vector<T> m_coefficients;
+};
+
 template <class T, class Policy>
 T zeta_polynomial_series(T s, T sc, Policy const &)
 {
@@ -151,26 +213,12 @@ T zeta_polynomial_series(T s, T sc, Policy const &)
    // See: http://www.cecm.sfu.ca/personal/pborwein/PAPERS/P155.pdf
    //
    BOOST_MATH_STD_USING
-   int n = itrunc(T(log(boost::math::tools::epsilon<T>()) / -2));
+   const zeta_polynomial_coefficients<T>& data = zeta_polynomial_coefficients<T>::get();
+   const std::vector<T>& coefficients = data.coefficients();
    T sum = 0;
-   T two_n = ldexp(T(1), n);
-   int ej_sign = 1;
-   for(int j = 0; j < n; ++j)
-   {
-      sum += ej_sign * -two_n / pow(T(j + 1), s);
-      ej_sign = -ej_sign; 
-   }
-   T ej_sum = 1;
-   T ej_term = 1;
-   for(int j = n; j <= 2 * n - 1; ++j)
-   {
-      sum += ej_sign * (ej_sum - two_n) / pow(T(j + 1), s);
-      ej_sign = -ej_sign;
-      ej_term *= 2 * n - j;
-      ej_term /= j - n + 1;
-      ej_sum += ej_term;
-   }
-   return -sum / (two_n * (-powm1(T(2), sc)));
+   for(std::size_t j = 0; j < coefficients.size(); ++j)
+      sum += coefficients[j] / pow(T(j + 1), s);
+   return -sum / (data.two_n() * (-powm1(T(2), sc)));
 }
 
 template <class T, class Policy>
@@ -1010,6 +1058,131 @@ T zeta_imp(T s, T sc, const Policy& pol, const Tag& tag)
    return result;
 }
 
+//
+// Hurwitz zeta function by Euler-Maclaurin summation, see https://dlmf.nist.gov/2.10#E1 :
+//
+//   zeta(s, a) = sum_{k=0}^{N-1} (a+k)^-s + w^(1-s)/(s-1) + w^-s/2 + sum_{j>=1} B_2j (s)_(2j-1) / (2j)! w^(1-s-2j)
+//
+// with w = a + N.  The coefficients B_2j (s)_(2j-1) / (2j)! of the last sum depend only on s, so are
+// kept for reuse when many a share the same s, and are calculated only as far as needed.
+//
+template <class T, class Policy>
+class hurwitz_zeta_tail
+{
+public:
+   hurwitz_zeta_tail(const T& s) : m_s(s), m_ratio(s / 2) {}
+
+   const T& s()const { return m_s; }
+   //
+   // The smallest w for which the terms of the tail decrease rapidly from the start,
+   // so that the sum converges before (s)_(2j-1) / (2 pi w)^2j begins to grow again.
+   // For s < 1 the direct sum and w^(1-s) / (s-1) cancel, so w is kept as small
+   // as the tail allows: its smallest term is then about exp(-2 pi w) < 2^-digits.
+   //
+   T min_w()const
+   {
+      BOOST_MATH_STD_USING
+      if(m_s < 1)
+         return (std::max)(T(1), T(T(policies::digits<T, Policy>()) / 8));
+      return (m_s + policies::digits<T, Policy>()) / 3;
+   }
+   //
+   // The sum over j at w, to a relative precision of epsilon compared to scale:
+   //
+   T sum(const T& w, const T& power, const T& scale, const Policy& pol)
+   {
+      BOOST_MATH_STD_USING
+      static const char* function = "boost::math::hurwitz_zeta<%1%>(%1%,%1%)";
+      T w2 = 1 / (w * w);
+      // w^(-1-s):
+      T w_power = power / w;
+      T result = 0;
+      T last_term = 0;
+      boost::uintmax_t max_iter = policies::get_max_series_iterations<Policy>();
+      for(unsigned j = 1; ; ++j)
+      {
+         T term = coefficient(j, pol) * w_power;
+         result += term;
+         if(fabs(term) <= policies::get_epsilon<T, Policy>() * fabs(scale + result))
+            break;
+         if(((j > 2) && (fabs(term) > fabs(last_term))) || (j > max_iter))
+            return policies::raise_evaluation_error<T>(function, "Euler-Maclaurin summation failed to converge, current best guess is %1%", T(scale + result), pol);
+         last_term = term;
+         w_power *= w2;
+      }
+      return result;
+   }
+
+private:
+   const T& coefficient(unsigned j, const Policy& pol)
+   {
+      while(m_coefficients.size() < j)
+      {
+         unsigned k = static_cast<unsigned>(m_coefficients.size()) + 1;
+         // (s)_(2k-1) / (2k)!
+         if(k > 1)
+            m_ratio *= (m_s + T(2 * k - 3)) * (m_s + T(2 * k - 2)) / T((2 * k - 1) * (2 * k));
+         m_coefficients.push_back(m_ratio * boost::math::bernoulli_b2n<T>(static_cast<int>(k), pol));
+      }
+      return m_coefficients[j - 1];
+   }
+
+   T m_s;
+   T m_ratio;
+   std::vector<T> m_coefficients;
+};
+
+template <class T, class Policy>
+T hurwitz_zeta_imp(const T& a, hurwitz_zeta_tail<T, Policy>& tail, const Policy& pol)
+{
+   BOOST_MATH_STD_USING
+   static const char* function = "boost::math::hurwitz_zeta<%1%>(%1%,%1%)";
+   const T& s = tail.s();
+   if(!(boost::math::isfinite)(s))
+      return policies::raise_domain_error<T>(function, "Hurwitz zeta requires finite s, but got s = %1%", s, pol);
+   if(!(a > 0) || !(boost::math::isfinite)(a))
+      return policies::raise_domain_error<T>(function, "Hurwitz zeta requires finite a > 0, but got a = %1%", a, pol);
+   if(s == 1)
+      return policies::raise_pole_error<T>(function, "Evaluation of Hurwitz zeta function at pole %1%", s, pol);
+   //
+   // For s < 0 the sum below cancels catastrophically unless a is large, and no
+   // other method is implemented:
+   //
+   if(s < 0)
+      return policies::raise_domain_error<T>(function, "Hurwitz zeta is only implemented for s >= 0, but got s = %1%", s, pol);
+   if(s == 0)
+      return 0.5f - a;
+   if(a == 1)
+      return boost::math::zeta(s, pol);
+   //
+   // Direct summation up to w = a + N, but for s > 1 stop early once the remainder,
+   // which is less than (a+k)^-s + (a+k)^(1-s) / (s-1), is negligible:
+   //
+   T min_w = tail.min_w();
+   boost::uintmax_t n = a < min_w ? boost::math::lltrunc(T(ceil(min_w - a)), pol) : 0;
+   T result = 0;
+   for(boost::uintmax_t k = 0; k < n; ++k)
+   {
+      T x = a + T(k);
+      T term = pow(x, -s);
+      if((s > 1) && (term * (1 + x / (s - 1)) <= policies::get_epsilon<T, Policy>() * result))
+         return result;
+      result += term;
+   }
+   T w = a + T(n);
+   T power = pow(w, -s);
+   result += power * w / (s - 1) + power / 2;
+   result += tail.sum(w, power, result, pol);
+   return result;
+}
+
+template <class T, class Policy>
+inline T hurwitz_zeta_imp(const T& s, const T& a, const Policy& pol)
+{
+   hurwitz_zeta_tail<T, Policy> tail(s);
+   return hurwitz_zeta_imp(a, tail, pol);
+}
+
 template <class T, class Policy, class tag>
 struct zeta_initializer
 {
@@ -1093,6 +1266,62 @@ inline typename tools::promote_args<T>::type zeta(T s)
    return zeta(s, policies::policy<>());
 }
 
+template <class T1, class T2, class Policy>
+inline typename tools::promote_args<T1, T2>::type hurwitz_zeta(T1 s, T2 a, const Policy&)
+{
+   typedef typename tools::promote_args<T1, T2>::type result_type;
+   typedef typename policies::evaluation<result_type, Policy>::type value_type;
+   typedef typename policies::normalise<
+      Policy, 
+      policies::promote_float<false>, 
+      policies::promote_double<false>, 
+      policies::discrete_quantile<>,
+      policies::assert_undefined<> >::type forwarding_policy;
+
+   return policies::checked_narrowing_cast<result_type, forwarding_policy>(detail::hurwitz_zeta_imp(
+      static_cast<value_type>(s),
+      static_cast<value_type>(a),
+      forwarding_policy()), "boost::math::hurwitz_zeta<%1%>(%1%,%1%)");
+}
+
+template <class T1, class T2>
+inline typename tools::promote_args<T1, T2>::type hurwitz_zeta(T1 s, T2 a)
+{
+   return hurwitz_zeta(s, a, policies::policy<>());
+}
+
+//
+// Many a at the same s: the coefficients of the Euler-Maclaurin tail are shared.
+//
+template <class T, class InputIterator, class OutputIterator, class Policy>
+typename boost::enable_if_c<policies::is_policy<Policy>::value, OutputIterator>::type
+   hurwitz_zeta(T s, InputIterator first, InputIterator last, OutputIterator out, const Policy&)
+{
+   typedef typename tools::promote_args<T, typename std::iterator_traits<InputIterator>::value_type>::type result_type;
+   typedef typename policies::evaluation<result_type, Policy>::type value_type;
+   typedef typename policies::normalise<
+      Policy, 
+      policies::promote_float<false>, 
+      policies::promote_double<false>, 
+      policies::discrete_quantile<>,
+      policies::assert_undefined<> >::type forwarding_policy;
+
+   detail::hurwitz_zeta_tail<value_type, forwarding_policy> tail(static_cast<value_type>(s));
+   for(; first != last; ++first, ++out)
+   {
+      *out = policies::checked_narrowing_cast<result_type, forwarding_policy>(
+         detail::hurwitz_zeta_imp(static_cast<value_type>(*first), tail, forwarding_policy()),
+         "boost::math::hurwitz_zeta<%1%>(%1%,%1%)");
+   }
+   return out;
+}
+
+template <class T, class InputIterator, class OutputIterator>
+inline OutputIterator hurwitz_zeta(T s, InputIterator first, InputIterator last, OutputIterator out)
+{
+   return hurwitz_zeta(s, first, last, out, policies::policy<>());
+}
+
 }} // namespaces
 
 #endif // BOOST_MATH_ZETA_HPP
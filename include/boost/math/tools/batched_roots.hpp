@@ -0,0 +1,586 @@
+//  (C) Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_TOOLS_BATCHED_ROOTS_HPP
+#define BOOST_MATH_TOOLS_BATCHED_ROOTS_HPP
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <utility>
+#include <vector>
+#include <boost/math/tools/roots.hpp>
+#include <boost/math/tools/toms748_solve.hpp>
+#include <boost/math/policies/error_handling.hpp>
+#if !defined(BOOST_NO_CXX17_HDR_EXECUTION) && !defined(BOOST_NO_CXX17_IF_CONSTEXPR)
+#include <execution>
+#include <type_traits>
+#endif
+
+//
+// Lockstep solvers for many independent equations f_i(x) = 0.
+//
+// The functor is called as f(i, x) and returns the same tuple as the functors passed to
+// the scalar solvers in roots.hpp, for problem i.  All problems in a block of lanes are
+// advanced together: the functor is called for every live lane in one tight loop, the
+// update is applied to every live lane in a second loop, and lanes which have converged
+// are then compacted out of the block so that the loops stay dense.  Each update follows
+// the scalar solver exactly, so on its rare safeguard paths (a zero derivative, or for
+// Halley and Schroder a step out of the bracket) the update itself calls f(i, x) for that lane.
+//
+#ifndef BOOST_MATH_BATCHED_ROOTS_BLOCK_SIZE
+#define BOOST_MATH_BATCHED_ROOTS_BLOCK_SIZE 64
+#endif
+
+namespace boost {
+namespace math {
+namespace tools {
+
+namespace detail {
+
+   struct batched_newton_step
+   {
+      template <class T>
+      static T step(const T& /*x*/, const T& f0, const T& f1) BOOST_NOEXCEPT_IF(BOOST_MATH_IS_FLOAT(T))
+      {
+         return f0 / f1;
+      }
+   };
+
+   //
+   // Newton-Raphson iteration on problems [first, last) in lockstep.  At most BOOST_MATH_BATCHED_ROOTS_BLOCK_SIZE
+   // problems are live at once, so the working set stays in cache however large the batch.
+   //
+   template <class Stepper, class F, class T, class Policy>
+   void batched_root_finder(F& f, const T* guess, const T* min, const T* max, T* root, std::size_t first, std::size_t last, int digits, boost::uintmax_t max_iter, boost::uintmax_t* iterations, const Policy& pol)
+   {
+      BOOST_MATH_STD_USING
+      static const char* function = "boost::math::tools::batched_root_finder<%1%>";
+      const std::size_t block = BOOST_MATH_BATCHED_ROOTS_BLOCK_SIZE;
+
+      const T factor = static_cast<T>(ldexp(1.0, 1 - digits));
+      std::vector<std::size_t> lane(block);
+      std::vector<T> x(block), lo(block), hi(block), f0(block), f1(block), last_f0(block), delta(block), delta1(block), delta2(block), lo_f(block), hi_f(block);
+      std::vector<boost::uintmax_t> count(block);
+      std::vector<unsigned char> live(block);
+
+      for (std::size_t start = first; start < last; start += block)
+      {
+         std::size_t width = 0;
+         for (std::size_t i = start; i < (std::min)(last, start + block); ++i)
+         {
+            if (iterations)
+               iterations[i] = 0;
+            if (min[i] >= max[i])
+            {
+               root[i] = policies::raise_evaluation_error(function, "Range arguments in wrong order in boost::math::tools::batched_root_finder(first arg=%1%)", min[i], pol);
+               continue;
+            }
+            lane[width] = i;
+            x[width] = guess[i];
+            lo[width] = min[i];
+            hi[width] = max[i];
+            delta[width] = tools::max_value<T>();
+            delta1[width] = tools::max_value<T>();
+            delta2[width] = tools::max_value<T>();
+            last_f0[width] = 0;
+            lo_f[width] = 0;
+            hi_f[width] = 0;
+            count[width] = 0;
+            ++width;
+         }
+
+         while (width)
+         {
+            //
+            // The only call into user code; no control flow depends on the lane:
+            //
+            for (std::size_t k = 0; k < width; ++k)
+            {
+               detail::unpack_tuple(f(lane[k], x[k]), f0[k], f1[k]);
+            }
+
+            //
+            // The update follows newton_raphson_iterate in roots.hpp step for step, so that each
+            // problem gets exactly its result:
+            //
+            for (std::size_t k = 0; k < width; ++k)
+            {
+               ++count[k];
+               live[k] = 1;
+               T previous_f0 = last_f0[k];
+               last_f0[k] = f0[k];
+               if (f0[k] == 0)
+               {
+                  live[k] = 0;
+                  continue;
+               }
+               delta2[k] = delta1[k];
+               delta1[k] = delta[k];
+               T current = x[k];
+               T d;
+               if (f1[k] == 0)
+               {
+                  // Zero derivative, the only path which calls f(i, x) outside the loop above:
+                  std::size_t i = lane[k];
+                  auto g = [&f, i](const T& y) { return f(i, y); };
+                  T scratch = current;
+                  detail::handle_zero_derivative(g, previous_f0, f0[k], delta[k], current, scratch, lo[k], hi[k]);
+                  d = delta[k];
+               }
+               else
+               {
+                  d = Stepper::step(current, f0[k], f1[k]);
+               }
+               if (fabs(d * 2) > fabs(delta2[k]))
+               {
+                  // Last two steps haven't converged.
+                  T shift = (d > 0) ? (current - lo[k]) / 2 : (current - hi[k]) / 2;
+                  if ((current != 0) && (fabs(shift) > fabs(current)))
+                     d = sign(d) * fabs(current) * 1.1f; // Protect against huge jumps!
+                  else
+                     d = shift;
+                  // reset delta1/2 so we don't take this branch next time round:
+                  delta1[k] = 3 * d;
+                  delta2[k] = 3 * d;
+               }
+               T next = current - d;
+               if (next <= lo[k])
+               {
+                  d = 0.5F * (current - lo[k]);
+                  next = current - d;
+               }
+               else if (next >= hi[k])
+               {
+                  d = 0.5F * (current - hi[k]);
+                  next = current - d;
+               }
+               if ((next == lo[k]) || (next == hi[k]))
+               {
+                  // Clamped onto the bracket: finished, without updating it.
+                  x[k] = next;
+                  live[k] = 0;
+                  continue;
+               }
+               // Update brackets:
+               if (d > 0)
+               {
+                  hi[k] = current;
+                  hi_f[k] = f0[k];
+               }
+               else
+               {
+                  lo[k] = current;
+                  lo_f[k] = f0[k];
+               }
+               delta[k] = d;
+               x[k] = next;
+               if (hi_f[k] * lo_f[k] > 0)
+               {
+                  x[k] = policies::raise_evaluation_error(function, "There appears to be no root to be found in boost::math::tools::batched_root_finder, perhaps we have a local minima near current best guess of %1%", current, pol);
+                  live[k] = 0;
+               }
+               else if ((count[k] >= max_iter) || (fabs(next * factor) >= fabs(d)))
+               {
+                  live[k] = 0;
+               }
+            }
+
+            //
+            // Retire converged lanes and compact the survivors to the front of the block:
+            //
+            std::size_t survivors = 0;
+            for (std::size_t k = 0; k < width; ++k)
+            {
+               if (!live[k])
+               {
+                  root[lane[k]] = x[k];
+                  if (iterations)
+                     iterations[lane[k]] = count[k];
+                  continue;
+               }
+               if (survivors != k)
+               {
+                  lane[survivors] = lane[k];
+                  x[survivors] = x[k];
+                  lo[survivors] = lo[k];
+                  hi[survivors] = hi[k];
+                  delta[survivors] = delta[k];
+                  delta1[survivors] = delta1[k];
+                  delta2[survivors] = delta2[k];
+                  last_f0[survivors] = last_f0[k];
+                  lo_f[survivors] = lo_f[k];
+                  hi_f[survivors] = hi_f[k];
+                  count[survivors] = count[k];
+               }
+               ++survivors;
+            }
+            width = survivors;
+         }
+      }
+   }
+
+   //
+   // The state of one problem under second_order_root_finder in roots.hpp.  The update below
+   // follows that function step for step, including its fallback to Newton steps, its
+   // handling of a zero derivative and its bracketing of out of range steps, so that each
+   // problem gets exactly the result of halley_iterate or schroder_iterate.
+   //
+   template <class T>
+   struct second_order_lane
+   {
+      std::size_t index;
+      T result, guess, min, max, f0, last_f0, delta, delta1, delta2, min_range_f, max_range_f;
+      boost::uintmax_t count;
+      bool out_of_bounds_sentry;
+   };
+
+   // Applies one iteration given the derivatives at s.result, returns false once the problem is finished.
+   // g(x) evaluates this problem's functor, and is only called here on the rare safeguard paths.
+   template <class Stepper, class G, class T, class Policy>
+   bool second_order_update(G& g, second_order_lane<T>& s, const T& f0, const T& f1, const T& f2, const T& factor, const Policy& pol)
+   {
+      BOOST_MATH_STD_USING
+      static const char* function = "boost::math::tools::batched_root_finder<%1%>";
+      s.last_f0 = s.f0;
+      s.delta2 = s.delta1;
+      s.delta1 = s.delta;
+      s.f0 = f0;
+      --s.count;
+      if (0 == f0)
+         return false;
+      if (f1 == 0)
+      {
+         detail::handle_zero_derivative(g, s.last_f0, s.f0, s.delta, s.result, s.guess, s.min, s.max);
+      }
+      else if (f2 != 0)
+      {
+         s.delta = Stepper::step(s.result, f0, f1, f2);
+         if (s.delta * f1 / f0 < 0)
+         {
+            // Newton and second order steps disagree about the direction, see second_order_root_finder:
+            s.delta = f0 / f1;
+            if (fabs(s.delta) > 2 * fabs(s.guess))
+               s.delta = (s.delta < 0 ? -1 : 1) * 2 * fabs(s.guess);
+         }
+      }
+      else
+         s.delta = f0 / f1;
+      T convergence = fabs(s.delta / s.delta2);
+      if ((convergence > 0.8) && (convergence < 2))
+      {
+         // Last two steps haven't converged.
+         s.delta = (s.delta > 0) ? (s.result - s.min) / 2 : (s.result - s.max) / 2;
+         if ((s.result != 0) && (fabs(s.delta) > s.result))
+            s.delta = sign(s.delta) * fabs(s.result) * 0.9f; // protect against huge jumps!
+         s.delta2 = s.delta * 3;
+         s.delta1 = s.delta * 3;
+      }
+      s.guess = s.result;
+      s.result -= s.delta;
+
+      // Check for out of bounds step:
+      if (s.result < s.min)
+      {
+         T diff = ((fabs(s.min) < 1) && (fabs(s.result) > 1) && (tools::max_value<T>() / fabs(s.result) < fabs(s.min)))
+            ? T(1000)
+            : (fabs(s.min) < 1) && (fabs(tools::max_value<T>() * s.min) < fabs(s.result))
+            ? ((s.min < 0) != (s.result < 0)) ? -tools::max_value<T>() : tools::max_value<T>() : T(s.result / s.min);
+         if (fabs(diff) < 1)
+            diff = 1 / diff;
+         if (!s.out_of_bounds_sentry && (diff > 0) && (diff < 3))
+         {
+            // Only a small out of bounds step, assume that the result is probably approximately at min:
+            s.delta = 0.99f * (s.guess - s.min);
+            s.result = s.guess - s.delta;
+            s.out_of_bounds_sentry = true;
+         }
+         else
+         {
+            if (fabs(float_distance(s.min, s.max)) < 2)
+            {
+               s.result = s.guess = (s.min + s.max) / 2;
+               return false;
+            }
+            s.delta = bracket_root_towards_min(g, s.guess, f0, s.min, s.max, s.count);
+            s.result = s.guess - s.delta;
+            s.guess = s.min;
+            return s.count && (fabs(s.result * factor) < fabs(s.delta));
+         }
+      }
+      else if (s.result > s.max)
+      {
+         T diff = ((fabs(s.max) < 1) && (fabs(s.result) > 1) && (tools::max_value<T>() / fabs(s.result) < fabs(s.max))) ? T(1000) : T(s.result / s.max);
+         if (fabs(diff) < 1)
+            diff = 1 / diff;
+         if (!s.out_of_bounds_sentry && (diff > 0) && (diff < 3))
+         {
+            s.delta = 0.99f * (s.guess - s.max);
+            s.result = s.guess - s.delta;
+            s.out_of_bounds_sentry = true;
+         }
+         else
+         {
+            if (fabs(float_distance(s.min, s.max)) < 2)
+            {
+               s.result = s.guess = (s.min + s.max) / 2;
+               return false;
+            }
+            s.delta = bracket_root_towards_max(g, s.guess, f0, s.min, s.max, s.count);
+            s.result = s.guess - s.delta;
+            s.guess = s.min;
+            return s.count && (fabs(s.result * factor) < fabs(s.delta));
+         }
+      }
+      // Update brackets:
+      if (s.delta > 0)
+      {
+         s.max = s.guess;
+         s.max_range_f = f0;
+      }
+      else
+      {
+         s.min = s.guess;
+         s.min_range_f = f0;
+      }
+      if (s.max_range_f * s.min_range_f > 0)
+      {
+         s.result = policies::raise_evaluation_error(function, "There appears to be no root to be found in boost::math::tools::batched_root_finder, perhaps we have a local minima near current best guess of %1%", s.guess, pol);
+         return false;
+      }
+      return s.count && (fabs(s.result * factor) < fabs(s.delta));
+   }
+
+   //
+   // Halley or Schroder iteration on problems [first, last) in lockstep, in blocks as above.
+   //
+   template <class Stepper, class F, class T, class Policy>
+   void batched_second_order_root_finder(F& f, const T* guess, const T* min, const T* max, T* root, std::size_t first, std::size_t last, int digits, boost::uintmax_t max_iter, boost::uintmax_t* iterations, const Policy& pol)
+   {
+      BOOST_MATH_STD_USING
+      static const char* function = "boost::math::tools::batched_root_finder<%1%>";
+      const std::size_t block = BOOST_MATH_BATCHED_ROOTS_BLOCK_SIZE;
+
+      const T factor = ldexp(static_cast<T>(1.0), 1 - digits);
+      std::vector<second_order_lane<T> > lanes(block);
+      std::vector<T> f0(block), f1(block), f2(block);
+      std::vector<unsigned char> live(block);
+
+      for (std::size_t start = first; start < last; start += block)
+      {
+         std::size_t width = 0;
+         for (std::size_t i = start; i < (std::min)(last, start + block); ++i)
+         {
+            if (iterations)
+               iterations[i] = 0;
+            if (min[i] >= max[i])
+            {
+               root[i] = policies::raise_evaluation_error(function, "Range arguments in wrong order in boost::math::tools::batched_root_finder(first arg=%1%)", min[i], pol);
+               continue;
+            }
+            second_order_lane<T>& s = lanes[width];
+            s.index = i;
+            s.result = s.guess = guess[i];
+            s.min = min[i];
+            s.max = max[i];
+            s.f0 = s.last_f0 = 0;
+            s.delta = s.delta1 = s.delta2 = (std::max)(T(10000000 * guess[i]), T(10000000));  // arbitrarily large delta
+            s.min_range_f = s.max_range_f = 0;
+            s.count = max_iter;
+            s.out_of_bounds_sentry = false;
+            ++width;
+         }
+
+         while (width)
+         {
+            for (std::size_t k = 0; k < width; ++k)
+            {
+               detail::unpack_tuple(f(lanes[k].index, lanes[k].result), f0[k], f1[k], f2[k]);
+            }
+
+            for (std::size_t k = 0; k < width; ++k)
+            {
+               std::size_t i = lanes[k].index;
+               auto g = [&f, i](const T& x) { return f(i, x); };
+               live[k] = second_order_update<Stepper>(g, lanes[k], f0[k], f1[k], f2[k], factor, pol);
+            }
+
+            std::size_t survivors = 0;
+            for (std::size_t k = 0; k < width; ++k)
+            {
+               if (!live[k])
+               {
+                  root[lanes[k].index] = lanes[k].result;
+                  if (iterations)
+                     iterations[lanes[k].index] = max_iter - lanes[k].count;
+                  continue;
+               }
+               if (survivors != k)
+                  lanes[survivors] = lanes[k];
+               ++survivors;
+            }
+            width = survivors;
+         }
+      }
+   }
+
+#if !defined(BOOST_NO_CXX17_HDR_EXECUTION) && !defined(BOOST_NO_CXX17_IF_CONSTEXPR)
+   // Calls solve(first, last) on runs of whole blocks, so the lockstep inner loops are unaffected by the split:
+   template <class ExecutionPolicy, class Solver>
+   void batched_for_each_run(ExecutionPolicy&& exec, std::size_t n, Solver solve)
+   {
+      const std::size_t chunk = 16 * BOOST_MATH_BATCHED_ROOTS_BLOCK_SIZE;
+      std::vector<std::size_t> starts;
+      for (std::size_t i = 0; i < n; i += chunk)
+         starts.push_back(i);
+      std::for_each(exec, starts.begin(), starts.end(), [&](std::size_t s)
+      {
+         solve(s, (std::min)(n, s + chunk));
+      });
+   }
+#endif
+
+} // namespace detail
+
+//
+// Newton-Raphson iteration on n independent problems.  f(i, x) returns the pair (f_i(x), f_i'(x)).
+// guess, min and max describe problem i at index i; the roots are written to root, and if iterations
+// is non-null the number of function evaluations used for problem i is written to iterations[i].
+//
+template <class F, class T, class Policy>
+void batched_newton_raphson_iterate(F f, const T* guess, const T* min, const T* max, T* root, std::size_t n, int digits, boost::uintmax_t max_iter, boost::uintmax_t* iterations, const Policy& pol)
+{
+   detail::batched_root_finder<detail::batched_newton_step>(f, guess, min, max, root, 0, n, digits, max_iter, iterations, pol);
+}
+
+template <class F, class T>
+inline void batched_newton_raphson_iterate(F f, const T* guess, const T* min, const T* max, T* root, std::size_t n, int digits, boost::uintmax_t max_iter = (std::numeric_limits<boost::uintmax_t>::max)(), boost::uintmax_t* iterations = nullptr)
+{
+   batched_newton_raphson_iterate(f, guess, min, max, root, n, digits, max_iter, iterations, policies::policy<>());
+}
+
+template <class F, class T, class Policy>
+void batched_halley_iterate(F f, const T* guess, const T* min, const T* max, T* root, std::size_t n, int digits, boost::uintmax_t max_iter, boost::uintmax_t* iterations, const Policy& pol)
+{
+   detail::batched_second_order_root_finder<detail::halley_step>(f, guess, min, max, root, 0, n, digits, max_iter, iterations, pol);
+}
+
+template <class F, class T>
+inline void batched_halley_iterate(F f, const T* guess, const T* min, const T* max, T* root, std::size_t n, int digits, boost::uintmax_t max_iter = (std::numeric_limits<boost::uintmax_t>::max)(), boost::uintmax_t* iterations = nullptr)
+{
+   batched_halley_iterate(f, guess, min, max, root, n, digits, max_iter, iterations, policies::policy<>());
+}
+
+template <class F, class T, class Policy>
+void batched_schroder_iterate(F f, const T* guess, const T* min, const T* max, T* root, std::size_t n, int digits, boost::uintmax_t max_iter, boost::uintmax_t* iterations, const Policy& pol)
+{
+   detail::batched_second_order_root_finder<detail::schroder_stepper>(f, guess, min, max, root, 0, n, digits, max_iter, iterations, pol);
+}
+
+template <class F, class T>
+inline void batched_schroder_iterate(F f, const T* guess, const T* min, const T* max, T* root, std::size_t n, int digits, boost::uintmax_t max_iter = (std::numeric_limits<boost::uintmax_t>::max)(), boost::uintmax_t* iterations = nullptr)
+{
+   batched_schroder_iterate(f, guess, min, max, root, n, digits, max_iter, iterations, policies::policy<>());
+}
+
+//
+// TOMS 748 on n independent brackets [a[i], b[i]].  The method's step selection varies too much
+// from one iteration to the next to run in lockstep, so this simply drives the scalar solver over
+// the batch; it exists so that bracketing problems can share the parallel outer loop below.
+//
+template <class F, class T, class Tol, class Policy>
+void batched_toms748_solve(F f, const T* a, const T* b, Tol tol, std::pair<T, T>* bracket, std::size_t n, boost::uintmax_t max_iter, boost::uintmax_t* iterations, const Policy& pol)
+{
+   for (std::size_t i = 0; i < n; ++i)
+   {
+      boost::uintmax_t m = max_iter;
+      bracket[i] = toms748_solve([&f, i](const T& x) { return f(i, x); }, a[i], b[i], tol, m, pol);
+      if (iterations)
+         iterations[i] = m;
+   }
+}
+
+template <class F, class T, class Tol>
+inline void batched_toms748_solve(F f, const T* a, const T* b, Tol tol, std::pair<T, T>* bracket, std::size_t n, boost::uintmax_t max_iter = (std::numeric_limits<boost::uintmax_t>::max)(), boost::uintmax_t* iterations = nullptr)
+{
+   batched_toms748_solve(f, a, b, tol, bracket, n, max_iter, iterations, policies::policy<>());
+}
+
+#if !defined(BOOST_NO_CXX17_HDR_EXECUTION) && !defined(BOOST_NO_CXX17_IF_CONSTEXPR)
+//
+// Parallel versions: the batch is split into runs of whole blocks, each of which is solved in lockstep.
+// The functor is shared between threads, so f(i, x) must be safe to call concurrently.
+//
+template <class ExecutionPolicy, class F, class T, class Policy, class = typename std::enable_if<std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value>::type>
+void batched_newton_raphson_iterate(ExecutionPolicy&& exec, F f, const T* guess, const T* min, const T* max, T* root, std::size_t n, int digits, boost::uintmax_t max_iter, boost::uintmax_t* iterations, const Policy& pol)
+{
+   detail::batched_for_each_run(exec, n, [&](std::size_t first, std::size_t last)
+   {
+      detail::batched_root_finder<detail::batched_newton_step>(f, guess, min, max, root, first, last, digits, max_iter, iterations, pol);
+   });
+}
+
+template <class ExecutionPolicy, class F, class T, class = typename std::enable_if<std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value>::type>
+inline void batched_newton_raphson_iterate(ExecutionPolicy&& exec, F f, const T* guess, const T* min, const T* max, T* root, std::size_t n, int digits, boost::uintmax_t max_iter = (std::numeric_limits<boost::uintmax_t>::max)(), boost::uintmax_t* iterations = nullptr)
+{
+   batched_newton_raphson_iterate(exec, f, guess, min, max, root, n, digits, max_iter, iterations, policies::policy<>());
+}
+
+template <class ExecutionPolicy, class F, class T, class Policy, class = typename std::enable_if<std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value>::type>
+void batched_halley_iterate(ExecutionPolicy&& exec, F f, const T* guess, const T* min, const T* max, T* root, std::size_t n, int digits, boost::uintmax_t max_iter, boost::uintmax_t* iterations, const Policy& pol)
+{
+   detail::batched_for_each_run(exec, n, [&](std::size_t first, std::size_t last)
+   {
+      detail::batched_second_order_root_finder<detail::halley_step>(f, guess, min, max, root, first, last, digits, max_iter, iterations, pol);
+   });
+}
+
+template <class ExecutionPolicy, class F, class T, class = typename std::enable_if<std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value>::type>
+inline void batched_halley_iterate(ExecutionPolicy&& exec, F f, const T* guess, const T* min, const T* max, T* root, std::size_t n, int digits, boost::uintmax_t max_iter = (std::numeric_limits<boost::uintmax_t>::max)(), boost::uintmax_t* iterations = nullptr)
+{
+   batched_halley_iterate(exec, f, guess, min, max, root, n, digits, max_iter, iterations, policies::policy<>());
+}
+
+template <class ExecutionPolicy, class F, class T, class Policy, class = typename std::enable_if<std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value>::type>
+void batched_schroder_iterate(ExecutionPolicy&& exec, F f, const T* guess, const T* min, const T* max, T* root, std::size_t n, int digits, boost::uintmax_t max_iter, boost::uintmax_t* iterations, const Policy& pol)
+{
+   detail::batched_for_each_run(exec, n, [&](std::size_t first, std::size_t last)
+   {
+      detail::batched_second_order_root_finder<detail::schroder_stepper>(f, guess, min, max, root, first, last, digits, max_iter, iterations, pol);
+   });
+}
+
+template <class ExecutionPolicy, class F, class T, class = typename std::enable_if<std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value>::type>
+inline void batched_schroder_iterate(ExecutionPolicy&& exec, F f, const T* guess, const T* min, const T* max, T* root, std::size_t n, int digits, boost::uintmax_t max_iter = (std::numeric_limits<boost::uintmax_t>::max)(), boost::uintmax_t* iterations = nullptr)
+{
+   batched_schroder_iterate(exec, f, guess, min, max, root, n, digits, max_iter, iterations, policies::policy<>());
+}
+
+template <class ExecutionPolicy, class F, class T, class Tol, class Policy, class = typename std::enable_if<std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value>::type>
+void batched_toms748_solve(ExecutionPolicy&& exec, F f, const T* a, const T* b, Tol tol, std::pair<T, T>* bracket, std::size_t n, boost::uintmax_t max_iter, boost::uintmax_t* iterations, const Policy& pol)
+{
+   detail::batched_for_each_run(exec, n, [&](std::size_t first, std::size_t last)
+   {
+      auto g = [&f, first](std::size_t i, const T& x) { return f(first + i, x); };
+      batched_toms748_solve(g, a + first, b + first, tol, bracket + first, last - first, max_iter, iterations ? iterations + first : nullptr, pol);
+   });
+}
+
+template <class ExecutionPolicy, class F, class T, class Tol, class = typename std::enable_if<std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value>::type>
+inline void batched_toms748_solve(ExecutionPolicy&& exec, F f, const T* a, const T* b, Tol tol, std::pair<T, T>* bracket, std::size_t n, boost::uintmax_t max_iter = (std::numeric_limits<boost::uintmax_t>::max)(), boost::uintmax_t* iterations = nullptr)
+{
+   batched_toms748_solve(exec, f, a, b, tol, bracket, n, max_iter, iterations, policies::policy<>());
+}
+#endif
+
+} // namespace tools
+} // namespace math
+} // namespace boost
+
+#endif // BOOST_MATH_TOOLS_BATCHED_ROOTS_HPP
@@ -0,0 +1,579 @@
+//  (C) Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// A header-only FFT and the real and cosine transforms built on it.
+// The goal is not to compete with FFTW, but to remove the dependency on it for the transforms used internally by Boost.Math,
+// and to support every Real type the library supports, including multiprecision types.
+// Lengths which are products of small primes use a mixed-radix transform; other lengths use Bluestein's algorithm.
+
+#ifndef BOOST_MATH_TOOLS_DETAIL_FFT_HPP
+#define BOOST_MATH_TOOLS_DETAIL_FFT_HPP
+#include <cmath>
+#include <complex>
+#include <list>
+#include <memory>
+#include <vector>
+#include <stdexcept>
+#include <utility>
+#include <boost/config.hpp>
+#include <boost/math/constants/constants.hpp>
+#ifdef BOOST_HAS_THREADS
+#include <boost/detail/lightweight_mutex.hpp>
+#endif
+
+#ifdef BOOST_HAS_FLOAT128
+#include <quadmath.h>
+#endif
+
+namespace boost { namespace math { namespace tools { namespace detail {
+
+template<class Real>
+inline Real fft_cos(Real x)
+{
+    using std::cos;
+    return cos(x);
+}
+
+template<class Real>
+inline Real fft_sin(Real x)
+{
+    using std::sin;
+    return sin(x);
+}
+
+#ifdef BOOST_HAS_FLOAT128
+template<>
+inline __float128 fft_cos(__float128 x)
+{
+    return cosq(x);
+}
+
+template<>
+inline __float128 fft_sin(__float128 x)
+{
+    return sinq(x);
+}
+#endif
+
+// exp(-2*pi*i*k/n), computed using the symmetries of sine and cosine so that the argument passed to them is at most pi/4.
+// Then the result is accurate to a few ulps for every k, even where sine or cosine is small.
+template<class Real>
+std::complex<Real> fft_root_of_unity(size_t k, size_t n)
+{
+    using boost::math::constants::two_pi;
+    k %= n;
+    // Work in units of 2pi/(8n), so that all the reflections below are exact integer operations:
+    size_t N = 8*n;
+    size_t K = 8*k;
+    // exp(-i(2pi - theta)) = conj(exp(-i*theta)):
+    bool conjugate = false;
+    if (2*K > N)
+    {
+        K = N - K;
+        conjugate = true;
+    }
+    // cos(pi - theta) = -cos(theta), sin(pi - theta) = sin(theta):
+    bool negate_cos = false;
+    if (4*K > N)
+    {
+        K = N/2 - K;
+        negate_cos = true;
+    }
+    // cos(pi/2 - theta) = sin(theta), sin(pi/2 - theta) = cos(theta):
+    bool swap = false;
+    if (8*K > N)
+    {
+        K = N/4 - K;
+        swap = true;
+    }
+    Real c;
+    Real s;
+    if (K == 0)
+    {
+        c = 1;
+        s = 0;
+    }
+    else
+    {
+        Real theta = two_pi<Real>()*static_cast<Real>(K)/static_cast<Real>(N);
+        c = fft_cos(theta);
+        s = fft_sin(theta);
+    }
+    if (swap)
+    {
+        std::swap(c, s);
+    }
+    if (negate_cos)
+    {
+        c = -c;
+    }
+    std::complex<Real> w(c, -s);
+    if (conjugate)
+    {
+        w = std::conj(w);
+    }
+    return w;
+}
+
+// A decimation in time FFT for lengths with arbitrary factorizations.
+// Factors of 4, 2 and 3 get specialized butterflies; other prime factors p use an O(p^2) butterfly,
+// so this is only efficient for lengths which are products of small primes.
+// The plan (factorization and twiddle factors) is computed once in the constructor, and execute may be called any number of times.
+template<class Real>
+class mixed_radix_fft
+{
+public:
+    using complex_type = std::complex<Real>;
+
+    explicit mixed_radix_fft(size_t n) : m_n{n}
+    {
+        if (n == 0)
+        {
+            throw std::domain_error("The length of the FFT must be > 0.");
+        }
+        size_t m = n;
+        size_t p = 4;
+        // Factor out 4s first, then 2s, then odd primes:
+        while (m > 1)
+        {
+            while (m % p != 0)
+            {
+                switch (p)
+                {
+                    case 4: p = 2; break;
+                    case 2: p = 3; break;
+                    default: p += 2; break;
+                }
+                if (p*p > m)
+                {
+                    p = m;
+                }
+            }
+            m /= p;
+            m_factors.push_back(p);
+            m_factors.push_back(m);
+        }
+        m_twiddles.resize(n);
+        for (size_t k = 0; k < n; ++k)
+        {
+            m_twiddles[k] = fft_root_of_unity<Real>(k, n);
+        }
+    }
+
+    size_t size() const
+    {
+        return m_n;
+    }
+
+    // out[k] = sum_j in[j] exp(-2*pi*i*jk/n) for the forward transform, exp(+2*pi*i*jk/n) for the inverse transform.
+    // The inverse is not normalized. The input and output must not overlap.
+    void execute(const complex_type* in, complex_type* out, bool inverse = false) const
+    {
+        if (m_n == 1)
+        {
+            out[0] = in[0];
+            return;
+        }
+        work(out, in, 1, m_factors.data(), inverse);
+    }
+
+private:
+    complex_type twiddle(size_t k, bool inverse) const
+    {
+        return inverse ? std::conj(m_twiddles[k]) : m_twiddles[k];
+    }
+
+    void work(complex_type* out, const complex_type* in, size_t fstride, const size_t* factors, bool inverse) const
+    {
+        const size_t p = factors[0];
+        const size_t m = factors[1];
+        complex_type* const out_begin = out;
+        complex_type* const out_end = out + p*m;
+        if (m == 1)
+        {
+            do
+            {
+                *out = *in;
+                in += fstride;
+            } while (++out != out_end);
+        }
+        else
+        {
+            do
+            {
+                work(out, in, fstride*p, factors + 2, inverse);
+                in += fstride;
+            } while ((out += m) != out_end);
+        }
+
+        switch (p)
+        {
+            case 2: butterfly_2(out_begin, fstride, m, inverse); break;
+            case 3: butterfly_3(out_begin, fstride, m, inverse); break;
+            case 4: butterfly_4(out_begin, fstride, m, inverse); break;
+            default: butterfly_generic(out_begin, fstride, m, p, inverse); break;
+        }
+    }
+
+    void butterfly_2(complex_type* out, size_t fstride, size_t m, bool inverse) const
+    {
+        complex_type* out2 = out + m;
+        for (size_t k = 0; k < m; ++k)
+        {
+            complex_type t = out2[k]*twiddle(k*fstride, inverse);
+            out2[k] = out[k] - t;
+            out[k] += t;
+        }
+    }
+
+    void butterfly_3(complex_type* out, size_t fstride, size_t m, bool inverse) const
+    {
+        using boost::math::constants::half;
+        // Imaginary part of exp(-2*pi*i/3):
+        const Real s = (inverse ? 1 : -1)*boost::math::constants::root_three<Real>()/2;
+        for (size_t k = 0; k < m; ++k)
+        {
+            complex_type a1 = out[k + m]*twiddle(k*fstride, inverse);
+            complex_type a2 = out[k + 2*m]*twiddle(2*k*fstride, inverse);
+            complex_type sum = a1 + a2;
+            complex_type diff = a1 - a2;
+            complex_type a0 = out[k];
+            out[k] = a0 + sum;
+            complex_type mid = a0 - half<Real>()*sum;
+            complex_type rot(-s*diff.imag(), s*diff.real());
+            out[k + m] = mid + rot;
+            out[k + 2*m] = mid - rot;
+        }
+    }
+
+    void butterfly_4(complex_type* out, size_t fstride, size_t m, bool inverse) const
+    {
+        for (size_t k = 0; k < m; ++k)
+        {
+            complex_type a0 = out[k];
+            complex_type a1 = out[k + m]*twiddle(k*fstride, inverse);
+            complex_type a2 = out[k + 2*m]*twiddle(2*k*fstride, inverse);
+            complex_type a3 = out[k + 3*m]*twiddle(3*k*fstride, inverse);
+            complex_type s0 = a0 + a2;
+            complex_type s1 = a0 - a2;
+            complex_type s2 = a1 + a3;
+            complex_type s3 = a1 - a3;
+            // -i*s3 for the forward transform, +i*s3 for the inverse:
+            complex_type rot = inverse ? complex_type(-s3.imag(), s3.real()) : complex_type(s3.imag(), -s3.real());
+            out[k] = s0 + s2;
+            out[k + m] = s1 + rot;
+            out[k + 2*m] = s0 - s2;
+            out[k + 3*m] = s1 - rot;
+        }
+    }
+
+    // p is an odd prime. The terms q and p - q are paired, so that the DFT of length p costs about half the multiplications
+    // and, for instance, the transform of constant data has imaginary part identically zero:
+    // y_q W^{qk} + y_{p-q} W^{-qk} = (y_q + y_{p-q})cos(2pi qk/p) -+ i(y_q - y_{p-q})sin(2pi qk/p).
+    void butterfly_generic(complex_type* out, size_t fstride, size_t m, size_t p, bool inverse) const
+    {
+        std::vector<complex_type> sums(p/2 + 1);
+        std::vector<complex_type> diffs(p/2 + 1);
+        const size_t root_stride = fstride*m;
+        for (size_t u = 0; u < m; ++u)
+        {
+            complex_type y0 = out[u];
+            for (size_t q = 1; q <= p/2; ++q)
+            {
+                complex_type a = out[u + q*m]*twiddle(fstride*u*q, inverse);
+                complex_type b = out[u + (p-q)*m]*twiddle(fstride*u*(p-q), inverse);
+                sums[q] = a + b;
+                diffs[q] = a - b;
+            }
+            complex_type total = y0;
+            for (size_t q = 1; q <= p/2; ++q)
+            {
+                total += sums[q];
+            }
+            out[u] = total;
+            for (size_t k = 1; k <= p/2; ++k)
+            {
+                complex_type re = y0;
+                complex_type im(0, 0);
+                size_t idx = 0;
+                for (size_t q = 1; q <= p/2; ++q)
+                {
+                    idx += k;
+                    if (idx >= p)
+                    {
+                        idx -= p;
+                    }
+                    // W^{idx} = cos(theta) - i*sin(theta) for the forward transform:
+                    complex_type w = twiddle(idx*root_stride, inverse);
+                    re += sums[q]*w.real();
+                    im += diffs[q]*w.imag();
+                }
+                // i*im:
+                complex_type rot(-im.imag(), im.real());
+                out[u + k*m] = re + rot;
+                out[u + (p-k)*m] = re - rot;
+            }
+        }
+    }
+
+    size_t m_n;
+    // Pairs (p, m) with p the radix of a stage and m the length of the subtransforms:
+    std::vector<size_t> m_factors;
+    std::vector<complex_type> m_twiddles;
+};
+
+inline size_t largest_prime_factor(size_t n)
+{
+    size_t largest = 1;
+    for (size_t p = 2; p*p <= n; ++p)
+    {
+        while (n % p == 0)
+        {
+            largest = p;
+            n /= p;
+        }
+    }
+    return n > largest ? n : largest;
+}
+
+// A complex FFT of any length.
+// If the length has a prime factor larger than the threshold, the O(p^2) butterfly of the mixed-radix transform is too slow,
+// and the transform is instead computed as a convolution of power of two length by Bluestein's algorithm:
+// L. Bluestein, "A linear filtering approach to the computation of discrete Fourier transform," IEEE Trans. Audio Electroacoust. 18 (1970) 451–455.
+template<class Real>
+class complex_fft
+{
+public:
+    using complex_type = std::complex<Real>;
+
+    explicit complex_fft(size_t n) : m_n{n}
+    {
+        if (n == 0)
+        {
+            throw std::domain_error("The length of the FFT must be > 0.");
+        }
+        if (largest_prime_factor(n) <= bluestein_threshold())
+        {
+            m_fft = std::make_shared<mixed_radix_fft<Real>>(n);
+            return;
+        }
+        size_t m = 1;
+        while (m < 2*n - 1)
+        {
+            m *= 2;
+        }
+        m_fft = std::make_shared<mixed_radix_fft<Real>>(m);
+        // Chirp w[k] = exp(-i*pi*k^2/n); k^2 is reduced modulo 2n so that the argument stays small.
+        m_chirp.resize(n);
+        for (size_t k = 0; k < n; ++k)
+        {
+            m_chirp[k] = fft_root_of_unity<Real>((k*k) % (2*n), 2*n);
+        }
+        std::vector<complex_type> b(m, complex_type(0));
+        b[0] = std::conj(m_chirp[0]);
+        for (size_t k = 1; k < n; ++k)
+        {
+            b[k] = std::conj(m_chirp[k]);
+            b[m - k] = std::conj(m_chirp[k]);
+        }
+        m_chirp_transform.resize(m);
+        m_fft->execute(b.data(), m_chirp_transform.data());
+    }
+
+    size_t size() const
+    {
+        return m_n;
+    }
+
+    // Safe to call concurrently from multiple threads; the input and output must not overlap.
+    void execute(const complex_type* in, complex_type* out, bool inverse = false) const
+    {
+        if (m_chirp.empty())
+        {
+            m_fft->execute(in, out, inverse);
+            return;
+        }
+        // The inverse transform is conj(F(conj(x))):
+        size_t m = m_fft->size();
+        std::vector<complex_type> a(m, complex_type(0));
+        std::vector<complex_type> A(m);
+        for (size_t k = 0; k < m_n; ++k)
+        {
+            a[k] = (inverse ? std::conj(in[k]) : in[k])*m_chirp[k];
+        }
+        m_fft->execute(a.data(), A.data());
+        for (size_t k = 0; k < m; ++k)
+        {
+            A[k] *= m_chirp_transform[k];
+        }
+        m_fft->execute(A.data(), a.data(), true);
+        Real inv_m = 1/static_cast<Real>(m);
+        for (size_t k = 0; k < m_n; ++k)
+        {
+            complex_type X = a[k]*m_chirp[k]*inv_m;
+            out[k] = inverse ? std::conj(X) : X;
+        }
+    }
+
+    static size_t bluestein_threshold()
+    {
+        return 31;
+    }
+
+private:
+    size_t m_n;
+    std::shared_ptr<mixed_radix_fft<Real>> m_fft;
+    std::vector<complex_type> m_chirp;
+    std::vector<complex_type> m_chirp_transform;
+};
+
+// The transform of real data of length n, returning the n/2 + 1 non-redundant coefficients
+// X[k] = sum_j x[j] exp(-2*pi*i*jk/n), k = 0, ..., n/2.
+// For even n, the data is packed into a complex vector of half the length.
+template<class Real>
+class real_fft
+{
+public:
+    using complex_type = std::complex<Real>;
+
+    explicit real_fft(size_t n) : m_n{n}, m_fft(n % 2 == 0 ? n/2 : n)
+    {
+        if (n % 2 == 0)
+        {
+            m_twiddles.resize(n/2 + 1);
+            for (size_t k = 0; k <= n/2; ++k)
+            {
+                m_twiddles[k] = fft_root_of_unity<Real>(k, n);
+            }
+        }
+    }
+
+    size_t size() const
+    {
+        return m_n;
+    }
+
+    // out must have room for size()/2 + 1 elements. Safe to call concurrently from multiple threads.
+    void execute(const Real* in, complex_type* out) const
+    {
+        using boost::math::constants::half;
+        if (m_n % 2 == 1)
+        {
+            std::vector<complex_type> z(in, in + m_n);
+            std::vector<complex_type> Z(m_n);
+            m_fft.execute(z.data(), Z.data());
+            std::copy(Z.begin(), Z.begin() + m_n/2 + 1, out);
+            return;
+        }
+        size_t h = m_n/2;
+        std::vector<complex_type> z(h);
+        std::vector<complex_type> Z(h);
+        for (size_t j = 0; j < h; ++j)
+        {
+            z[j] = complex_type(in[2*j], in[2*j + 1]);
+        }
+        m_fft.execute(z.data(), Z.data());
+        for (size_t k = 0; k <= h; ++k)
+        {
+            complex_type Zk = Z[k == h ? 0 : k];
+            complex_type Zr = std::conj(Z[k == 0 ? 0 : h - k]);
+            complex_type even = half<Real>()*(Zk + Zr);
+            complex_type diff = half<Real>()*(Zk - Zr);
+            // odd = diff/i = -i*diff:
+            complex_type odd(diff.imag(), -diff.real());
+            out[k] = even + m_twiddles[k]*odd;
+        }
+    }
+
+private:
+    size_t m_n;
+    complex_fft<Real> m_fft;
+    std::vector<complex_type> m_twiddles;
+};
+
+// The DCT-II in the normalization used by FFTW's REDFT10:
+// y[k] = 2*sum_{j=0}^{n-1} x[j]*cos(pi*(j+1/2)*k/n).
+// Uses Makhoul's reordering, which reduces the DCT-II to a single complex FFT of the same length:
+// J. Makhoul, "A fast cosine transform in one and two dimensions," IEEE Trans. Acoust. Speech Signal Process. 28 (1980) 27–34.
+template<class Real>
+class dct_ii
+{
+public:
+    explicit dct_ii(size_t n) : m_fft(n), m_w(n)
+    {
+        for (size_t k = 0; k < n; ++k)
+        {
+            m_w[k] = fft_root_of_unity<Real>(k, 4*n);
+        }
+    }
+
+    size_t size() const
+    {
+        return m_fft.size();
+    }
+
+    // The input and output may alias. Safe to call concurrently from multiple threads.
+    void execute(const Real* x, Real* y) const
+    {
+        size_t n = m_fft.size();
+        std::vector<std::complex<Real>> v(n);
+        std::vector<std::complex<Real>> V(n);
+        for (size_t j = 0; 2*j < n; ++j)
+        {
+            v[j] = x[2*j];
+        }
+        for (size_t j = 0; 2*j + 1 < n; ++j)
+        {
+            v[n - 1 - j] = x[2*j + 1];
+        }
+        m_fft.execute(v.data(), V.data());
+        for (size_t k = 0; k < n; ++k)
+        {
+            y[k] = 2*(m_w[k]*V[k]).real();
+        }
+    }
+
+private:
+    complex_fft<Real> m_fft;
+    std::vector<std::complex<Real>> m_w;
+};
+
+// Plans are immutable once constructed and execute is thread-safe, so plans are shared by all users.
+// Constructing a plan costs O(n) transcendental function evaluations, which dominates the cost of a single transform
+// for multiprecision types, so reusing them is worthwhile.
+// Each plan holds O(n) twiddle factors, so only the BOOST_MATH_FFT_PLAN_CACHE_SIZE most recently requested lengths
+// are kept for each plan type; an evicted plan lives on for as long as a caller holds it.
+#ifndef BOOST_MATH_FFT_PLAN_CACHE_SIZE
+#define BOOST_MATH_FFT_PLAN_CACHE_SIZE 16
+#endif
+
+template<class Plan>
+std::shared_ptr<const Plan> get_fft_plan(size_t n)
+{
+    // Most recently used first:
+    static std::list<std::shared_ptr<const Plan>> cache;
+#ifdef BOOST_HAS_THREADS
+    static boost::detail::lightweight_mutex mutex;
+    boost::detail::lightweight_mutex::scoped_lock lock(mutex);
+#endif
+    for (auto it = cache.begin(); it != cache.end(); ++it)
+    {
+        if ((*it)->size() == n)
+        {
+            cache.splice(cache.begin(), cache, it);
+            return cache.front();
+        }
+    }
+    auto plan = std::make_shared<const Plan>(n);
+    cache.push_front(plan);
+    if (cache.size() > BOOST_MATH_FFT_PLAN_CACHE_SIZE)
+    {
+        cache.pop_back();
+    }
+    return plan;
+}
+
+}}}}
+#endif
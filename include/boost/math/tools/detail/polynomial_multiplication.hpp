@@ -0,0 +1,324 @@
+//  (C) Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+// Multiplication of dense coefficient vectors for tools::polynomial.
+// Products of inexact coefficients use the schoolbook method, whose error is bounded relative to each coefficient.
+// Products of exact coefficients are the same by any method, so longer ones use Karatsuba's method, which only needs a ring,
+// and above a further threshold products of built-in signed integers use number theoretic transforms modulo three primes
+// recombined by the CRT.  The FFT, whose error is only bounded relative to the largest coefficients, is used for floating point
+// coefficients only when asked for by name, see tools::fft_multiply.
+
+#ifndef BOOST_MATH_TOOLS_DETAIL_POLYNOMIAL_MULTIPLICATION_HPP
+#define BOOST_MATH_TOOLS_DETAIL_POLYNOMIAL_MULTIPLICATION_HPP
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#include <algorithm>
+#include <complex>
+#include <cstddef>
+#include <vector>
+#include <boost/cstdint.hpp>
+#include <limits>
+#include <boost/type_traits/integral_constant.hpp>
+#include <boost/type_traits/is_integral.hpp>
+#include <boost/type_traits/is_signed.hpp>
+#include <boost/math/tools/detail/fft.hpp>
+
+// Below this length in the shorter operand the schoolbook product is used for exact types:
+#ifndef BOOST_MATH_POLYNOMIAL_KARATSUBA_THRESHOLD
+#define BOOST_MATH_POLYNOMIAL_KARATSUBA_THRESHOLD 32
+#endif
+// From this length in the shorter operand, fft_multiply uses the FFT:
+#ifndef BOOST_MATH_POLYNOMIAL_FFT_THRESHOLD
+#define BOOST_MATH_POLYNOMIAL_FFT_THRESHOLD 256
+#endif
+// From this length in the shorter operand, built-in signed integer products use the NTT:
+#ifndef BOOST_MATH_POLYNOMIAL_NTT_THRESHOLD
+#define BOOST_MATH_POLYNOMIAL_NTT_THRESHOLD 128
+#endif
+
+namespace boost{ namespace math{ namespace tools{ namespace detail{
+
+// out[0, na + nb - 1) = a * b; out must not alias the inputs.
+template <class T>
+void schoolbook_multiply(const T* a, std::size_t na, const T* b, std::size_t nb, T* out)
+{
+   std::fill(out, out + na + nb - 1, T(0));
+   for (std::size_t i = 0; i < na; ++i)
+      for (std::size_t j = 0; j < nb; ++j)
+         out[i + j] += a[i] * b[j];
+}
+
+// Balanced Karatsuba: both operands have length n, out has length 2n - 1.
+template <class T>
+void karatsuba_multiply(const T* a, const T* b, std::size_t n, T* out)
+{
+   if (n < BOOST_MATH_POLYNOMIAL_KARATSUBA_THRESHOLD)
+   {
+      schoolbook_multiply(a, n, b, n, out);
+      return;
+   }
+   std::size_t m = n / 2;
+   std::size_t h = n - m;
+   // z0 = a0*b0 lands in out[0, 2m - 1), z2 = a1*b1 in out[2m, 2n - 1):
+   karatsuba_multiply(a, b, m, out);
+   out[2 * m - 1] = T(0);
+   karatsuba_multiply(a + m, b + m, h, out + 2 * m);
+
+   std::vector<T> sa(a + m, a + n), sb(b + m, b + n), z1(2 * h - 1);
+   for (std::size_t i = 0; i < m; ++i)
+   {
+      sa[i] += a[i];
+      sb[i] += b[i];
+   }
+   karatsuba_multiply(sa.data(), sb.data(), h, z1.data());
+   for (std::size_t i = 0; i < 2 * m - 1; ++i)
+      z1[i] -= out[i];
+   for (std::size_t i = 0; i < 2 * h - 1; ++i)
+      z1[i] -= out[2 * m + i];
+   for (std::size_t i = 0; i < 2 * h - 1; ++i)
+      out[m + i] += z1[i];
+}
+
+// Unbalanced operands are cut into pieces the length of the shorter one:
+template <class T>
+void karatsuba_multiply(const T* a, std::size_t na, const T* b, std::size_t nb, T* out)
+{
+   if (na < nb)
+   {
+      std::swap(a, b);
+      std::swap(na, nb);
+   }
+   if (nb < BOOST_MATH_POLYNOMIAL_KARATSUBA_THRESHOLD)
+   {
+      schoolbook_multiply(a, na, b, nb, out);
+      return;
+   }
+   if (na == nb)
+   {
+      karatsuba_multiply(a, b, na, out);
+      return;
+   }
+   std::fill(out, out + na + nb - 1, T(0));
+   std::vector<T> piece(2 * nb - 1);
+   for (std::size_t s = 0; s < na; s += nb)
+   {
+      std::size_t len = (std::min)(nb, na - s);
+      piece.resize(len + nb - 1);
+      karatsuba_multiply(a + s, len, b, nb, piece.data());
+      for (std::size_t i = 0; i < piece.size(); ++i)
+         out[s + i] += piece[i];
+   }
+}
+
+// Real convolution by one complex FFT of a + ib, followed by one inverse transform.
+// The error is bounded by a small multiple of eps*log(n)*max|a|*max|b| in every coefficient,
+// rather than relative to each coefficient as for the direct methods.
+template <class T>
+void fft_multiply(const T* a, std::size_t na, const T* b, std::size_t nb, T* out)
+{
+   typedef std::complex<T> complex_type;
+   std::size_t len = na + nb - 1;
+   std::size_t n = 1;
+   while (n < len)
+      n *= 2;
+   auto plan = get_fft_plan<complex_fft<T> >(n);
+   std::vector<complex_type> z(n, complex_type(0)), Z(n);
+   for (std::size_t i = 0; i < na; ++i)
+      z[i].real(a[i]);
+   for (std::size_t i = 0; i < nb; ++i)
+      z[i].imag(b[i]);
+   plan->execute(z.data(), Z.data());
+   // A_k = (Z_k + conj(Z_{n-k}))/2, B_k = (Z_k - conj(Z_{n-k}))/(2i), so A_k B_k = (Z_k^2 - conj(Z_{n-k})^2)/(4i):
+   for (std::size_t k = 0; k < n; ++k)
+   {
+      complex_type zk = Z[k];
+      complex_type zc = std::conj(Z[(n - k) % n]);
+      complex_type d = zk * zk - zc * zc;
+      z[k] = complex_type(d.imag(), -d.real()) / T(4);
+   }
+   plan->execute(z.data(), Z.data(), true);
+   for (std::size_t i = 0; i < len; ++i)
+      out[i] = Z[i].real() / static_cast<T>(n);
+}
+
+//
+// Number theoretic transforms modulo the primes 119*2^23 + 1, 5*2^25 + 1 and 7*2^26 + 1, all with primitive root 3,
+// so transforms of length up to 2^23 exist modulo each of them.
+//
+
+inline boost::uint32_t ntt_power(boost::uint64_t b, boost::uint64_t e, boost::uint32_t p)
+{
+   boost::uint64_t r = 1;
+   b %= p;
+   while (e)
+   {
+      if (e & 1)
+         r = r * b % p;
+      b = b * b % p;
+      e >>= 1;
+   }
+   return static_cast<boost::uint32_t>(r);
+}
+
+inline void ntt(std::vector<boost::uint32_t>& x, boost::uint32_t p, bool inverse)
+{
+   std::size_t n = x.size();
+   for (std::size_t i = 1, j = 0; i < n; ++i)
+   {
+      std::size_t bit = n >> 1;
+      for (; j & bit; bit >>= 1)
+         j ^= bit;
+      j ^= bit;
+      if (i < j)
+         std::swap(x[i], x[j]);
+   }
+   std::vector<boost::uint32_t> w;
+   for (std::size_t len = 2; len <= n; len <<= 1)
+   {
+      boost::uint32_t wl = ntt_power(3, (p - 1) / len, p);
+      if (inverse)
+         wl = ntt_power(wl, p - 2, p);
+      std::size_t half = len / 2;
+      w.resize(half);
+      w[0] = 1;
+      for (std::size_t k = 1; k < half; ++k)
+         w[k] = static_cast<boost::uint32_t>(static_cast<boost::uint64_t>(w[k - 1]) * wl % p);
+      for (std::size_t i = 0; i < n; i += len)
+      {
+         for (std::size_t k = 0; k < half; ++k)
+         {
+            boost::uint32_t u = x[i + k];
+            boost::uint32_t v = static_cast<boost::uint32_t>(static_cast<boost::uint64_t>(x[i + k + half]) * w[k] % p);
+            x[i + k] = u + v >= p ? u + v - p : u + v;
+            x[i + k + half] = u >= v ? u - v : u + p - v;
+         }
+      }
+   }
+   if (inverse)
+   {
+      boost::uint64_t n_inv = ntt_power(n, p - 2, p);
+      for (std::size_t i = 0; i < n; ++i)
+         x[i] = static_cast<boost::uint32_t>(x[i] * n_inv % p);
+   }
+}
+
+template <class T>
+inline boost::uint32_t ntt_residue(const T& v, boost::uint32_t p)
+{
+   long long r = static_cast<long long>(v) % static_cast<long long>(p);
+   return static_cast<boost::uint32_t>(r < 0 ? r + p : r);
+}
+
+// The CRT recovers each coefficient modulo P = p0*p1*p2 (about 2^86), so the result is exact whenever it is representable in T.
+// Only signed types come here: unsigned products are defined to wrap modulo 2^k, which Karatsuba reproduces and the CRT does not.
+template <class T>
+void ntt_multiply(const T* a, std::size_t na, const T* b, std::size_t nb, T* out)
+{
+   static const boost::uint32_t primes[3] = { 998244353u, 167772161u, 469762049u };
+   std::size_t len = na + nb - 1;
+   std::size_t n = 1;
+   while (n < len)
+      n *= 2;
+   std::vector<boost::uint32_t> r[3];
+   for (int q = 0; q < 3; ++q)
+   {
+      boost::uint32_t p = primes[q];
+      std::vector<boost::uint32_t> x(n, 0), y(n, 0);
+      for (std::size_t i = 0; i < na; ++i)
+         x[i] = ntt_residue(a[i], p);
+      for (std::size_t i = 0; i < nb; ++i)
+         y[i] = ntt_residue(b[i], p);
+      ntt(x, p, false);
+      ntt(y, p, false);
+      for (std::size_t i = 0; i < n; ++i)
+         x[i] = static_cast<boost::uint32_t>(static_cast<boost::uint64_t>(x[i]) * y[i] % p);
+      ntt(x, p, true);
+      r[q].swap(x);
+   }
+   // Garner: c = v0 + p0*v1 + p0*p1*v2 with 0 <= v_i < p_i.
+   const boost::uint64_t p0 = primes[0], p1 = primes[1], p2 = primes[2];
+   const boost::uint64_t p0_inv_p1 = ntt_power(p0, p1 - 2, static_cast<boost::uint32_t>(p1));
+   const boost::uint64_t p01_inv_p2 = ntt_power(p0 * p1 % p2, p2 - 2, static_cast<boost::uint32_t>(p2));
+   const boost::uint64_t p01 = p0 * p1;
+   // P modulo 2^64:
+   const boost::uint64_t P_wrapped = p01 * p2;
+   for (std::size_t i = 0; i < len; ++i)
+   {
+      boost::uint64_t v0 = r[0][i];
+      boost::uint64_t v1 = (r[1][i] + p1 - v0 % p1) % p1 * p0_inv_p1 % p1;
+      boost::uint64_t t = (v0 + p0 * v1) % p2;
+      boost::uint64_t v2 = (r[2][i] + p2 - t) % p2 * p01_inv_p2 % p2;
+      boost::uint64_t c = v0 + p0 * v1 + p01 * v2; // modulo 2^64
+      // v2 is the leading digit in the mixed radix, so v2 > p2/2 means c > P/2 and the true coefficient is negative:
+      if (2 * v2 > p2)
+         c -= P_wrapped;
+      out[i] = static_cast<T>(c);
+   }
+}
+
+// Coefficient types are split three ways: 0 for inexact types and those numeric_limits knows nothing about, 1 for other exact types,
+// 2 for built-in signed integers.
+template <class T>
+void polynomial_multiply_imp(const T* a, std::size_t na, const T* b, std::size_t nb, T* out, const boost::integral_constant<int, 0>&)
+{
+   schoolbook_multiply(a, na, b, nb, out);
+}
+
+template <class T>
+void polynomial_multiply_imp(const T* a, std::size_t na, const T* b, std::size_t nb, T* out, const boost::integral_constant<int, 1>&)
+{
+   karatsuba_multiply(a, na, b, nb, out);
+}
+
+template <class T>
+void polynomial_multiply_imp(const T* a, std::size_t na, const T* b, std::size_t nb, T* out, const boost::integral_constant<int, 2>&)
+{
+   if (((std::min)(na, nb) >= BOOST_MATH_POLYNOMIAL_NTT_THRESHOLD) && (na + nb - 1 <= (std::size_t(1) << 23)))
+      ntt_multiply(a, na, b, nb, out);
+   else
+      karatsuba_multiply(a, na, b, nb, out);
+}
+
+// out[0, na + nb - 1) = a * b, choosing the method by the lengths and the coefficient type:
+template <class T>
+void polynomial_multiply(const T* a, std::size_t na, const T* b, std::size_t nb, T* out)
+{
+   typedef std::numeric_limits<T> limits;
+   typedef boost::integral_constant<int,
+      !(limits::is_specialized && limits::is_exact) ? 0
+      : (boost::is_integral<T>::value && limits::is_signed && (sizeof(T) <= 8)) ? 2 : 1> tag_type;
+   polynomial_multiply_imp(a, na, b, nb, out, tag_type());
+}
+
+// The product used by fft_multiply and newton_divide: exact types as above, and others by FFT when both operands are long,
+// and by Karatsuba's method otherwise.
+template <class T>
+void fast_polynomial_multiply_imp(const T* a, std::size_t na, const T* b, std::size_t nb, T* out, const boost::true_type&)
+{
+   polynomial_multiply(a, na, b, nb, out);
+}
+
+template <class T>
+void fast_polynomial_multiply_imp(const T* a, std::size_t na, const T* b, std::size_t nb, T* out, const boost::false_type&)
+{
+   if ((std::min)(na, nb) >= BOOST_MATH_POLYNOMIAL_FFT_THRESHOLD)
+      fft_multiply(a, na, b, nb, out);
+   else
+      karatsuba_multiply(a, na, b, nb, out);
+}
+
+template <class T>
+void fast_polynomial_multiply(const T* a, std::size_t na, const T* b, std::size_t nb, T* out)
+{
+   typedef std::numeric_limits<T> limits;
+   fast_polynomial_multiply_imp(a, na, b, nb, out, boost::integral_constant<bool, limits::is_specialized && limits::is_exact>());
+}
+
+}}}} // namespaces
+
+#endif // BOOST_MATH_TOOLS_DETAIL_POLYNOMIAL_MULTIPLICATION_HPP
@@ -24,10 +24,13 @@
 #include <boost/math/policies/error_handling.hpp>
 #include <boost/math/special_functions/binomial.hpp>
 #include <boost/core/enable_if.hpp>
+#include <boost/static_assert.hpp>
 #include <boost/type_traits/is_convertible.hpp>
 #include <boost/math/tools/detail/is_const_iterable.hpp>
+#include <boost/math/tools/detail/polynomial_multiplication.hpp>
 
 #include <vector>
+#include <limits>
 #include <ostream>
 #include <algorithm>
 #ifndef BOOST_NO_CXX11_HDR_INITIALIZER_LIST
@@ -184,6 +187,90 @@ division_impl(polynomial<T> &q, polynomial<T> &u, const polynomial<T>& v, N n, N
 }
 
 
+/**
+ * Power series inverse by Newton's iteration g <- g(2 - fg), doubling the number of correct terms each step.
+ *
+ * @param   f   Series with f[0] invertible.
+ * @param   k   Number of terms wanted.
+ * @return      g with f*g = 1 mod x^k.
+ */
+template <typename T>
+std::vector<T> series_inverse(const std::vector<T>& f, std::size_t k)
+{
+    std::vector<T> g(1, T(1) / f[0]);
+    std::vector<T> e, ge;
+    std::size_t len = 1;
+    while (len < k)
+    {
+        std::size_t next = (std::min)(2 * len, k);
+        std::size_t nf = (std::min)(next, f.size());
+        e.resize(nf + g.size() - 1);
+        fast_polynomial_multiply(f.data(), nf, g.data(), g.size(), e.data());
+        e.resize(next, T(0));
+        for (std::size_t i = 0; i < next; ++i)
+            e[i] = -e[i];
+        e[0] += T(2);
+        ge.resize(g.size() + next - 1);
+        fast_polynomial_multiply(g.data(), g.size(), e.data(), next, ge.data());
+        g.assign(ge.begin(), ge.begin() + next);
+        len = next;
+    }
+    return g;
+}
+
+// Newton division only pays off over a field, and only when both the quotient and the divisor are long.
+// It is used automatically only over exact fields, where the result is the same as by long division:
+#ifndef BOOST_MATH_POLYNOMIAL_NEWTON_DIVISION_THRESHOLD
+#define BOOST_MATH_POLYNOMIAL_NEWTON_DIVISION_THRESHOLD 64
+#endif
+
+template <typename T>
+inline bool use_newton_division(std::size_t quotient_size, std::size_t divisor_size, const boost::true_type&)
+{
+    return (std::min)(quotient_size, divisor_size) >= BOOST_MATH_POLYNOMIAL_NEWTON_DIVISION_THRESHOLD;
+}
+
+template <typename T>
+inline bool use_newton_division(std::size_t, std::size_t, const boost::false_type&)
+{
+    return false;
+}
+
+/**
+ * Division over a field by Newton iteration on the reversed polynomials:
+ * with m = deg u and n = deg v, rev(q) = rev(u) / rev(v) mod x^(m-n+1), and then r = u - qv.
+ * The cost is a small multiple of that of a multiplication, rather than O((m-n)n).
+ *
+ * @param   u   Dividend.
+ * @param   v   Divisor.
+ */
+template <typename T>
+std::pair< polynomial<T>, polynomial<T> >
+newton_division(const polynomial<T>& u, const polynomial<T>& v)
+{
+    std::size_t const m = u.size() - 1, n = v.size() - 1;
+    std::size_t const k = m - n + 1;
+    std::vector<T> rv(v.data().rbegin(), v.data().rend());
+    std::vector<T> ru(u.data().rbegin(), u.data().rbegin() + k);
+    std::vector<T> inv = series_inverse(rv, k);
+    std::vector<T> rq(2 * k - 1);
+    fast_polynomial_multiply(ru.data(), k, inv.data(), k, rq.data());
+    std::vector<T> q(rq.begin(), rq.begin() + k);
+    std::reverse(q.begin(), q.end());
+    std::vector<T> r;
+    if (n > 0)
+    {
+        // Only the n low order terms of qv are needed:
+        std::size_t nq = (std::min)(k, n);
+        std::vector<T> qv(nq + n);
+        fast_polynomial_multiply(q.data(), nq, v.data().data(), n + 1, qv.data());
+        r.assign(u.data().begin(), u.data().begin() + n);
+        for (std::size_t i = 0; i < n; ++i)
+            r[i] -= qv[i];
+    }
+    return std::make_pair(polynomial<T>(std::move(q)), polynomial<T>(std::move(r)));
+}
+
 /**
  * Knuth, The Art of Computer Programming: Volume 2, Third edition, 1998
  * Chapter 4.6.1, Algorithm D and R: Main loop.
@@ -201,6 +288,10 @@ division(polynomial<T> u, const polynomial<T>& v)
 
     typedef typename polynomial<T>::size_type N;
 
+    typedef std::numeric_limits<T> limits;
+    if (use_newton_division<T>(u.size() - v.size() + 1, v.size(), boost::integral_constant<bool, limits::is_specialized && limits::is_exact && !limits::is_integer>()))
+        return newton_division(u, v);
+
     N const m = u.size() - 1, n = v.size() - 1;
     N k = m - n;
     polynomial<T> q;
@@ -278,6 +369,39 @@ quotient_remainder(const polynomial<T>& dividend, const polynomial<T>& divisor)
     return detail::division(dividend, divisor);
 }
 
+/* The product a * b, by FFT when both operands are long.
+ * Much faster than operator* for long floating point polynomials, but the error in each coefficient is
+ * a small multiple of eps*log(n)*max|a_i|*max|b_j|, rather than relative to that coefficient, so small
+ * coefficients of the product may have few correct digits.  Exact types are multiplied as by operator*.
+ */
+template <typename T>
+polynomial<T> fft_multiply(const polynomial<T>& a, const polynomial<T>& b)
+{
+    BOOST_STATIC_ASSERT_MSG(!std::numeric_limits<T>::is_integer, "fft_multiply requires floating point or other field coefficients.");
+    if (!a || !b)
+        return polynomial<T>();
+    std::vector<T> prod(a.size() + b.size() - 1);
+    detail::fast_polynomial_multiply(a.data().data(), a.size(), b.data().data(), b.size(), prod.data());
+    return polynomial<T>(std::move(prod));
+}
+
+/* Calculates a / b and a % b as quotient_remainder does, but by Newton iteration on the reversed polynomials,
+ * with products by fft_multiply, at the cost of a few multiplications rather than O((deg a - deg b) deg b) operations.
+ * For floating point coefficients the errors are bounded relative to the largest coefficients, as for fft_multiply,
+ * rather than relative to each coefficient, so this is only used when asked for.
+ * This function is not defined for division by zero: user beware.
+ */
+template <typename T>
+std::pair< polynomial<T>, polynomial<T> >
+newton_divide(const polynomial<T>& dividend, const polynomial<T>& divisor)
+{
+    BOOST_STATIC_ASSERT_MSG(!std::numeric_limits<T>::is_integer, "newton_divide requires coefficients from a field.");
+    BOOST_ASSERT(divisor);
+    if (dividend.size() < divisor.size())
+        return std::make_pair(polynomial<T>(), dividend);
+    return detail::newton_division(dividend, divisor);
+}
+
 
 template <class T>
 class polynomial
@@ -504,6 +628,18 @@ public:
        return *this;
    }
 
+   // Same coefficient types: Karatsuba, FFT or NTT as appropriate, see detail/polynomial_multiplication.hpp.
+   void multiply(const polynomial<T>& a, const polynomial<T>& b) {
+       if (!a || !b)
+       {
+           this->set_zero();
+           return;
+       }
+       std::vector<T> prod(a.size() + b.size() - 1);
+       detail::polynomial_multiply(a.m_data.data(), a.size(), b.m_data.data(), b.size(), prod.data());
+       m_data.swap(prod);
+   }
+
    template <typename U, typename V>
    void multiply(const polynomial<U>& a, const polynomial<V>& b) {
        if (!a || !b)
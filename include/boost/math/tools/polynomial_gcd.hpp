@@ -180,6 +180,148 @@ gcd(polynomial<T> const &u, polynomial<T> const &v)
    BOOST_STATIC_ASSERT_MSG(sizeof(v) == 0, "GCD on polynomials of bounded integers is disallowed due to the excessive growth in the size of intermediate terms.");
    return subresultant_gcd(u, v);
 }
+
+#ifndef BOOST_MATH_POLYNOMIAL_HALF_GCD_THRESHOLD
+#define BOOST_MATH_POLYNOMIAL_HALF_GCD_THRESHOLD 64
+#endif
+
+namespace detail
+{
+    // 2x2 matrix of polynomials acting on pairs of consecutive remainders.
+    template <class T>
+    struct remainder_matrix
+    {
+        polynomial<T> m00, m01, m10, m11;
+
+        static remainder_matrix identity()
+        {
+            remainder_matrix r;
+            r.m00 = polynomial<T>(T(1));
+            r.m11 = polynomial<T>(T(1));
+            return r;
+        }
+
+        void apply(polynomial<T>& a, polynomial<T>& b) const
+        {
+            polynomial<T> c = m00 * a + m01 * b;
+            b = m10 * a + m11 * b;
+            a.data().swap(c.data());
+        }
+
+        // this <- [[0, 1], [1, -q]] * this
+        void euclid_step(polynomial<T> const &q)
+        {
+            polynomial<T> t10 = m00 - q * m10;
+            polynomial<T> t11 = m01 - q * m11;
+            m00.data().swap(m10.data());
+            m01.data().swap(m11.data());
+            m10.data().swap(t10.data());
+            m11.data().swap(t11.data());
+        }
+    };
+
+    template <class T>
+    remainder_matrix<T> operator*(remainder_matrix<T> const &x, remainder_matrix<T> const &y)
+    {
+        remainder_matrix<T> r;
+        r.m00 = x.m00 * y.m00 + x.m01 * y.m10;
+        r.m01 = x.m00 * y.m01 + x.m01 * y.m11;
+        r.m10 = x.m10 * y.m00 + x.m11 * y.m10;
+        r.m11 = x.m10 * y.m01 + x.m11 * y.m11;
+        return r;
+    }
+
+    // Degree with the zero polynomial at -1:
+    template <class T>
+    inline long signed_degree(polynomial<T> const &p)
+    {
+        return static_cast<long>(p.size()) - 1;
+    }
+
+    // p div x^k:
+    template <class T>
+    polynomial<T> shift_down(polynomial<T> const &p, std::size_t k)
+    {
+        return p.size() > k ? polynomial<T>(p.data().begin() + k, p.data().end()) : polynomial<T>();
+    }
+
+    /*
+    * Half-GCD over a field: for deg a > deg b, returns the matrix M taking (a, b) to the consecutive pair (c, d)
+    * of their Euclidean remainder sequence with deg c >= m > deg d, where m = ceil(deg a / 2).
+    * The quotients in the first half of the sequence depend only on the leading halves of a and b, which is what
+    * makes the recursion work; see
+    * K. Thull and C. K. Yap, "A unified approach to HGCD algorithms for polynomials and integers", 1990.
+    */
+    template <class T>
+    remainder_matrix<T> half_gcd(polynomial<T> a, polynomial<T> b)
+    {
+        long const m = (signed_degree(a) + 1) / 2;
+        if (signed_degree(b) < m)
+            return remainder_matrix<T>::identity();
+        if (signed_degree(a) < BOOST_MATH_POLYNOMIAL_HALF_GCD_THRESHOLD)
+        {
+            // Short enough for the classical remainder sequence:
+            remainder_matrix<T> r = remainder_matrix<T>::identity();
+            while (signed_degree(b) >= m)
+            {
+                std::pair< polynomial<T>, polynomial<T> > qr = quotient_remainder(a, b);
+                a.data().swap(b.data());
+                b.data().swap(qr.second.data());
+                r.euclid_step(qr.first);
+            }
+            return r;
+        }
+        remainder_matrix<T> r = half_gcd(shift_down(a, m), shift_down(b, m));
+        r.apply(a, b);
+        if (signed_degree(b) < m)
+            return r;
+        std::pair< polynomial<T>, polynomial<T> > qr = quotient_remainder(a, b);
+        r.euclid_step(qr.first);
+        a.data().swap(b.data());
+        b.data().swap(qr.second.data());
+        if (signed_degree(b) < m)
+            return r;
+        std::size_t const k = static_cast<std::size_t>(2 * m - signed_degree(a));
+        return half_gcd(shift_down(a, k), shift_down(b, k)) * r;
+    }
+
+    /*
+    * Euclid's algorithm with the long runs of the remainder sequence skipped by half_gcd.
+    * In exact arithmetic the remainder sequence is the same as the classical one, so the result is identical
+    * to that of Euclid_gcd, just reached in O(M(n) log n) rather than O(n^2) operations.
+    */
+    template <class T>
+    polynomial<T> half_gcd_euclid(polynomial<T> a, polynomial<T> b)
+    {
+        while (b)
+        {
+            if (signed_degree(a) >= BOOST_MATH_POLYNOMIAL_HALF_GCD_THRESHOLD && signed_degree(a) > signed_degree(b) && 2 * signed_degree(b) > signed_degree(a))
+            {
+                half_gcd(a, b).apply(a, b);
+                if (!b)
+                    break;
+            }
+            a %= b;
+            a.data().swap(b.data());
+        }
+        return a;
+    }
+}
+
+/**
+ * @brief GCD for polynomials over exact fields, such as the rationals.
+ *
+ * Long remainder sequences are accelerated by the half-GCD algorithm.
+ *
+ * @tparam  T   An exact non-integral type.
+ */
+template <typename T>
+typename enable_if_c<!std::numeric_limits<T>::is_integer && std::numeric_limits<T>::is_specialized && std::numeric_limits<T>::is_exact, polynomial<T> >::type
+gcd(polynomial<T> const &u, polynomial<T> const &v)
+{
+   return detail::half_gcd_euclid(u, v);
+}
+
 // GCD over polynomials of floats can go via the Euclid algorithm:
 template <typename T>
 typename enable_if_c<!std::numeric_limits<T>::is_integer && (std::numeric_limits<T>::min_exponent != std::numeric_limits<T>::max_exponent) && !std::numeric_limits<T>::is_exact, polynomial<T> >::type
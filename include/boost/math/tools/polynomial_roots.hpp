@@ -0,0 +1,411 @@
+//  (C) Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_TOOLS_POLYNOMIAL_ROOTS_HPP
+#define BOOST_MATH_TOOLS_POLYNOMIAL_ROOTS_HPP
+
+#ifdef _MSC_VER
+#pragma once
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+#include <boost/math/tools/polynomial.hpp>
+#include <boost/math/tools/roots.hpp>
+#include <boost/math/constants/constants.hpp>
+#include <boost/math/policies/policy.hpp>
+#include <boost/type_traits/is_integral.hpp>
+#if !defined(BOOST_NO_CXX17_HDR_EXECUTION) && !defined(BOOST_NO_CXX17_IF_CONSTEXPR)
+#include <execution>
+#include <type_traits>
+#endif
+
+namespace boost { namespace math { namespace tools {
+
+namespace detail {
+
+// The type in which the roots of a polynomial<T> are computed; integer coefficients are promoted to double.
+template <class T, bool = boost::is_integral<T>::value>
+struct polynomial_roots_real
+{
+   typedef T type;
+};
+
+template <class T>
+struct polynomial_roots_real<T, true>
+{
+   typedef double type;
+};
+
+//
+// All the roots of a polynomial by the Aberth-Ehrlich method, following
+// D. A. Bini, "Numerical computation of polynomial zeros by means of Aberth's method",
+// Numerical Algorithms 13 (1996) 179-200.
+// The coefficients a_0, ..., a_n have a_0 != 0 and a_n != 0.
+//
+template<class Real>
+class aberth_ehrlich
+{
+public:
+    typedef std::complex<Real> complex_type;
+
+    explicit aberth_ehrlich(std::vector<Real> const & a) : m_a(a), m_n(a.size() - 1), m_bound(a.size())
+    {
+        using std::abs;
+        // Weights of Bini's running error bound for Horner's rule: |p(z)| below eps*sum (4k+1)|a_k||z|^k is noise.
+        for (std::size_t k = 0; k <= m_n; ++k)
+        {
+            m_bound[k] = abs(m_a[k])*static_cast<Real>(4*k + 1);
+        }
+    }
+
+    // Starting points on circles whose radii come from the upper convex hull of (k, log|a_k|):
+    std::vector<complex_type> initial_guesses() const
+    {
+        using std::log;
+        using std::abs;
+        using std::exp;
+        using std::cos;
+        using std::sin;
+        using boost::math::constants::two_pi;
+        std::vector<Real> logs(m_n + 1);
+        std::vector<std::size_t> hull;
+        for (std::size_t k = 0; k <= m_n; ++k)
+        {
+            if (m_a[k] == 0)
+            {
+                continue;
+            }
+            logs[k] = log(abs(m_a[k]));
+            // Pop the last point while it lies on or below the chord to k:
+            while (hull.size() >= 2)
+            {
+                std::size_t i = hull[hull.size() - 2];
+                std::size_t j = hull.back();
+                if ((logs[j] - logs[i])*static_cast<Real>(k - i) <= (logs[k] - logs[i])*static_cast<Real>(j - i))
+                {
+                    hull.pop_back();
+                }
+                else
+                {
+                    break;
+                }
+            }
+            hull.push_back(k);
+        }
+
+        std::vector<complex_type> z;
+        z.reserve(m_n);
+        const Real sigma = Real(7)/Real(10);
+        for (std::size_t s = 0; s + 1 < hull.size(); ++s)
+        {
+            std::size_t m = hull[s + 1] - hull[s];
+            Real u = exp((logs[hull[s]] - logs[hull[s + 1]])/static_cast<Real>(m));
+            for (std::size_t j = 0; j < m; ++j)
+            {
+                Real theta = two_pi<Real>()*(static_cast<Real>(j)/static_cast<Real>(m) + static_cast<Real>(s)/static_cast<Real>(m_n)) + sigma;
+                z.emplace_back(u*cos(theta), u*sin(theta));
+            }
+        }
+        return z;
+    }
+
+    // The Newton correction p(z)/p'(z), and whether |p(z)| is at the level of its rounding error.
+    // Outside the unit disk the reversed polynomial is evaluated at 1/z, so that nothing overflows.
+    std::pair<complex_type, bool> newton_correction(complex_type const & z) const
+    {
+        using std::abs;
+        const Real eps = std::numeric_limits<Real>::epsilon();
+        Real r = abs(z);
+        if (r <= 1)
+        {
+            complex_type p = m_a[m_n];
+            complex_type dp(0);
+            Real s = m_bound[m_n];
+            for (std::size_t k = m_n; k-- > 0;)
+            {
+                dp = dp*z + p;
+                p = p*z + m_a[k];
+                s = s*r + m_bound[k];
+            }
+            bool converged = abs(p) <= eps*s;
+            if (dp == complex_type(0))
+            {
+                return std::make_pair(p, converged);
+            }
+            return std::make_pair(p/dp, converged);
+        }
+        complex_type w = Real(1)/z;
+        Real rw = 1/r;
+        complex_type q = m_a[0];
+        complex_type dq(0);
+        Real s = m_bound[0];
+        for (std::size_t k = 1; k <= m_n; ++k)
+        {
+            dq = dq*w + q;
+            q = q*w + m_a[k];
+            s = s*rw + m_bound[k];
+        }
+        bool converged = abs(q) <= eps*s;
+        // p(z) = z^n q(1/z), so p'(z)/p(z) = (n - w q'(w)/q(w))/z:
+        complex_type denom = static_cast<Real>(m_n)*q - w*dq;
+        if (denom == complex_type(0))
+        {
+            return std::make_pair(z, converged);
+        }
+        return std::make_pair(z*q/denom, converged);
+    }
+
+    // One simultaneous (Jacobi) Aberth step for root j; reads only the old approximations.
+    complex_type step(std::vector<complex_type> const & z, std::size_t j, bool & converged) const
+    {
+        auto nc = newton_correction(z[j]);
+        converged = nc.second;
+        if (converged)
+        {
+            return z[j];
+        }
+        complex_type sum(0);
+        for (std::size_t k = 0; k < z.size(); ++k)
+        {
+            if (k != j)
+            {
+                sum += Real(1)/(z[j] - z[k]);
+            }
+        }
+        complex_type w = nc.first/(Real(1) - nc.first*sum);
+        return z[j] - w;
+    }
+
+    // Refine root j with Newton's method: a bracketed real iteration for roots which are real, complex Newton otherwise.
+    complex_type polish(complex_type z) const
+    {
+        using std::abs;
+        auto nc = newton_correction(z);
+        Real radius = static_cast<Real>(m_n)*abs(nc.first);
+        if (abs(z.imag()) <= radius)
+        {
+            Real lo = z.real() - radius;
+            Real hi = z.real() + radius;
+            if (lo < hi && real_value(lo)*real_value(hi) < 0)
+            {
+                auto f = [this](Real x) { return real_value_and_derivative(x); };
+                int digits = policies::digits<Real, policies::policy<> >();
+                boost::uintmax_t max_iter = digits;
+                Real x = newton_raphson_iterate(f, z.real(), lo, hi, digits, max_iter);
+                return complex_type(x, 0);
+            }
+        }
+        if (z.imag() == 0)
+        {
+            return z;
+        }
+        auto g = [this](complex_type const & x)
+        {
+            complex_type p = m_a[m_n];
+            complex_type dp(0);
+            for (std::size_t k = m_n; k-- > 0;)
+            {
+                dp = dp*x + p;
+                p = p*x + m_a[k];
+            }
+            return std::make_pair(p, dp);
+        };
+        complex_type polished = complex_newton(g, z, 8);
+        if (polished == polished && abs(g(polished).first) <= abs(g(z).first))
+        {
+            return polished;
+        }
+        return z;
+    }
+
+    std::size_t degree() const
+    {
+        return m_n;
+    }
+
+private:
+    Real real_value(Real x) const
+    {
+        return boost::math::tools::evaluate_polynomial(m_a.data(), x, m_a.size());
+    }
+
+    std::pair<Real, Real> real_value_and_derivative(Real x) const
+    {
+        Real p = m_a[m_n];
+        Real dp = 0;
+        for (std::size_t k = m_n; k-- > 0;)
+        {
+            dp = dp*x + p;
+            p = p*x + m_a[k];
+        }
+        return std::make_pair(p, dp);
+    }
+
+    std::vector<Real> m_a;
+    std::size_t m_n;
+    std::vector<Real> m_bound;
+};
+
+// Strips the roots at the origin and the trivial degrees; returns true if the caller need not iterate.
+template<class Real, class T>
+bool polynomial_roots_setup(polynomial<T> const & p, std::vector<Real> & a, std::vector<std::complex<Real>> & roots)
+{
+    if (p.size() == 0)
+    {
+        throw std::domain_error("The zero polynomial has no well-defined roots.");
+    }
+    std::size_t zeros = 0;
+    while (p[zeros] == T(0))
+    {
+        ++zeros;
+    }
+    roots.assign(zeros, std::complex<Real>(0, 0));
+    a.resize(p.size() - zeros);
+    for (std::size_t k = 0; k < a.size(); ++k)
+    {
+        a[k] = static_cast<Real>(p[k + zeros]);
+    }
+    if (a.size() == 1)
+    {
+        return true;
+    }
+    if (a.size() == 2)
+    {
+        roots.emplace_back(-a[0]/a[1], Real(0));
+        return true;
+    }
+    return false;
+}
+
+template<class Real>
+void sort_polynomial_roots(std::vector<std::complex<Real>> & roots)
+{
+    std::sort(roots.begin(), roots.end(), [](std::complex<Real> const & x, std::complex<Real> const & y)
+    {
+        return x.real() < y.real() || (x.real() == y.real() && x.imag() < y.imag());
+    });
+}
+
+template<class Real>
+std::size_t polynomial_roots_max_iterations(std::size_t n)
+{
+    return 100 + n + static_cast<std::size_t>(policies::digits<Real, policies::policy<> >());
+}
+
+} // namespace detail
+
+//
+// All roots of p, repeated according to multiplicity and sorted by real part, then imaginary part.
+// Integer coefficients are promoted to double.
+//
+template<class T>
+std::vector<std::complex<typename detail::polynomial_roots_real<T>::type>> polynomial_roots(polynomial<T> const & p)
+{
+    typedef typename detail::polynomial_roots_real<T>::type Real;
+    std::vector<Real> a;
+    std::vector<std::complex<Real>> roots;
+    if (detail::polynomial_roots_setup(p, a, roots))
+    {
+        detail::sort_polynomial_roots(roots);
+        return roots;
+    }
+    detail::aberth_ehrlich<Real> solver(a);
+    std::vector<std::complex<Real>> z = solver.initial_guesses();
+    std::vector<std::complex<Real>> next(z.size());
+    std::vector<unsigned char> done(z.size(), 0);
+    std::size_t max_iterations = detail::polynomial_roots_max_iterations<Real>(z.size());
+    for (std::size_t it = 0; it < max_iterations; ++it)
+    {
+        bool all_done = true;
+        for (std::size_t j = 0; j < z.size(); ++j)
+        {
+            if (done[j])
+            {
+                next[j] = z[j];
+                continue;
+            }
+            bool converged;
+            next[j] = solver.step(z, j, converged);
+            done[j] = converged;
+            all_done = all_done && converged;
+        }
+        z.swap(next);
+        if (all_done)
+        {
+            break;
+        }
+    }
+    for (auto & r : z)
+    {
+        roots.push_back(solver.polish(r));
+    }
+    detail::sort_polynomial_roots(roots);
+    return roots;
+}
+
+#if !defined(BOOST_NO_CXX17_HDR_EXECUTION) && !defined(BOOST_NO_CXX17_IF_CONSTEXPR)
+//
+// As above, with the simultaneous iteration and the polishing of each root spread over the execution policy.
+// Since every step reads only the previous approximations, the result is identical to the sequential one.
+//
+template<class ExecutionPolicy, class T, class = typename std::enable_if<std::is_execution_policy<typename std::decay<ExecutionPolicy>::type>::value>::type>
+std::vector<std::complex<typename detail::polynomial_roots_real<T>::type>> polynomial_roots(ExecutionPolicy&& exec, polynomial<T> const & p)
+{
+    typedef typename detail::polynomial_roots_real<T>::type Real;
+    std::vector<Real> a;
+    std::vector<std::complex<Real>> roots;
+    if (detail::polynomial_roots_setup(p, a, roots))
+    {
+        detail::sort_polynomial_roots(roots);
+        return roots;
+    }
+    detail::aberth_ehrlich<Real> solver(a);
+    std::vector<std::complex<Real>> z = solver.initial_guesses();
+    std::vector<std::complex<Real>> next(z.size());
+    std::vector<unsigned char> done(z.size(), 0);
+    std::vector<std::size_t> indices(z.size());
+    for (std::size_t j = 0; j < indices.size(); ++j)
+    {
+        indices[j] = j;
+    }
+    std::size_t max_iterations = detail::polynomial_roots_max_iterations<Real>(z.size());
+    for (std::size_t it = 0; it < max_iterations; ++it)
+    {
+        std::for_each(exec, indices.begin(), indices.end(), [&](std::size_t j)
+        {
+            if (done[j])
+            {
+                next[j] = z[j];
+                return;
+            }
+            bool converged;
+            next[j] = solver.step(z, j, converged);
+            done[j] = converged;
+        });
+        z.swap(next);
+        if (std::all_of(done.begin(), done.end(), [](unsigned char d) { return d != 0; }))
+        {
+            break;
+        }
+    }
+    std::for_each(exec, indices.begin(), indices.end(), [&](std::size_t j)
+    {
+        next[j] = solver.polish(z[j]);
+    });
+    roots.insert(roots.end(), next.begin(), next.end());
+    detail::sort_polynomial_roots(roots);
+    return roots;
+}
+#endif
+
+}}} // namespaces
+#endif
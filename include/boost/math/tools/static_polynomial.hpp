@@ -0,0 +1,560 @@
+//  (C) Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#ifndef BOOST_MATH_TOOLS_STATIC_POLYNOMIAL_HPP
+#define BOOST_MATH_TOOLS_STATIC_POLYNOMIAL_HPP
+
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <ostream>
+#include <boost/math/tools/config.hpp>
+
+#ifdef BOOST_NO_CXX14_CONSTEXPR
+#error "This header requires C++14 support"
+#endif
+
+//
+// The evaluation scheme used by static_polynomial and static_rational:
+// 1 is Horner's rule, 2 is second order Horner's rule, and 3 is Estrin's scheme.
+// The default follows the tuning of the run time evaluate_polynomial.
+//
+#ifndef BOOST_MATH_STATIC_POLY_METHOD
+#  if BOOST_MATH_POLY_METHOD < 1
+#    define BOOST_MATH_STATIC_POLY_METHOD 1
+#  else
+#    define BOOST_MATH_STATIC_POLY_METHOD BOOST_MATH_POLY_METHOD
+#  endif
+#endif
+
+namespace boost { namespace math { namespace tools {
+
+namespace detail {
+
+//
+// All the schemes below evaluate the K coefficients a[0], a[S], a[2S], ... a[(K-1)S],
+// so that S = -1 evaluates the reversed polynomial in place.
+// Every recursion is on the compile time size, so the evaluation is fully unrolled.
+// No pointer is ever formed beyond the coefficients, as that is not allowed in a constant expression.
+//
+template<std::size_t K, std::ptrdiff_t S>
+struct static_horner
+{
+    template<class T, class V>
+    static constexpr V evaluate(const T* a, const V& x)
+    {
+        return static_cast<V>(a[0] + x * static_horner<K - 1, S>::evaluate(a + S, x));
+    }
+};
+
+template<std::ptrdiff_t S>
+struct static_horner<1, S>
+{
+    template<class T, class V>
+    static constexpr V evaluate(const T* a, const V&)
+    {
+        return static_cast<V>(a[0]);
+    }
+};
+
+template<std::ptrdiff_t S>
+struct static_horner<0, S>
+{
+    template<class T, class V>
+    static constexpr V evaluate(const T*, const V&)
+    {
+        return static_cast<V>(0);
+    }
+};
+
+//
+// Second order Horner: the even and odd coefficients are two independent chains in x^2,
+// which halves the length of the dependency chain.
+//
+template<std::size_t K, std::ptrdiff_t S>
+struct static_second_order_horner
+{
+    template<class T, class V>
+    static constexpr V evaluate(const T* a, const V& x)
+    {
+        V x2 = x * x;
+        V even = static_horner<(K + 1) / 2, 2 * S>::evaluate(a, x2);
+        V odd = static_horner<K / 2, 2 * S>::evaluate(a + S, x2);
+        return static_cast<V>(even + x * odd);
+    }
+};
+
+template<std::ptrdiff_t S>
+struct static_second_order_horner<1, S>
+{
+    template<class T, class V>
+    static constexpr V evaluate(const T* a, const V&)
+    {
+        return static_cast<V>(a[0]);
+    }
+};
+
+// The largest power of two strictly less than K:
+template<std::size_t K, std::size_t M = 1, bool done = (2 * M >= K)>
+struct estrin_split
+{
+    static constexpr std::size_t value = estrin_split<K, 2 * M>::value;
+};
+
+template<std::size_t K, std::size_t M>
+struct estrin_split<K, M, true>
+{
+    static constexpr std::size_t value = M;
+};
+
+// x^M for M a power of two, by repeated squaring:
+template<std::size_t M>
+struct static_square_power
+{
+    template<class V>
+    static constexpr V evaluate(const V& x)
+    {
+        V y = static_square_power<M / 2>::evaluate(x);
+        return static_cast<V>(y * y);
+    }
+};
+
+template<>
+struct static_square_power<1>
+{
+    template<class V>
+    static constexpr V evaluate(const V& x)
+    {
+        return x;
+    }
+};
+
+//
+// Estrin's scheme: p = lo + x^M hi, with M the largest power of two below K.
+// The depth of the dependency chain is logarithmic in K, at the cost of a few more multiplications
+// than Horner's rule and the recomputation (or common subexpression elimination) of the powers x^(2^j).
+//
+template<std::size_t K, std::ptrdiff_t S, bool small = (K <= 2)>
+struct static_estrin
+{
+    template<class T, class V>
+    static constexpr V evaluate(const T* a, const V& x)
+    {
+        constexpr std::size_t M = estrin_split<K>::value;
+        V lo = static_estrin<M, S>::evaluate(a, x);
+        V hi = static_estrin<K - M, S>::evaluate(a + static_cast<std::ptrdiff_t>(M) * S, x);
+        return static_cast<V>(lo + static_square_power<M>::evaluate(x) * hi);
+    }
+};
+
+template<std::size_t K, std::ptrdiff_t S>
+struct static_estrin<K, S, true> : public static_horner<K, S> {};
+
+template<std::size_t K, std::ptrdiff_t S, int method = BOOST_MATH_STATIC_POLY_METHOD>
+struct static_polynomial_evaluator : public static_horner<K, S> {};
+
+template<std::size_t K, std::ptrdiff_t S>
+struct static_polynomial_evaluator<K, S, 2> : public static_second_order_horner<K, S> {};
+
+template<std::size_t K, std::ptrdiff_t S>
+struct static_polynomial_evaluator<K, S, 3> : public static_estrin<K, S> {};
+
+template<class T, class... U>
+struct all_convertible : public std::true_type {};
+
+template<class T, class U, class... V>
+struct all_convertible<T, U, V...> : public std::integral_constant<bool, std::is_convertible<U, T>::value && all_convertible<T, V...>::value> {};
+
+constexpr std::size_t static_max(std::size_t a, std::size_t b)
+{
+    return a < b ? b : a;
+}
+
+} // namespace detail
+
+//
+// A polynomial with N coefficients (degree N - 1, possibly with leading zeros) held in place,
+// so that it may be constructed, manipulated and evaluated in constant expressions.
+// Unlike polynomial<T>, the size is part of the type and is never normalized.
+//
+template<class T, std::size_t N>
+class static_polynomial
+{
+public:
+    static_assert(N > 0, "A static_polynomial must have at least one coefficient.");
+
+    typedef T value_type;
+
+    constexpr static_polynomial() : m_data{} {}
+
+    template<class... U, typename std::enable_if<(sizeof...(U) > 0) && (sizeof...(U) <= N) && detail::all_convertible<T, U...>::value, int>::type = 0>
+    constexpr static_polynomial(U... coefficients) : m_data{static_cast<T>(coefficients)...} {}
+
+    constexpr static_polynomial(const T (&coefficients)[N]) : m_data{}
+    {
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            m_data[i] = coefficients[i];
+        }
+    }
+
+    static constexpr std::size_t size()
+    {
+        return N;
+    }
+
+    static constexpr std::size_t degree()
+    {
+        return N - 1;
+    }
+
+    constexpr const T& operator[](std::size_t i) const
+    {
+        return m_data[i];
+    }
+
+    constexpr T& operator[](std::size_t i)
+    {
+        return m_data[i];
+    }
+
+    constexpr const T* data() const
+    {
+        return m_data;
+    }
+
+    constexpr const T* begin() const
+    {
+        return m_data;
+    }
+
+    constexpr const T* end() const
+    {
+        return m_data + N;
+    }
+
+    template<class V>
+    constexpr V evaluate(const V& x) const
+    {
+        return detail::static_polynomial_evaluator<N, 1>::evaluate(m_data, x);
+    }
+
+    template<class V>
+    constexpr V operator()(const V& x) const
+    {
+        return evaluate(x);
+    }
+
+    // The polynomial with the coefficients in reverse order, x^(N-1) p(1/x):
+    template<class V>
+    constexpr V evaluate_reversed(const V& x) const
+    {
+        return detail::static_polynomial_evaluator<N, -1>::evaluate(m_data + (N - 1), x);
+    }
+
+    constexpr static_polynomial<T, (N > 1 ? N - 1 : 1)> derivative() const
+    {
+        static_polynomial<T, (N > 1 ? N - 1 : 1)> d;
+        for (std::size_t i = 1; i < N; ++i)
+        {
+            d[i - 1] = static_cast<T>(i) * m_data[i];
+        }
+        return d;
+    }
+
+    // The antiderivative which vanishes at zero:
+    constexpr static_polynomial<T, N + 1> integral() const
+    {
+        static_polynomial<T, N + 1> p;
+        for (std::size_t i = 0; i < N; ++i)
+        {
+            p[i + 1] = m_data[i] / static_cast<T>(i + 1);
+        }
+        return p;
+    }
+
+    constexpr static_polynomial& operator*=(const T& value)
+    {
+        for (auto & c : m_data)
+        {
+            c *= value;
+        }
+        return *this;
+    }
+
+    constexpr static_polynomial& operator/=(const T& value)
+    {
+        for (auto & c : m_data)
+        {
+            c /= value;
+        }
+        return *this;
+    }
+
+    template<std::size_t M>
+    constexpr static_polynomial& operator+=(const static_polynomial<T, M>& other)
+    {
+        static_assert(M <= N, "The sum of static polynomials does not fit on the left hand side.");
+        for (std::size_t i = 0; i < M; ++i)
+        {
+            m_data[i] += other[i];
+        }
+        return *this;
+    }
+
+    template<std::size_t M>
+    constexpr static_polynomial& operator-=(const static_polynomial<T, M>& other)
+    {
+        static_assert(M <= N, "The difference of static polynomials does not fit on the left hand side.");
+        for (std::size_t i = 0; i < M; ++i)
+        {
+            m_data[i] -= other[i];
+        }
+        return *this;
+    }
+
+private:
+    T m_data[N];
+};
+
+#ifdef __cpp_deduction_guides
+template<class T, class... U>
+static_polynomial(T, U...) -> static_polynomial<T, 1 + sizeof...(U)>;
+
+template<class T, std::size_t N>
+static_polynomial(const T (&)[N]) -> static_polynomial<T, N>;
+#endif
+
+template<class T, class... U>
+constexpr static_polynomial<T, 1 + sizeof...(U)> make_static_polynomial(const T& a0, const U&... a)
+{
+    return static_polynomial<T, 1 + sizeof...(U)>(a0, static_cast<T>(a)...);
+}
+
+template<class T, std::size_t N>
+constexpr static_polynomial<T, N> operator-(const static_polynomial<T, N>& p)
+{
+    static_polynomial<T, N> r;
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        r[i] = -p[i];
+    }
+    return r;
+}
+
+template<class T, std::size_t N, std::size_t M>
+constexpr static_polynomial<T, detail::static_max(N, M)> operator+(const static_polynomial<T, N>& p, const static_polynomial<T, M>& q)
+{
+    static_polynomial<T, detail::static_max(N, M)> r;
+    r += p;
+    r += q;
+    return r;
+}
+
+template<class T, std::size_t N, std::size_t M>
+constexpr static_polynomial<T, detail::static_max(N, M)> operator-(const static_polynomial<T, N>& p, const static_polynomial<T, M>& q)
+{
+    static_polynomial<T, detail::static_max(N, M)> r;
+    r += p;
+    r -= q;
+    return r;
+}
+
+template<class T, std::size_t N, std::size_t M>
+constexpr static_polynomial<T, N + M - 1> operator*(const static_polynomial<T, N>& p, const static_polynomial<T, M>& q)
+{
+    static_polynomial<T, N + M - 1> r;
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        for (std::size_t j = 0; j < M; ++j)
+        {
+            r[i + j] += p[i] * q[j];
+        }
+    }
+    return r;
+}
+
+template<class T, std::size_t N>
+constexpr static_polynomial<T, N> operator*(static_polynomial<T, N> p, const T& value)
+{
+    return p *= value;
+}
+
+template<class T, std::size_t N>
+constexpr static_polynomial<T, N> operator*(const T& value, static_polynomial<T, N> p)
+{
+    return p *= value;
+}
+
+template<class T, std::size_t N>
+constexpr static_polynomial<T, N> operator/(static_polynomial<T, N> p, const T& value)
+{
+    return p /= value;
+}
+
+template<class T, std::size_t N>
+constexpr bool operator==(const static_polynomial<T, N>& p, const static_polynomial<T, N>& q)
+{
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        if (p[i] != q[i])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+template<class T, std::size_t N>
+constexpr bool operator!=(const static_polynomial<T, N>& p, const static_polynomial<T, N>& q)
+{
+    return !(p == q);
+}
+
+template <class charT, class traits, class T, std::size_t N>
+std::basic_ostream<charT, traits>& operator<<(std::basic_ostream<charT, traits>& os, const static_polynomial<T, N>& p)
+{
+    os << "{ ";
+    for (std::size_t i = 0; i < N; ++i)
+    {
+        if (i)
+        {
+            os << ", ";
+        }
+        os << p[i];
+    }
+    os << " }";
+    return os;
+}
+
+//
+// The rational function P(x)/Q(x) with N numerator and M denominator coefficients.
+// When N == M and the argument is real, evaluation follows evaluate_rational:
+// for x > 1 both polynomials are evaluated reversed in 1/x, which avoids spurious overflow.
+//
+template<class T, std::size_t N, std::size_t M = N>
+class static_rational
+{
+public:
+    typedef T value_type;
+
+    constexpr static_rational() : m_p{}, m_q(T(1)) {}
+
+    constexpr static_rational(const static_polynomial<T, N>& p, const static_polynomial<T, M>& q) : m_p(p), m_q(q) {}
+
+    constexpr const static_polynomial<T, N>& numerator() const
+    {
+        return m_p;
+    }
+
+    constexpr const static_polynomial<T, M>& denominator() const
+    {
+        return m_q;
+    }
+
+    template<class V>
+    constexpr V evaluate(const V& x) const
+    {
+        return evaluate_imp(x, std::integral_constant<bool, (N == M) && std::numeric_limits<V>::is_specialized>());
+    }
+
+    template<class V>
+    constexpr V operator()(const V& x) const
+    {
+        return evaluate(x);
+    }
+
+    // (p'q - pq')/q^2:
+    constexpr auto derivative() const
+    {
+        auto p = m_p.derivative() * m_q - m_p * m_q.derivative();
+        auto q = m_q * m_q;
+        return static_rational<T, decltype(p)::size(), decltype(q)::size()>(p, q);
+    }
+
+private:
+    template<class V>
+    constexpr V evaluate_imp(const V& x, std::false_type const &) const
+    {
+        return static_cast<V>(m_p.evaluate(x) / m_q.evaluate(x));
+    }
+
+    template<class V>
+    constexpr V evaluate_imp(const V& x, std::true_type const &) const
+    {
+        if (x <= 1)
+        {
+            return static_cast<V>(m_p.evaluate(x) / m_q.evaluate(x));
+        }
+        V z = 1 / x;
+        return static_cast<V>(m_p.evaluate_reversed(z) / m_q.evaluate_reversed(z));
+    }
+
+    static_polynomial<T, N> m_p;
+    static_polynomial<T, M> m_q;
+};
+
+#ifdef __cpp_deduction_guides
+template<class T, std::size_t N, std::size_t M>
+static_rational(const static_polynomial<T, N>&, const static_polynomial<T, M>&) -> static_rational<T, N, M>;
+#endif
+
+template<class T, std::size_t N, std::size_t M>
+constexpr static_rational<T, N, M> make_static_rational(const static_polynomial<T, N>& p, const static_polynomial<T, M>& q)
+{
+    return static_rational<T, N, M>(p, q);
+}
+
+template<class T, std::size_t N, std::size_t M>
+constexpr static_rational<T, N, M> operator-(const static_rational<T, N, M>& r)
+{
+    return static_rational<T, N, M>(-r.numerator(), r.denominator());
+}
+
+template<class T, std::size_t N1, std::size_t M1, std::size_t N2, std::size_t M2>
+constexpr auto operator+(const static_rational<T, N1, M1>& r, const static_rational<T, N2, M2>& s)
+{
+    return make_static_rational(r.numerator() * s.denominator() + s.numerator() * r.denominator(), r.denominator() * s.denominator());
+}
+
+template<class T, std::size_t N1, std::size_t M1, std::size_t N2, std::size_t M2>
+constexpr auto operator-(const static_rational<T, N1, M1>& r, const static_rational<T, N2, M2>& s)
+{
+    return make_static_rational(r.numerator() * s.denominator() - s.numerator() * r.denominator(), r.denominator() * s.denominator());
+}
+
+template<class T, std::size_t N1, std::size_t M1, std::size_t N2, std::size_t M2>
+constexpr auto operator*(const static_rational<T, N1, M1>& r, const static_rational<T, N2, M2>& s)
+{
+    return make_static_rational(r.numerator() * s.numerator(), r.denominator() * s.denominator());
+}
+
+template<class T, std::size_t N1, std::size_t M1, std::size_t N2, std::size_t M2>
+constexpr auto operator/(const static_rational<T, N1, M1>& r, const static_rational<T, N2, M2>& s)
+{
+    return make_static_rational(r.numerator() * s.denominator(), r.denominator() * s.numerator());
+}
+
+template<class T, std::size_t N, std::size_t M>
+constexpr static_rational<T, N, M> operator*(const static_rational<T, N, M>& r, const T& value)
+{
+    return static_rational<T, N, M>(r.numerator() * value, r.denominator());
+}
+
+template<class T, std::size_t N, std::size_t M>
+constexpr static_rational<T, N, M> operator*(const T& value, const static_rational<T, N, M>& r)
+{
+    return static_rational<T, N, M>(value * r.numerator(), r.denominator());
+}
+
+template<class T, std::size_t N, std::size_t M>
+constexpr static_rational<T, N, M> operator/(const static_rational<T, N, M>& r, const T& value)
+{
+    return static_rational<T, N, M>(r.numerator(), r.denominator() * value);
+}
+
+}}} // namespaces
+
+#endif
@@ -74,4 +74,31 @@ BENCHMARK_TEMPLATE(JacobiTheta1Tau, number<mpfr_float_backend<1000>>);
 BENCHMARK_TEMPLATE(JacobiTheta1Tau, cpp_bin_float_50);
 BENCHMARK_TEMPLATE(JacobiTheta1Tau, cpp_bin_float_100);
 
+template<class Real>
+void JacobiThetaEvaluator(benchmark::State& state)
+{
+    std::random_device rd;
+    std::mt19937_64 mt(rd());
+    std::uniform_real_distribution<long double> unif(0,0.01);
+
+    Real x = static_cast<Real>(unif(mt));
+    boost::math::jacobi_theta_evaluator<Real> theta(Real(2.5));
+    Real theta1, theta2, theta3, theta4;
+    for (auto _ : state)
+    {
+        theta(x, &theta1, &theta2, &theta3, &theta4);
+        benchmark::DoNotOptimize(theta1);
+        benchmark::DoNotOptimize(theta2);
+        benchmark::DoNotOptimize(theta3);
+        benchmark::DoNotOptimize(theta4);
+        x += std::numeric_limits<Real>::epsilon();
+    }
+}
+
+BENCHMARK_TEMPLATE(JacobiThetaEvaluator, float);
+BENCHMARK_TEMPLATE(JacobiThetaEvaluator, double);
+BENCHMARK_TEMPLATE(JacobiThetaEvaluator, long double);
+BENCHMARK_TEMPLATE(JacobiThetaEvaluator, float128);
+BENCHMARK_TEMPLATE(JacobiThetaEvaluator, cpp_bin_float_50);
+
 BENCHMARK_MAIN();
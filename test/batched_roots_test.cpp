@@ -0,0 +1,328 @@
+/*
+ * Copyright agent, 2026
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "math_unit_test.hpp"
+#include <cmath>
+#include <vector>
+#include <utility>
+#include <tuple>
+#include <boost/math/tools/batched_roots.hpp>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+#if !defined(BOOST_NO_CXX17_HDR_EXECUTION) && !defined(BOOST_NO_CXX17_IF_CONSTEXPR)
+#include <execution>
+#endif
+
+using boost::math::tools::batched_newton_raphson_iterate;
+using boost::math::tools::batched_halley_iterate;
+using boost::math::tools::batched_schroder_iterate;
+using boost::math::tools::batched_toms748_solve;
+using boost::math::tools::eps_tolerance;
+using boost::multiprecision::cpp_bin_float_50;
+
+// Cube roots of a[i], each problem with its own parameter:
+template<class Real>
+void test_cbrt_newton()
+{
+    std::size_t n = 1000;
+    std::vector<Real> a(n), guess(n), lo(n), hi(n), root(n);
+    std::vector<boost::uintmax_t> iterations(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        a[i] = Real(i + 1)/7;
+        guess[i] = 1;
+        lo[i] = 0;
+        hi[i] = a[i] + 1;
+    }
+    auto f = [&a](std::size_t i, Real x) { return std::make_pair(x*x*x - a[i], 3*x*x); };
+    batched_newton_raphson_iterate(f, guess.data(), lo.data(), hi.data(), root.data(), n, std::numeric_limits<Real>::digits, 100, iterations.data());
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        using std::cbrt;
+        CHECK_ULP_CLOSE(cbrt(a[i]), root[i], 4);
+        CHECK_LE(iterations[i], boost::uintmax_t(100));
+        // Must agree with the scalar solver, which uses the same safeguards:
+        boost::uintmax_t it = 100;
+        Real expected = boost::math::tools::newton_raphson_iterate([&](Real x) { return f(i, x); }, guess[i], lo[i], hi[i], std::numeric_limits<Real>::digits, it);
+        CHECK_ULP_CLOSE(expected, root[i], 2);
+    }
+}
+
+template<class Real>
+void test_cbrt_second_order()
+{
+    std::size_t n = 333;
+    std::vector<Real> a(n), guess(n), lo(n), hi(n), halley(n), schroder(n);
+    std::vector<boost::uintmax_t> halley_iterations(n), schroder_iterations(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        a[i] = Real(3*i + 2)/5;
+        guess[i] = a[i]/2 + 1;
+        lo[i] = 0;
+        hi[i] = a[i] + 1;
+    }
+    auto f = [&a](std::size_t i, Real x) { return std::make_tuple(x*x*x - a[i], 3*x*x, 6*x); };
+    int digits = std::numeric_limits<Real>::digits;
+    batched_halley_iterate(f, guess.data(), lo.data(), hi.data(), halley.data(), n, digits, 100, halley_iterations.data());
+    batched_schroder_iterate(f, guess.data(), lo.data(), hi.data(), schroder.data(), n, digits, 100, schroder_iterations.data());
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        using std::cbrt;
+        Real expected = cbrt(a[i]);
+        CHECK_ULP_CLOSE(expected, halley[i], 4);
+        CHECK_ULP_CLOSE(expected, schroder[i], 4);
+        CHECK_LE(halley_iterations[i], boost::uintmax_t(100));
+        CHECK_LE(schroder_iterations[i], boost::uintmax_t(100));
+        // Identical to the scalar solvers, which take the same steps:
+        auto g = [&](Real x) { return f(i, x); };
+        boost::uintmax_t it = 100;
+        CHECK_EQUAL(boost::math::tools::halley_iterate(g, guess[i], lo[i], hi[i], digits, it), halley[i]);
+        CHECK_EQUAL(it, halley_iterations[i]);
+        it = 100;
+        CHECK_EQUAL(boost::math::tools::schroder_iterate(g, guess[i], lo[i], hi[i], digits, it), schroder[i]);
+        CHECK_EQUAL(it, schroder_iterations[i]);
+    }
+}
+
+// Zero derivatives, steps out of the bracket and a fallback to Newton steps must be handled as the scalar solvers do:
+template<class Real>
+void test_second_order_safeguards()
+{
+    std::size_t n = 150;
+    std::vector<Real> guess(n), lo(n), hi(n), halley(n), schroder(n);
+    std::vector<boost::uintmax_t> halley_iterations(n), schroder_iterations(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        lo[i] = -5;
+        hi[i] = 7;
+        guess[i] = (i % 3 == 0) ? Real(0) : Real(i % 13) / 2 - 3;
+    }
+    auto f = [](std::size_t i, Real x)
+    {
+        Real c = Real(i % 7) / 3;
+        switch (i % 3)
+        {
+        case 0:
+            // Zero derivative at the guess x = 0:
+            return std::make_tuple(x*x*x - 3*x*x + 1, 3*x*x - 6*x, 6*x - 6);
+        case 1:
+            return std::make_tuple((x - c)*(x - c)*(x - c) + (x - c) - 1, 3*(x - c)*(x - c) + 1, 6*(x - c));
+        default:
+            // Flat near the root, so the steps overshoot the bracket:
+            return std::make_tuple(std::atan(x - c), 1/(1 + (x - c)*(x - c)), -2*(x - c)/((1 + (x - c)*(x - c))*(1 + (x - c)*(x - c))));
+        }
+    };
+    int digits = std::numeric_limits<Real>::digits - 4;
+    batched_halley_iterate(f, guess.data(), lo.data(), hi.data(), halley.data(), n, digits, 200, halley_iterations.data());
+    batched_schroder_iterate(f, guess.data(), lo.data(), hi.data(), schroder.data(), n, digits, 200, schroder_iterations.data());
+    // Including the rare cases (Schroder on atan in float) where the scalar solver breaks down to a NaN:
+    auto check_same = [](Real expected, Real computed)
+    {
+        using std::isnan;
+        if (isnan(expected))
+        {
+            CHECK_NAN(computed);
+        }
+        else
+        {
+            CHECK_EQUAL(expected, computed);
+        }
+    };
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        auto g = [&](Real x) { return f(i, x); };
+        boost::uintmax_t it = 200;
+        check_same(boost::math::tools::halley_iterate(g, guess[i], lo[i], hi[i], digits, it), halley[i]);
+        CHECK_EQUAL(it, halley_iterations[i]);
+        it = 200;
+        check_same(boost::math::tools::schroder_iterate(g, guess[i], lo[i], hi[i], digits, it), schroder[i]);
+        CHECK_EQUAL(it, schroder_iterations[i]);
+    }
+}
+
+// A stationary point inside the bracket, and steps clamped onto it, must be handled as newton_raphson_iterate does:
+template<class Real>
+void test_newton_safeguards()
+{
+    std::size_t n = 150;
+    std::vector<Real> guess(n), lo(n), hi(n), root(n);
+    std::vector<boost::uintmax_t> iterations(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        lo[i] = -4;
+        hi[i] = 5;
+        guess[i] = (i % 3 == 0) ? Real(i % 2 ? 1 : -1) : Real(i % 13) / 2 - 3;
+    }
+    auto f = [](std::size_t i, Real x)
+    {
+        Real c = Real(i % 7) / 3 - 1;
+        switch (i % 3)
+        {
+        case 0:
+            // Zero derivative at the guesses x = -1 and x = 1:
+            return std::make_pair(x*x*x - 3*x + c, 3*x*x - 3);
+        case 1:
+            // Stationary at x = c, with the root close by:
+            return std::make_pair((x - c)*(x - c)*(x - c)*(x - c)*(x - c) + Real(1)/64, 5*(x - c)*(x - c)*(x - c)*(x - c));
+        default:
+            // Flat near the root, so the steps are clamped to the bracket:
+            return std::make_pair(std::atan(x - c), 1/(1 + (x - c)*(x - c)));
+        }
+    };
+    int digits = std::numeric_limits<Real>::digits - 4;
+    batched_newton_raphson_iterate(f, guess.data(), lo.data(), hi.data(), root.data(), n, digits, 200, iterations.data());
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        boost::uintmax_t it = 200;
+        CHECK_EQUAL(boost::math::tools::newton_raphson_iterate([&](Real x) { return f(i, x); }, guess[i], lo[i], hi[i], digits, it), root[i]);
+        CHECK_EQUAL(it, iterations[i]);
+    }
+}
+
+// Lanes which converge at very different rates must not disturb each other:
+void test_divergent_lanes()
+{
+    using Real = double;
+    std::size_t n = 200;
+    std::vector<Real> guess(n), lo(n), hi(n), root(n);
+    std::vector<boost::uintmax_t> iterations(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        lo[i] = -1;
+        hi[i] = 1000;
+        // Exact root on even lanes, a long way off on odd ones:
+        guess[i] = (i % 2 == 0) ? Real(0) : Real(900);
+    }
+    // f_i(x) = x^(2k+1) for k = i % 4 has its only root at zero.
+    auto f = [](std::size_t i, Real x)
+    {
+        int k = 2*static_cast<int>(i % 4) + 1;
+        return std::make_pair(std::pow(x, k), k*std::pow(x, k - 1));
+    };
+    batched_newton_raphson_iterate(f, guess.data(), lo.data(), hi.data(), root.data(), n, 40, 500, iterations.data());
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        if (i % 2 == 0)
+        {
+            CHECK_EQUAL(root[i], Real(0));
+            CHECK_EQUAL(iterations[i], boost::uintmax_t(1));
+        }
+        else
+        {
+            CHECK_ABSOLUTE_ERROR(Real(0), root[i], 1e-2);
+            CHECK_LE(boost::uintmax_t(2), iterations[i]);
+        }
+    }
+}
+
+void test_toms748()
+{
+    using Real = double;
+    std::size_t n = 100;
+    std::vector<Real> a(n), b(n), c(n);
+    std::vector<std::pair<Real, Real>> bracket(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        c[i] = Real(i + 1)/10;
+        a[i] = -1;
+        b[i] = 11;
+    }
+    auto f = [&c](std::size_t i, Real x) { return std::exp(x) - std::exp(c[i]); };
+    batched_toms748_solve(f, a.data(), b.data(), eps_tolerance<Real>(), bracket.data(), n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        CHECK_ULP_CLOSE(c[i], (bracket[i].first + bracket[i].second)/2, 8);
+    }
+}
+
+#if !defined(BOOST_NO_CXX17_HDR_EXECUTION) && !defined(BOOST_NO_CXX17_IF_CONSTEXPR)
+void test_parallel()
+{
+    using Real = double;
+    std::size_t n = 100000;
+    std::vector<Real> a(n), guess(n), lo(n), hi(n), root(n), serial(n);
+    std::vector<boost::uintmax_t> iterations(n), serial_iterations(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        a[i] = Real(i + 1)/1000;
+        guess[i] = 1;
+        lo[i] = 0;
+        hi[i] = a[i] + 1;
+    }
+    auto f = [&a](std::size_t i, Real x) { return std::make_pair(x*x*x - a[i], 3*x*x); };
+    int digits = std::numeric_limits<Real>::digits;
+    batched_newton_raphson_iterate(std::execution::par, f, guess.data(), lo.data(), hi.data(), root.data(), n, digits, 100, iterations.data());
+    batched_newton_raphson_iterate(f, guess.data(), lo.data(), hi.data(), serial.data(), n, digits, 100, serial_iterations.data());
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        CHECK_EQUAL(serial[i], root[i]);
+        CHECK_EQUAL(serial_iterations[i], iterations[i]);
+    }
+
+    std::vector<Real> la(n), lb(n);
+    std::vector<std::pair<Real, Real>> bracket(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        la[i] = 0;
+        lb[i] = a[i] + 1;
+    }
+    auto g = [&a](std::size_t i, Real x) { return x*x*x - a[i]; };
+    batched_toms748_solve(std::execution::par, g, la.data(), lb.data(), eps_tolerance<Real>(), bracket.data(), n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        CHECK_ULP_CLOSE(std::cbrt(a[i]), (bracket[i].first + bracket[i].second)/2, 8);
+    }
+
+    // Second order methods, and the policy is honoured: a reversed bracket is reported through errno rather than by an exception.
+    using namespace boost::math::policies;
+    using errno_policy = policy<evaluation_error<errno_on_error>, domain_error<errno_on_error>>;
+    std::swap(lo[7], hi[7]);
+    auto h = [&a](std::size_t i, Real x) { return std::make_tuple(x*x*x - a[i], 3*x*x, 6*x); };
+    batched_halley_iterate(std::execution::par, h, guess.data(), lo.data(), hi.data(), root.data(), n, digits, 100, iterations.data(), errno_policy());
+    batched_halley_iterate(h, guess.data(), lo.data(), hi.data(), serial.data(), n, digits, 100, serial_iterations.data(), errno_policy());
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        CHECK_EQUAL(serial[i], root[i]);
+        CHECK_EQUAL(serial_iterations[i], iterations[i]);
+    }
+    CHECK_EQUAL(boost::uintmax_t(0), iterations[7]);
+    batched_schroder_iterate(std::execution::par, h, guess.data(), lo.data(), hi.data(), root.data(), n, digits, 100, iterations.data(), errno_policy());
+    batched_schroder_iterate(h, guess.data(), lo.data(), hi.data(), serial.data(), n, digits, 100, serial_iterations.data(), errno_policy());
+    batched_newton_raphson_iterate(std::execution::par, f, guess.data(), lo.data(), hi.data(), root.data(), n, digits, 100, iterations.data(), errno_policy());
+    CHECK_EQUAL(boost::uintmax_t(0), iterations[7]);
+    std::swap(la[7], lb[7]);
+    batched_toms748_solve(std::execution::par, g, la.data(), lb.data(), eps_tolerance<Real>(), bracket.data(), n, 100, nullptr, errno_policy());
+    CHECK_NAN(bracket[7].first);
+}
+#endif
+
+int main()
+{
+    test_cbrt_newton<float>();
+    test_cbrt_newton<double>();
+    test_cbrt_newton<long double>();
+    test_cbrt_newton<cpp_bin_float_50>();
+
+    test_cbrt_second_order<float>();
+    test_cbrt_second_order<double>();
+    test_cbrt_second_order<long double>();
+    test_cbrt_second_order<cpp_bin_float_50>();
+
+    test_newton_safeguards<float>();
+    test_newton_safeguards<double>();
+    test_newton_safeguards<long double>();
+
+    test_second_order_safeguards<float>();
+    test_second_order_safeguards<double>();
+    test_second_order_safeguards<long double>();
+
+    test_divergent_lanes();
+    test_toms748();
+#if !defined(BOOST_NO_CXX17_HDR_EXECUTION) && !defined(BOOST_NO_CXX17_IF_CONSTEXPR)
+    test_parallel();
+#endif
+    return boost::math::test::report_errors();
+}
@@ -0,0 +1,87 @@
+//  (C) Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "math_unit_test.hpp"
+#include <sstream>
+#include <thread>
+#include <vector>
+#include <boost/math/special_functions/bernoulli.hpp>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+
+using boost::multiprecision::cpp_bin_float_50;
+using boost::multiprecision::cpp_bin_float_100;
+
+// Each policy type has its own table, so these start out empty:
+typedef boost::math::policies::policy<boost::math::policies::overflow_error<boost::math::policies::errno_on_error> > fresh_policy;
+typedef boost::math::policies::policy<boost::math::policies::overflow_error<boost::math::policies::ignore_error> > threaded_policy;
+
+void test_save_and_load()
+{
+   std::stringstream ss;
+   boost::math::save_bernoulli_cache<cpp_bin_float_50>(ss, 200);
+   std::string saved = ss.str();
+   CHECK_EQUAL(boost::math::load_bernoulli_cache<cpp_bin_float_50>(ss, fresh_policy()), true);
+   // Both the loaded numbers, and those found by extending the loaded table, are exactly those computed from scratch:
+   for (int i = 0; i < 300; ++i)
+   {
+      CHECK_EQUAL(boost::math::bernoulli_b2n<cpp_bin_float_50>(i, fresh_policy()), boost::math::bernoulli_b2n<cpp_bin_float_50>(i));
+      CHECK_EQUAL(boost::math::tangent_t2n<cpp_bin_float_50>(i, fresh_policy()), boost::math::tangent_t2n<cpp_bin_float_50>(i));
+   }
+   // Loading a smaller table over a larger one changes nothing:
+   std::stringstream again(saved);
+   CHECK_EQUAL(boost::math::load_bernoulli_cache<cpp_bin_float_50>(again, fresh_policy()), true);
+   CHECK_EQUAL(boost::math::bernoulli_b2n<cpp_bin_float_50>(250, fresh_policy()), boost::math::bernoulli_b2n<cpp_bin_float_50>(250));
+
+   // A table for another precision, or anything else, is rejected:
+   std::stringstream other(saved);
+   CHECK_EQUAL(boost::math::load_bernoulli_cache<cpp_bin_float_100>(other), false);
+   std::stringstream garbage("bernoulli 166 3 18446744073709551615\n1 0 0\n0.1 x");
+   CHECK_EQUAL(boost::math::load_bernoulli_cache<cpp_bin_float_50>(garbage, fresh_policy()), false);
+   std::stringstream empty;
+   CHECK_EQUAL(boost::math::load_bernoulli_cache<cpp_bin_float_50>(empty), false);
+}
+
+// Many threads extending the table at once all see the values computed by one thread alone:
+void test_threads()
+{
+   std::vector<cpp_bin_float_50> expected(600);
+   boost::math::bernoulli_b2n<cpp_bin_float_50>(0, 600, expected.begin());
+   std::vector<std::vector<cpp_bin_float_50>> results(16, std::vector<cpp_bin_float_50>(600));
+   std::vector<std::thread> threads;
+   for (std::size_t t = 0; t < results.size(); ++t)
+   {
+      threads.emplace_back([&results, t]()
+      {
+         // Each thread starts at a different place, so that many of them extend the table at once:
+         for (std::size_t i = 0; i < 600; ++i)
+         {
+            std::size_t k = (i + 37 * t) % 600;
+            results[t][k] = boost::math::bernoulli_b2n<cpp_bin_float_50>(static_cast<int>(k), threaded_policy());
+         }
+      });
+   }
+   for (auto& t : threads)
+   {
+      t.join();
+   }
+   for (auto const& r : results)
+   {
+      for (std::size_t i = 0; i < r.size(); ++i)
+      {
+         CHECK_EQUAL(r[i], expected[i]);
+      }
+   }
+}
+
+int main()
+{
+#ifndef BOOST_MATH_BERNOULLI_THREAD_LOCAL_CACHE
+   // Only types whose precision may change at run time get a table per thread by default:
+   static_assert(!boost::math::detail::bernoulli_cache_is_thread_local<cpp_bin_float_50>::value, "Fixed precision types share one table");
+#endif
+   test_save_and_load();
+   test_threads();
+   return boost::math::test::report_errors();
+}
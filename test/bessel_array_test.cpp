@@ -0,0 +1,256 @@
+/*
+ * Copyright agent, 2026
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "math_unit_test.hpp"
+#include <cmath>
+#include <iomanip>
+#include <vector>
+#include <boost/math/special_functions/bessel_array.hpp>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+#if !defined(BOOST_NO_CXX17_HDR_EXECUTION) && !defined(BOOST_NO_CXX17_IF_CONSTEXPR)
+#include <execution>
+#endif
+
+using boost::math::cyl_bessel_j;
+using boost::math::cyl_neumann;
+using boost::math::cyl_bessel_i;
+using boost::math::cyl_bessel_k;
+using boost::math::sph_bessel;
+using boost::math::sph_neumann;
+using boost::multiprecision::cpp_bin_float_50;
+
+//
+// Where the order is below the argument the functions oscillate, so the recurrence (and the scalar function)
+// can only be accurate relative to the amplitude of the oscillation, about sqrt(2/(pi x)) for the cylinder functions.
+//
+template<class Real>
+bool close_enough(Real expected, Real computed, Real order, Real x, Real tol)
+{
+    using std::abs;
+    using std::sqrt;
+    Real scale = abs(expected);
+    if (order < x)
+    {
+        scale += 1/sqrt(x);
+    }
+    if (abs(expected - computed) > tol*scale)
+    {
+        std::cerr << std::setprecision(std::numeric_limits<Real>::digits10 + 3) << "  Order " << order << " at x = " << x << ": expected " << expected << " but got " << computed << "\n";
+        return false;
+    }
+    return true;
+}
+
+// The number of orders of Y and K which can be computed before they overflow:
+template<class Real>
+unsigned dominant_count(Real v, Real x, unsigned n)
+{
+    using namespace boost::math::policies;
+    typedef policy<overflow_error<ignore_error>> ignore_overflow;
+    unsigned m = 0;
+    while (m < n && (boost::math::isfinite)(cyl_neumann(v + m, x, ignore_overflow())) && (boost::math::isfinite)(cyl_bessel_k(v + m, x, ignore_overflow())))
+    {
+        ++m;
+    }
+    // Leave a little room for the difference in rounding at the last order:
+    return m > 2 ? m - 2 : 0;
+}
+
+template<class Real>
+void test_cylinder(unsigned n, Real tol)
+{
+    // Orders for which v + k is exact, so that the scalar functions are evaluated at exactly the same orders:
+    std::vector<Real> orders{Real(0), Real(3)/8, Real(5)/2, Real(20)};
+    std::vector<Real> points{Real(1)/1024, Real(1)/10, Real(1), Real(7)/2, Real(25), Real(120)};
+    std::vector<Real> J(n), Y(n), I(n), K(n);
+    for (Real v : orders)
+    {
+        for (Real x : points)
+        {
+            boost::math::cyl_bessel_j_array(v, n, x, J.begin());
+            for (unsigned k = 0; k < n; ++k)
+            {
+                Real order = v + k;
+                CHECK_EQUAL(close_enough(cyl_bessel_j(order, x), J[k], order, x, tol), true);
+            }
+            using std::log;
+            // I decreases with the order, so is representable everywhere if it is at the first:
+            if (log(std::numeric_limits<Real>::max()) > x)
+            {
+                boost::math::cyl_bessel_i_array(v, n, x, I.begin());
+                for (unsigned k = 0; k < n; ++k)
+                {
+                    Real order = v + k;
+                    CHECK_EQUAL(close_enough(cyl_bessel_i(order, x), I[k], order, Real(0), tol), true);
+                }
+            }
+            // The dominant solutions overflow at high order, so take fewer orders there:
+            unsigned m = dominant_count(v, x, n);
+            boost::math::cyl_neumann_array(v, m, x, Y.begin());
+            boost::math::cyl_bessel_k_array(v, m, x, K.begin());
+            for (unsigned k = 0; k < m; ++k)
+            {
+                Real order = v + k;
+                CHECK_EQUAL(close_enough(cyl_neumann(order, x), Y[k], order, x, tol), true);
+                CHECK_EQUAL(close_enough(cyl_bessel_k(order, x), K[k], order, Real(0), tol), true);
+            }
+        }
+    }
+}
+
+template<class Real>
+void test_spherical()
+{
+    Real tol = 64*std::numeric_limits<Real>::epsilon();
+    unsigned n = 100;
+    std::vector<Real> j(n), y(n);
+    for (unsigned v : {0u, 3u})
+    {
+        for (Real x : {Real(1)/100, Real(1)/2, Real(6), Real(40), Real(300)})
+        {
+            boost::math::sph_bessel_array(v, n, x, j.begin());
+            for (unsigned k = 0; k < n; ++k)
+            {
+                // The spherical functions oscillate with amplitude 1/x:
+                Real order = Real(v + k);
+                Real expected = sph_bessel(v + k, x);
+                using std::abs;
+                Real scale = abs(expected) + (order < x ? 1/x : Real(0));
+                CHECK_LE(abs(expected - j[k]), tol*scale);
+            }
+            unsigned m = x < 1 ? 20 : n;
+            boost::math::sph_neumann_array(v, m, x, y.begin());
+            for (unsigned k = 0; k < m; ++k)
+            {
+                Real order = Real(v + k);
+                Real expected = sph_neumann(v + k, x);
+                using std::abs;
+                Real scale = abs(expected) + (order < x ? 1/x : Real(0));
+                CHECK_LE(abs(expected - y[k]), tol*scale);
+            }
+        }
+    }
+}
+
+// All orders up to 2000, far beyond the point at which the values underflow:
+void test_high_orders()
+{
+    unsigned n = 2001;
+    std::vector<double> J(n), I(n);
+    for (double x : {0.5, 30.0, 1500.0, 5000.0})
+    {
+        boost::math::cyl_bessel_j_array(0, n, x, J.begin());
+        for (unsigned k = 0; k < n; k += 50)
+        {
+            CHECK_EQUAL(close_enough(cyl_bessel_j(k, x), J[k], double(k), x, 256*std::numeric_limits<double>::epsilon()), true);
+        }
+        // I_0(x) overflows beyond x = 700 or so:
+        if (x < 700)
+        {
+            boost::math::cyl_bessel_i_array(0.0, n, x, I.begin());
+            for (unsigned k = 0; k < n; k += 50)
+            {
+                CHECK_EQUAL(close_enough(cyl_bessel_i(double(k), x), I[k], double(k), 0.0, 256*std::numeric_limits<double>::epsilon()), true);
+            }
+        }
+    }
+}
+
+// Arguments and orders outside the domain of the recurrences defer to the scalar functions:
+void test_special_cases()
+{
+    std::vector<double> J(5);
+    boost::math::cyl_bessel_j_array(0, 5, 0.0, J.begin());
+    CHECK_EQUAL(J[0], 1.0);
+    for (std::size_t k = 1; k < 5; ++k)
+    {
+        CHECK_EQUAL(J[k], 0.0);
+    }
+    boost::math::cyl_bessel_j_array(0, 5, -2.0, J.begin());
+    for (std::size_t k = 0; k < 5; ++k)
+    {
+        CHECK_EQUAL(J[k], cyl_bessel_j(int(k), -2.0));
+    }
+    boost::math::cyl_bessel_j_array(-2.5, 5, 3.0, J.begin());
+    for (std::size_t k = 0; k < 5; ++k)
+    {
+        CHECK_ULP_CLOSE(cyl_bessel_j(-2.5 + k, 3.0), J[k], 0);
+    }
+    bool thrown = false;
+    try
+    {
+        boost::math::cyl_neumann_array(0.0, 3, -1.0, J.begin());
+    }
+    catch (std::domain_error const &)
+    {
+        thrown = true;
+    }
+    CHECK_EQUAL(thrown, true);
+    // Y overflows at high order and small x:
+    thrown = false;
+    std::vector<double> Y(500);
+    try
+    {
+        boost::math::cyl_neumann_array(0.0, 500, 0.01, Y.begin());
+    }
+    catch (std::overflow_error const &)
+    {
+        thrown = true;
+    }
+    CHECK_EQUAL(thrown, true);
+}
+
+#if !defined(BOOST_NO_CXX17_HDR_EXECUTION) && !defined(BOOST_NO_CXX17_IF_CONSTEXPR)
+void test_parallel()
+{
+    std::size_t points = 1000;
+    unsigned n = 200;
+    std::vector<double> x(points);
+    for (std::size_t i = 0; i < points; ++i)
+    {
+        x[i] = (i + 1)/10.0;
+    }
+    std::vector<double> out(points*n), row(n);
+    boost::math::cyl_bessel_j_array(std::execution::par, 0.5, n, x.data(), points, out.data());
+    for (std::size_t i = 0; i < points; i += 37)
+    {
+        boost::math::cyl_bessel_j_array(0.5, n, x[i], row.begin());
+        for (unsigned k = 0; k < n; ++k)
+        {
+            CHECK_EQUAL(row[k], out[i*n + k]);
+        }
+    }
+    boost::math::sph_neumann_array(std::execution::par, 2u, 10, x.data(), points, out.data());
+    for (std::size_t i = 0; i < points; i += 37)
+    {
+        boost::math::sph_neumann_array(2u, 10, x[i], row.begin());
+        for (unsigned k = 0; k < 10; ++k)
+        {
+            CHECK_EQUAL(row[k], out[i*10 + k]);
+        }
+    }
+}
+#endif
+
+int main()
+{
+    test_cylinder<float>(150, 64*std::numeric_limits<float>::epsilon());
+    test_cylinder<double>(150, 64*std::numeric_limits<double>::epsilon());
+    test_cylinder<long double>(150, 64*std::numeric_limits<long double>::epsilon());
+    // The scalar functions are less accurate in multiprecision, particularly at high orders:
+    test_cylinder<cpp_bin_float_50>(60, 512*std::numeric_limits<cpp_bin_float_50>::epsilon());
+
+    test_spherical<double>();
+    test_spherical<long double>();
+
+    test_high_orders();
+    test_special_cases();
+#if !defined(BOOST_NO_CXX17_HDR_EXECUTION) && !defined(BOOST_NO_CXX17_IF_CONSTEXPR)
+    test_parallel();
+#endif
+    return boost::math::test::report_errors();
+}
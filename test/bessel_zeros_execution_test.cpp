@@ -0,0 +1,76 @@
+//  Copyright agent 2026
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "math_unit_test.hpp"
+#include <execution>
+#include <stdexcept>
+#include <vector>
+#include <boost/math/special_functions/airy.hpp>
+#include <boost/math/special_functions/bessel.hpp>
+
+// Zeros found concurrently are exactly those found one at a time, in the same order:
+template <class Real>
+void test_same_zeros()
+{
+   for (Real v : {Real(0), Real(0.5), Real(2.25), Real(-1.5), Real(7)})
+   {
+      std::vector<Real> expected;
+      boost::math::cyl_bessel_j_zero(v, 1, 500u, std::back_inserter(expected));
+      std::vector<Real> computed(500);
+      auto end = boost::math::cyl_bessel_j_zero(std::execution::par, v, 1, 500u, computed.begin());
+      CHECK_EQUAL(std::size_t(end - computed.begin()), std::size_t(500));
+      for (std::size_t i = 0; i < expected.size(); ++i)
+      {
+         CHECK_EQUAL(computed[i], expected[i]);
+      }
+
+      expected.clear();
+      computed.clear();
+      boost::math::cyl_neumann_zero(v, 3, 200u, std::back_inserter(expected));
+      boost::math::cyl_neumann_zero(std::execution::par_unseq, v, 3, 200u, std::back_inserter(computed));
+      CHECK_EQUAL(computed.size(), expected.size());
+      for (std::size_t i = 0; i < expected.size(); ++i)
+      {
+         CHECK_EQUAL(computed[i], expected[i]);
+      }
+   }
+
+   std::vector<Real> expected;
+   std::vector<Real> computed;
+   boost::math::airy_ai_zero<Real>(1, 300u, std::back_inserter(expected));
+   boost::math::airy_ai_zero<Real>(std::execution::par, 1, 300u, std::back_inserter(computed));
+   boost::math::airy_bi_zero<Real>(1, 300u, std::back_inserter(expected));
+   boost::math::airy_bi_zero<Real>(std::execution::seq, 1, 300u, std::back_inserter(computed), boost::math::policies::policy<>());
+   CHECK_EQUAL(computed.size(), expected.size());
+   for (std::size_t i = 0; i < expected.size(); ++i)
+   {
+      CHECK_EQUAL(computed[i], expected[i]);
+   }
+}
+
+// An error from any one of the zeros reaches the caller:
+void test_errors()
+{
+   std::vector<double> zeros(10);
+   bool caught = false;
+   try
+   {
+      boost::math::cyl_bessel_j_zero(std::execution::par, 0.0, -3, 10u, zeros.begin());
+   }
+   catch (std::domain_error const&)
+   {
+      caught = true;
+   }
+   CHECK_EQUAL(caught, true);
+}
+
+int main()
+{
+   test_same_zeros<float>();
+   test_same_zeros<double>();
+   test_same_zeros<long double>();
+   test_errors();
+   return boost::math::test::report_errors();
+}
@@ -0,0 +1,135 @@
+//  Copyright agent 2026
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "math_unit_test.hpp"
+#include <stdexcept>
+#include <vector>
+#include <boost/math/special_functions/binomial.hpp>
+#include <boost/math/special_functions/factorials.hpp>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+#include <boost/multiprecision/cpp_int.hpp>
+
+using boost::math::binomial_coefficient;
+using boost::math::binomial_coefficient_row;
+using boost::math::factorial;
+using boost::math::log_factorial;
+using boost::multiprecision::cpp_bin_float_50;
+using boost::multiprecision::cpp_bin_float_100;
+using boost::multiprecision::cpp_int;
+
+// The row gives exactly the values of binomial_coefficient, on both sides of the
+// table of factorials and of the largest exact coefficients:
+template <class Real>
+void test_row()
+{
+   for (unsigned n : { 0u, 1u, 2u, 5u, 34u, 35u, 40u, 56u, 57u, 100u, 101u, 126u, 170u, 171u, 200u, 301u, 1019u, 1030u })
+   {
+      // Rows with a coefficient that overflows Real:
+      if (log_factorial<double>(n) - log_factorial<double>(n / 2) - log_factorial<double>(n - n / 2) > boost::math::tools::log_max_value<Real>() - 1)
+      {
+         continue;
+      }
+      std::vector<Real> row(n + 1);
+      auto end = binomial_coefficient_row<Real>(n, row.begin());
+      CHECK_EQUAL(std::size_t(end - row.begin()), row.size());
+      for (unsigned k = 0; k <= n; ++k)
+      {
+         CHECK_EQUAL(row[k], binomial_coefficient<Real>(n, k));
+      }
+   }
+}
+
+// Beyond the table of factorials, a coefficient is exact while each C(n, k) (n - k)
+// fits in the significand:
+template <class Real>
+void test_exact()
+{
+   const cpp_int limit = cpp_int(1) << std::numeric_limits<Real>::digits;
+   for (unsigned n = boost::math::max_factorial<Real>::value + 1; n < boost::math::max_factorial<Real>::value + 400; n += 7)
+   {
+      cpp_int c = 1;
+      for (unsigned k = 0; k <= n / 2; ++k)
+      {
+         CHECK_EQUAL(binomial_coefficient<Real>(n, k), static_cast<Real>(c));
+         CHECK_EQUAL(binomial_coefficient<Real>(n, n - k), static_cast<Real>(c));
+         if (c * (n - k) >= limit)
+         {
+            break;
+         }
+         c = c * (n - k) / (k + 1);
+      }
+   }
+}
+
+// Factorials beyond the table are the values of the gamma function, now found again
+// from the cache:
+template <class Real>
+void test_factorials()
+{
+   cpp_int f = 1;
+   for (unsigned i = 1; i <= 1200; ++i)
+   {
+      f *= i;
+      Real value = factorial<Real>(i);
+      if (i > boost::math::max_factorial<Real>::value)
+      {
+         CHECK_EQUAL(value, Real(floor(boost::math::tgamma(Real(i + 1)) + 0.5f)));
+      }
+      CHECK_EQUAL(factorial<Real>(i), value);
+      CHECK_ULP_CLOSE(static_cast<Real>(log(cpp_bin_float_100(f))), log_factorial<Real>(i), 10);
+   }
+   CHECK_EQUAL(log_factorial<Real>(0), Real(0));
+   CHECK_EQUAL(log_factorial<Real>(1), Real(0));
+}
+
+void test_log_factorial()
+{
+   // Beyond the largest finite factorial of double:
+   for (unsigned i : { 171u, 180u, 1000u, 5000u, 100000u })
+   {
+      CHECK_ULP_CLOSE(static_cast<double>(boost::math::lgamma(cpp_bin_float_50(i + 1))), log_factorial<double>(i), 2);
+   }
+   CHECK_ULP_CLOSE(log_factorial<double>(6), std::log(720.0), 0);
+}
+
+void test_errors()
+{
+   bool thrown = false;
+   try
+   {
+      factorial<double>(171);
+   }
+   catch (const std::overflow_error&)
+   {
+      thrown = true;
+   }
+   CHECK_EQUAL(thrown, true);
+   thrown = false;
+   try
+   {
+      binomial_coefficient<double>(5, 6);
+   }
+   catch (const std::domain_error&)
+   {
+      thrown = true;
+   }
+   CHECK_EQUAL(thrown, true);
+}
+
+int main()
+{
+   test_row<float>();
+   test_row<double>();
+   test_row<long double>();
+   test_row<cpp_bin_float_50>();
+   test_exact<float>();
+   test_exact<double>();
+   test_exact<long double>();
+   test_exact<cpp_bin_float_50>();
+   test_factorials<cpp_bin_float_50>();
+   test_log_factorial();
+   test_errors();
+   return boost::math::test::report_errors();
+}
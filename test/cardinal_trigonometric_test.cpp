@@ -10,6 +10,7 @@
 #include <random>
 #include <boost/math/constants/constants.hpp>
 #include <boost/math/interpolators/cardinal_trigonometric.hpp>
+#include <boost/multiprecision/cpp_bin_float.hpp>
 #ifdef BOOST_HAS_FLOAT128
 #include <boost/multiprecision/float128.hpp>
 #endif
@@ -198,6 +199,42 @@ void test_bump()
 }
 
 
+// Lengths with large prime factors go through Bluestein's algorithm:
+template<class Real>
+void test_prime_lengths()
+{
+    using std::sin;
+    using std::cos;
+    for (unsigned n : {37u, 101u, 257u, 1009u})
+    {
+      Real t0 = 0;
+      Real T = 1;
+      Real h = T/n;
+      std::vector<Real> v(n);
+      auto s = [&](Real t) { return sin(3*two_pi<Real>()*(t-t0)/T) + cos(7*two_pi<Real>()*(t-t0)/T)/2;};
+      for(size_t j = 0; j < v.size(); ++j)
+      {
+          v[j] = s(t0 + j*h);
+      }
+      auto ct = cardinal_trigonometric<decltype(v)>(v, t0, h);
+      // Interpolation condition:
+      for(size_t j = 0; j < v.size(); ++j)
+      {
+          CHECK_MOLLIFIED_CLOSE(v[j], ct(t0 + j*h), 500*std::numeric_limits<Real>::epsilon());
+      }
+      CHECK_MOLLIFIED_CLOSE(s(Real(1)/Real(7)), ct(Real(1)/Real(7)), 500*std::numeric_limits<Real>::epsilon());
+      CHECK_MOLLIFIED_CLOSE(Real(0), ct.integrate(), 10*std::numeric_limits<Real>::epsilon());
+    }
+}
+
+// Without FFTW, arbitrary precision types are supported:
+void test_multiprecision()
+{
+    using boost::multiprecision::cpp_bin_float_50;
+    test_constant<cpp_bin_float_50>();
+    test_prime_lengths<cpp_bin_float_50>();
+}
+
 int main()
 {
 
@@ -206,6 +243,7 @@ int main()
     test_sampled_sine<float>();
     test_bump<float>();
     test_interpolation_condition<float>();
+    test_prime_lengths<float>();
 #endif
 
 
@@ -214,6 +252,7 @@ int main()
     test_sampled_sine<double>();
     test_bump<double>();
     test_interpolation_condition<double>();
+    test_prime_lengths<double>();
 #endif
 
 #ifdef TEST3
@@ -221,6 +260,7 @@ int main()
     test_sampled_sine<long double>();
     test_bump<long double>();
     test_interpolation_condition<long double>();
+    test_prime_lengths<long double>();
 #endif
 
 #ifdef TEST4
@@ -229,5 +269,9 @@ test_constant_q();
 #endif
 #endif
 
+#ifdef TEST5
+    test_multiprecision();
+#endif
+
     return boost::math::test::report_errors();
 }
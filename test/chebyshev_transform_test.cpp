@@ -5,10 +5,14 @@
  * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
  */
 #include "math_unit_test.hpp"
+#include <random>
 #include <boost/type_index.hpp>
 #include <boost/math/special_functions/chebyshev.hpp>
 #include <boost/math/special_functions/chebyshev_transform.hpp>
 #include <boost/math/special_functions/sinc.hpp>
+#if !defined(BOOST_NO_CXX17_HDR_EXECUTION) && !defined(BOOST_NO_CXX17_IF_CONSTEXPR)
+#include <execution>
+#endif
 
 #if !defined(TEST1) && !defined(TEST2) && !defined(TEST3) && !defined(TEST4)
 #  define TEST1
@@ -184,6 +188,96 @@ void test_chebyshev_chebyshev_transform()
     }
 }
 
+template<class Real>
+void test_batch_evaluation()
+{
+    using std::exp;
+    using std::cos;
+    auto f = [](Real x) { return exp(x)*cos(3*x); };
+    Real a = -2;
+    Real b = 3;
+    chebyshev_transform<Real> cheb(f, a, b);
+
+    std::mt19937_64 gen(12345);
+    std::uniform_real_distribution<double> dis(static_cast<double>(a), static_cast<double>(b));
+    std::vector<Real> x(1003);
+    for (auto & xi : x)
+    {
+        xi = static_cast<Real>(dis(gen));
+    }
+    // Make sure the endpoints, which use Reinsch's modification, are hit:
+    x[0] = a;
+    x[1] = b;
+    std::vector<Real> y(x.size());
+    cheb(x.begin(), x.end(), y.begin());
+    for (size_t i = 0; i < x.size(); ++i)
+    {
+        CHECK_ULP_CLOSE(cheb(x[i]), y[i], 2);
+    }
+
+    bool threw = false;
+    try
+    {
+        x[5] = b + 1;
+        cheb(x.begin(), x.end(), y.begin());
+    }
+    catch (std::domain_error const &)
+    {
+        threw = true;
+    }
+    CHECK_EQUAL(true, threw);
+}
+
+// Refinement must reuse every sample of f:
+template<class Real>
+void test_sample_reuse()
+{
+    size_t calls = 0;
+    auto f = [&calls](Real x) { ++calls; return x < Real(1)/Real(3) ? Real(0) : Real(1); };
+    chebyshev_transform<Real> cheb(f, 0, 1, std::numeric_limits<Real>::epsilon(), 6);
+    // f is discontinuous, so all refinements are used: 256 -> 768 -> 2304 -> 6912 <= 256*2^5.
+    CHECK_EQUAL(size_t(6912), calls);
+    CHECK_EQUAL(size_t(6912), cheb.coefficients().size());
+}
+
+// The shared plans are bounded: a plan no longer held by any caller is dropped once enough other lengths are requested.
+template<class Real>
+void test_plan_cache()
+{
+    using boost::math::tools::detail::get_fft_plan;
+    using boost::math::tools::detail::dct_ii;
+    std::weak_ptr<const dct_ii<Real>> first = get_fft_plan<dct_ii<Real>>(7);
+    CHECK_EQUAL(false, first.expired());
+    auto held = get_fft_plan<dct_ii<Real>>(9);
+    for (size_t n = 100; n < 100 + 2*BOOST_MATH_FFT_PLAN_CACHE_SIZE; ++n)
+    {
+        CHECK_EQUAL(n, get_fft_plan<dct_ii<Real>>(n)->size());
+    }
+    CHECK_EQUAL(true, first.expired());
+    CHECK_EQUAL(size_t(9), held->size());
+    auto again = get_fft_plan<dct_ii<Real>>(9);
+    CHECK_EQUAL(size_t(9), again->size());
+    CHECK_EQUAL(true, again == get_fft_plan<dct_ii<Real>>(9));
+}
+
+#if !defined(BOOST_NO_CXX17_HDR_EXECUTION) && !defined(BOOST_NO_CXX17_IF_CONSTEXPR)
+template<class Real>
+void test_parallel_construction()
+{
+    using std::sin;
+    auto f = [](Real x) { return sin(x*x); };
+    chebyshev_transform<Real> cheb(f, -3, 3);
+    chebyshev_transform<Real> pcheb(std::execution::par, f, -3, 3);
+    auto const & c = cheb.coefficients();
+    auto const & pc = pcheb.coefficients();
+    CHECK_EQUAL(c.size(), pc.size());
+    for (size_t i = 0; i < (std::min)(c.size(), pc.size()); ++i)
+    {
+        CHECK_ULP_CLOSE(c[i], pc[i], 0);
+    }
+}
+#endif
+
 int main()
 {
 #ifdef TEST1
@@ -191,18 +285,36 @@ int main()
     test_sin_chebyshev_transform<float>();
     test_atap_examples<float>();
     test_sinc_chebyshev_transform<float>();
+    test_batch_evaluation<float>();
+    test_sample_reuse<float>();
+    test_plan_cache<float>();
+#if !defined(BOOST_NO_CXX17_HDR_EXECUTION) && !defined(BOOST_NO_CXX17_IF_CONSTEXPR)
+    test_parallel_construction<float>();
+#endif
 #endif
 #ifdef TEST2
     test_chebyshev_chebyshev_transform<double>();
     test_sin_chebyshev_transform<double>();
     test_atap_examples<double>();
     test_sinc_chebyshev_transform<double>();
+    test_batch_evaluation<double>();
+    test_sample_reuse<double>();
+    test_plan_cache<double>();
+#if !defined(BOOST_NO_CXX17_HDR_EXECUTION) && !defined(BOOST_NO_CXX17_IF_CONSTEXPR)
+    test_parallel_construction<double>();
+#endif
 #endif
 #ifdef TEST3
     test_chebyshev_chebyshev_transform<long double>();
     test_sin_chebyshev_transform<long double>();
     test_atap_examples<long double>();
     test_sinc_chebyshev_transform<long double>();
+    test_batch_evaluation<long double>();
+    test_sample_reuse<long double>();
+    test_plan_cache<long double>();
+#if !defined(BOOST_NO_CXX17_HDR_EXECUTION) && !defined(BOOST_NO_CXX17_IF_CONSTEXPR)
+    test_parallel_construction<long double>();
+#endif
 #endif
 #ifdef TEST4
 #ifdef BOOST_HAS_FLOAT128
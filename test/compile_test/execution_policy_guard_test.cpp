@@ -0,0 +1,34 @@
+//  Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Headers with execution policy overloads must still compile in C++11 and C++14
+// modes, where <execution> may exist but declares no policies.  Built with
+// <cxxstd>11 and <cxxstd>14 by the Jamfile.
+//
+#include <boost/math/special_functions/gamma.hpp>
+#include <boost/math/special_functions/beta.hpp>
+#include <boost/math/special_functions/bessel.hpp>
+#include <boost/math/special_functions/airy.hpp>
+#include <boost/math/special_functions/prime_sieve.hpp>
+#include <boost/math/special_functions/chebyshev_transform.hpp>
+
+void compile_and_link_test()
+{
+   boost::math::incomplete_gamma_evaluator<double> g(2.5);
+   boost::math::incomplete_beta_evaluator<double> b(2.5, 3.5);
+   double x[1] = { 0.5 };
+   double y[1];
+   g.gamma_p(x, x + 1, y);
+   b.ibeta_inv(x, x + 1, y);
+   boost::math::cyl_bessel_j_zero(2.5, 1, 1u, y);
+   boost::math::airy_ai_zero<double>(1, 1u, y);
+   boost::math::prime_count(100u);
+   boost::math::chebyshev_transform<double> cheb([](double t) { return t * t; }, -1.0, 1.0);
+}
+
+int main()
+{
+   compile_and_link_test();
+}
@@ -0,0 +1,23 @@
+//  Copyright agent 2026.
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// Basic sanity check that header <boost/math/special_functions/prime_sieve.hpp>
+// #includes all the files that it needs to.
+//
+#include <boost/math/special_functions/prime_sieve.hpp>
+//
+// Note this header includes no other headers, this is
+// important if this test is to be meaningful:
+//
+#include "test_compile_result.hpp"
+
+void compile_and_link_test()
+{
+   check_result<bool>(boost::math::is_prime(u));
+   check_result<unsigned>(boost::math::prime_count(u));
+   unsigned primes[1];
+   check_result<unsigned*>(boost::math::prime_range(u, u, primes));
+   check_result<unsigned>(boost::math::prime_sieve<unsigned>(u, u).lower());
+}
@@ -0,0 +1,192 @@
+/*
+ * Copyright agent, 2026
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "math_unit_test.hpp"
+#include <cmath>
+#include <thread>
+#include <vector>
+#include <boost/math/quadrature/gauss.hpp>
+#include <boost/math/quadrature/gauss_rule.hpp>
+#include <boost/math/special_functions/beta.hpp>
+#include <boost/math/special_functions/gamma.hpp>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+
+using boost::multiprecision::cpp_bin_float_50;
+using boost::math::quadrature::gauss_jacobi_rule;
+using boost::math::quadrature::gauss_legendre_rule;
+using boost::math::quadrature::gauss_laguerre_rule;
+using boost::math::quadrature::gauss_hermite_rule;
+
+// The generated rules agree with the tabulated ones; without promotion, the weights closest to the ends lose a few bits:
+template<class Real>
+void test_tables()
+{
+    boost::math::quadrature::gauss<Real, 20> g20;
+    auto rule = gauss_legendre_rule<Real>(20);
+    CHECK_EQUAL(rule->size(), std::size_t(20));
+    for (std::size_t i = 0; i < g20.abscissa().size(); ++i)
+    {
+        CHECK_ULP_CLOSE(g20.abscissa()[i], rule->abscissa()[10 + i], 4);
+        CHECK_ULP_CLOSE(g20.weights()[i], rule->weights()[10 + i], 64);
+        CHECK_ULP_CLOSE(-g20.abscissa()[i], rule->abscissa()[9 - i], 4);
+    }
+    boost::math::quadrature::gauss<Real, 7> g7;
+    rule = gauss_legendre_rule<Real>(7);
+    CHECK_EQUAL(rule->abscissa()[3], Real(0));
+    for (std::size_t i = 0; i < g7.abscissa().size(); ++i)
+    {
+        CHECK_ULP_CLOSE(g7.abscissa()[i], rule->abscissa()[3 + i], 4);
+        CHECK_ULP_CLOSE(g7.weights()[i], rule->weights()[3 + i], 16);
+    }
+}
+
+// An n point rule integrates x^k exactly for k < 2n; the moments of each weight are known in closed form:
+template<class Real>
+void test_moments(unsigned n, Real tol)
+{
+    using std::abs;
+    using std::pow;
+    using boost::math::beta;
+    using boost::math::tgamma;
+    Real alpha = Real(1)/4;
+    Real beta_ = -Real(2)/3;
+    auto jacobi = gauss_jacobi_rule<Real>(n, alpha, beta_);
+    auto laguerre = gauss_laguerre_rule<Real>(n, Real(3)/2);
+    auto hermite = gauss_hermite_rule<Real>(n);
+    CHECK_EQUAL(jacobi->size(), std::size_t(n));
+    CHECK_EQUAL(laguerre->size(), std::size_t(n));
+    CHECK_EQUAL(hermite->size(), std::size_t(n));
+    for (unsigned k = 0; k < (std::min)(2*n, 12u); ++k)
+    {
+        // int_0^1 (1-x)^alpha (1+x)^beta (1+x)^k, with t = (1+x)/2:
+        Real expected = pow(Real(2), alpha + beta_ + k + 1)*beta(alpha + 1, beta_ + k + 1);
+        Real computed = jacobi->integrate([k](Real x) { return pow(1 + x, Real(k)); });
+        CHECK_LE(abs((computed - expected)/expected), tol);
+
+        expected = tgamma(Real(3)/2 + k + 1);
+        computed = laguerre->integrate([k](Real x) { return pow(x, Real(k)); });
+        CHECK_LE(abs((computed - expected)/expected), tol);
+
+        computed = hermite->integrate([k](Real x) { return pow(x, Real(k)); });
+        if (k & 1)
+        {
+            CHECK_LE(abs(computed), tol);
+        }
+        else
+        {
+            expected = tgamma(Real(k + 1)/2);
+            CHECK_LE(abs((computed - expected)/expected), tol);
+        }
+    }
+    // The abscissas are strictly increasing, and the weights positive:
+    for (auto rule : {jacobi, laguerre, hermite})
+    {
+        for (std::size_t i = 0; i < rule->size(); ++i)
+        {
+            CHECK_LE(Real(0), rule->weights()[i]);
+            if (i > 0)
+            {
+                CHECK_LE(rule->abscissa()[i - 1], rule->abscissa()[i]);
+            }
+        }
+    }
+}
+
+// The zeros of the double precision rule are those of a 50 digit one, rounded:
+void test_large_order()
+{
+    unsigned n = 2000;
+    auto rule = gauss_jacobi_rule<double>(n, 0.5, -0.25);
+    auto reference = gauss_jacobi_rule<cpp_bin_float_50>(n, cpp_bin_float_50(0.5), cpp_bin_float_50(-0.25));
+    for (std::size_t i = 0; i < n; i += 7)
+    {
+        CHECK_ABSOLUTE_ERROR(static_cast<double>(reference->abscissa()[i]), rule->abscissa()[i], 2*std::numeric_limits<double>::epsilon());
+        CHECK_ULP_CLOSE(static_cast<double>(reference->weights()[i]), rule->weights()[i], 64);
+    }
+    // A smooth integrand converges to rounding error:
+    auto legendre = gauss_legendre_rule<double>(100000);
+    double L1;
+    double computed = legendre->integrate([](double x) { return std::cos(x); }, &L1);
+    CHECK_ABSOLUTE_ERROR(2*std::sin(1.0), computed, 64*std::numeric_limits<double>::epsilon());
+    CHECK_ULP_CLOSE(computed, L1, 0);
+}
+
+void test_cache()
+{
+    auto a = gauss_legendre_rule<double>(333);
+    std::vector<std::thread> threads;
+    std::vector<std::shared_ptr<const boost::math::quadrature::gauss_rule<double>>> rules(8);
+    for (std::size_t i = 0; i < rules.size(); ++i)
+    {
+        threads.emplace_back([&rules, i]() { rules[i] = gauss_hermite_rule<double>(777); });
+    }
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+    for (auto& r : rules)
+    {
+        CHECK_EQUAL(r.get(), rules[0].get());
+    }
+    CHECK_EQUAL(a.get(), gauss_legendre_rule<double>(333).get());
+    CHECK_EQUAL(a.get(), gauss_jacobi_rule<double>(333, 0.0, 0.0).get());
+
+    // Sweeping the exponents does not keep every rule: one no longer held is dropped, one still held stays valid.
+    std::weak_ptr<const boost::math::quadrature::gauss_rule<double>> first = gauss_jacobi_rule<double>(20, 0.25, 0.3);
+    CHECK_EQUAL(false, first.expired());
+    for (int i = 0; i < 2*BOOST_MATH_GAUSS_RULE_CACHE_SIZE; ++i)
+    {
+        CHECK_EQUAL(std::size_t(20), gauss_jacobi_rule<double>(20, 0.25, double(i)/8).get()->abscissa().size());
+    }
+    CHECK_EQUAL(true, first.expired());
+    CHECK_EQUAL(std::size_t(333), a->abscissa().size());
+}
+
+void test_errors()
+{
+    bool caught = false;
+    try
+    {
+        gauss_jacobi_rule<double>(10, -1.0, 0.0);
+    }
+    catch (std::domain_error const&)
+    {
+        caught = true;
+    }
+    CHECK_EQUAL(caught, true);
+    caught = false;
+    try
+    {
+        gauss_hermite_rule<double>(0);
+    }
+    catch (std::domain_error const&)
+    {
+        caught = true;
+    }
+    CHECK_EQUAL(caught, true);
+}
+
+int main()
+{
+    test_tables<float>();
+    test_tables<double>();
+    test_tables<long double>();
+    test_tables<cpp_bin_float_50>();
+
+    for (unsigned n : {1u, 2u, 3u, 8u, 21u, 150u})
+    {
+        test_moments<float>(n, 128*std::numeric_limits<float>::epsilon());
+        test_moments<double>(n, 128*std::numeric_limits<double>::epsilon());
+        test_moments<long double>(n, 128*std::numeric_limits<long double>::epsilon());
+    }
+    test_moments<cpp_bin_float_50>(40, 256*std::numeric_limits<cpp_bin_float_50>::epsilon());
+
+    test_large_order();
+    test_cache();
+    test_errors();
+    return boost::math::test::report_errors();
+}
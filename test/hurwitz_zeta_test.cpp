@@ -0,0 +1,122 @@
+//  Copyright agent 2026
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "math_unit_test.hpp"
+#include <stdexcept>
+#include <vector>
+#include <boost/math/special_functions/zeta.hpp>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+
+using boost::math::hurwitz_zeta;
+using boost::math::zeta;
+using boost::multiprecision::cpp_bin_float_50;
+
+template <class Real>
+void test_identities()
+{
+   for (Real s : { Real(0.25), Real(0.5), Real(0.75), Real(1.125), Real(2), Real(3.5), Real(10.25), Real(40) })
+   {
+      CHECK_EQUAL(hurwitz_zeta(s, Real(1)), zeta(s));
+      // zeta(s, 1/2) = (2^s - 1) zeta(s):
+      CHECK_ULP_CLOSE((pow(Real(2), s) - 1) * zeta(s), hurwitz_zeta(s, Real(0.5)), 20);
+      if (s > 1)
+      {
+         // zeta(s, a) = zeta(s, a + 1) + a^-s has no cancellation for s > 1:
+         for (Real a : { Real(0.125), Real(0.75), Real(3.5), Real(17.25), Real(1000.5) })
+         {
+            CHECK_ULP_CLOSE(hurwitz_zeta(s, Real(a + 1)) + pow(a, -s), hurwitz_zeta(s, a), 10);
+         }
+      }
+   }
+   CHECK_EQUAL(hurwitz_zeta(Real(0), Real(0.125)), Real(0.375));
+}
+
+// Compared with a value calculated at higher precision:
+template <class Real>
+void test_values()
+{
+   for (Real s : { Real(0.375), Real(0.9375), Real(1.0625), Real(1.5), Real(4.25), Real(12.5), Real(25.5) })
+   {
+      for (Real a : { Real(0.0625), Real(0.875), Real(2.5), Real(12.125), Real(333.25) })
+      {
+         Real expected = static_cast<Real>(hurwitz_zeta(cpp_bin_float_50(s), cpp_bin_float_50(a)));
+         CHECK_ULP_CLOSE(expected, hurwitz_zeta(s, a), 30);
+      }
+   }
+}
+
+// Many a at the same s: exactly the values of the scalar function.
+template <class Real>
+void test_batch()
+{
+   std::vector<Real> a;
+   for (Real x = Real(0.03125); x < 50; x *= Real(1.25))
+   {
+      a.push_back(x);
+   }
+   for (Real s : { Real(0.5), Real(2.75), Real(25) })
+   {
+      std::vector<Real> values(a.size());
+      auto end = hurwitz_zeta(s, a.begin(), a.end(), values.begin());
+      CHECK_EQUAL(std::size_t(end - values.begin()), a.size());
+      for (std::size_t i = 0; i < a.size(); ++i)
+      {
+         CHECK_EQUAL(values[i], hurwitz_zeta(s, a[i]));
+      }
+   }
+}
+
+void test_errors()
+{
+   bool thrown = false;
+   try
+   {
+      hurwitz_zeta(2.0, -0.5);
+   }
+   catch (const std::domain_error&)
+   {
+      thrown = true;
+   }
+   CHECK_EQUAL(thrown, true);
+   thrown = false;
+   try
+   {
+      hurwitz_zeta(-1.5, 0.5);
+   }
+   catch (const std::domain_error&)
+   {
+      thrown = true;
+   }
+   CHECK_EQUAL(thrown, true);
+   thrown = false;
+   try
+   {
+      hurwitz_zeta(1.0, 0.5);
+   }
+   catch (const std::domain_error&)
+   {
+      thrown = true;
+   }
+   CHECK_EQUAL(thrown, true);
+}
+
+int main()
+{
+   test_identities<float>();
+   test_identities<double>();
+   test_identities<long double>();
+   test_values<float>();
+   test_values<double>();
+   test_values<long double>();
+   test_batch<double>();
+   test_batch<long double>();
+   test_errors();
+   // The Riemann zeta function of a multiprecision type, which uses the shared table of coefficients:
+   CHECK_ULP_CLOSE(cpp_bin_float_50("2.6123753486854883433485675679240716305708006524"), zeta(cpp_bin_float_50(1.5)), 10);
+   // zeta(2, 1/4) = pi^2 + 8G:
+   using namespace boost::math::constants;
+   CHECK_ULP_CLOSE(pi_sqr<cpp_bin_float_50>() + 8 * catalan<cpp_bin_float_50>(), hurwitz_zeta(cpp_bin_float_50(2), cpp_bin_float_50(0.25)), 10);
+   return boost::math::test::report_errors();
+}
@@ -0,0 +1,113 @@
+//  Copyright agent 2026
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "math_unit_test.hpp"
+#include <vector>
+#include <boost/math/special_functions/hypergeometric_1F1.hpp>
+
+using boost::math::hypergeometric_1F1;
+using boost::math::hypergeometric_1F1_regularized;
+using boost::math::log_hypergeometric_1F1;
+using boost::math::hypergeometric_1F1_evaluator;
+
+// Either both return the same value, or both raise an error:
+template <class F, class G>
+void check_same(F f, G g)
+{
+   bool f_failed = false;
+   bool g_failed = false;
+   decltype(f()) x = 0;
+   decltype(g()) y = 0;
+   try
+   {
+      x = f();
+   }
+   catch (const std::exception&)
+   {
+      f_failed = true;
+   }
+   try
+   {
+      y = g();
+   }
+   catch (const std::exception&)
+   {
+      g_failed = true;
+   }
+   CHECK_EQUAL(f_failed, g_failed);
+   CHECK_EQUAL(x, y);
+}
+
+// The evaluator gives exactly the values of the free functions, over a sweep of z
+// crossing each of the methods, including the large-z asymptotic series both sides
+// of the origin:
+template <class Real>
+void test_same_values()
+{
+   const Real parameters[][2] = {
+      { Real(0.5), Real(1.5) }, { Real(2.25), Real(7.5) }, { Real(-3.5), Real(2.75) },
+      { Real(12.5), Real(30.25) }, { Real(-20.5), Real(-45.25) }, { Real(0.25), Real(-3.5) },
+      { Real(3), Real(3) }, { Real(1), Real(2) }, { Real(-4), Real(5.5) }, { Real(150.5), Real(0.75) },
+   };
+   for (const auto& p : parameters)
+   {
+      hypergeometric_1F1_evaluator<Real> M(p[0], p[1]);
+      CHECK_EQUAL(M.a(), p[0]);
+      CHECK_EQUAL(M.b(), p[1]);
+      std::vector<Real> z, expected;
+      for (Real x = -400; x <= 400; x += Real(3.125))
+      {
+         check_same([&] { return M(x); }, [&] { return hypergeometric_1F1(p[0], p[1], x); });
+         check_same([&] { return M.regularized(x); }, [&] { return hypergeometric_1F1_regularized(p[0], p[1], x); });
+         int s1 = 0;
+         int s2 = 0;
+         check_same([&] { return M.log(x, &s1); }, [&] { return log_hypergeometric_1F1(p[0], p[1], x, &s2); });
+         CHECK_EQUAL(s1, s2);
+         try
+         {
+            expected.push_back(hypergeometric_1F1(p[0], p[1], x));
+            z.push_back(x);
+         }
+         catch (const std::exception&)
+         {
+         }
+      }
+      std::vector<Real> values(z.size());
+      M(z.begin(), z.end(), values.begin());
+      for (std::size_t i = 0; i < z.size(); ++i)
+      {
+         CHECK_EQUAL(values[i], expected[i]);
+      }
+   }
+}
+
+void test_errors()
+{
+   // Negative integer b with a that does not terminate the series first:
+   hypergeometric_1F1_evaluator<double> M(2.5, -3);
+   CHECK_EQUAL(M(0.0), 1.0);
+   bool thrown = false;
+   try
+   {
+      M(1.5);
+   }
+   catch (const std::domain_error&)
+   {
+      thrown = true;
+   }
+   CHECK_EQUAL(thrown, true);
+   // Integer arguments promote to double:
+   hypergeometric_1F1_evaluator<int> N(1, 2);
+   CHECK_ULP_CLOSE(N(1), boost::math::expm1(1.0), 1);
+}
+
+int main()
+{
+   test_same_values<float>();
+   test_same_values<double>();
+   test_same_values<long double>();
+   test_errors();
+   return boost::math::test::report_errors();
+}
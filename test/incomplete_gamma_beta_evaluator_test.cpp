@@ -0,0 +1,198 @@
+//  Copyright agent 2026
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "math_unit_test.hpp"
+#include <vector>
+#include <boost/math/special_functions/gamma.hpp>
+#include <boost/math/special_functions/beta.hpp>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+#if !defined(BOOST_NO_CXX17_HDR_EXECUTION) && !defined(BOOST_NO_CXX17_IF_CONSTEXPR)
+#include <execution>
+#endif
+
+using boost::math::incomplete_gamma_evaluator;
+using boost::math::incomplete_beta_evaluator;
+using boost::multiprecision::cpp_bin_float_50;
+
+// Either both return the same value, or both raise an error:
+template <class F, class G>
+void check_same(F f, G g)
+{
+   bool f_failed = false;
+   bool g_failed = false;
+   decltype(f()) x = 0;
+   decltype(g()) y = 0;
+   try
+   {
+      x = f();
+   }
+   catch (const std::exception&)
+   {
+      f_failed = true;
+   }
+   try
+   {
+      y = g();
+   }
+   catch (const std::exception&)
+   {
+      g_failed = true;
+   }
+   CHECK_EQUAL(f_failed, g_failed);
+   CHECK_EQUAL(x, y);
+}
+
+// The evaluator gives exactly the values of the free functions, over values of a
+// and x that reach each of the methods, including the finite sums, the small a
+// series and Temme's expansion:
+template <class Real>
+void test_gamma(unsigned step = 1)
+{
+   const Real as[] = { Real(1e-20), Real(0.03125), Real(0.25), Real(0.5), Real(0.875), Real(1), Real(2.5), Real(7), Real(19.75), Real(35.5), Real(120.25), Real(250), Real(1000.5), Real(60000) };
+   for (Real a : as)
+   {
+      incomplete_gamma_evaluator<Real> G(a);
+      CHECK_EQUAL(G.a(), a);
+      std::vector<Real> x;
+      for (Real z = Real(1e-30); z < 2 * a + 2000; z *= 1.5f * step)
+         x.push_back(z);
+      for (Real d = -8; d <= 8; d += Real(0.375) * step)
+         if (a + d * sqrt(a) > 0)
+            x.push_back(a + d * sqrt(a));
+      for (Real z : x)
+      {
+         check_same([&] { return G.gamma_p(z); }, [&] { return boost::math::gamma_p(a, z); });
+         check_same([&] { return G.gamma_q(z); }, [&] { return boost::math::gamma_q(a, z); });
+      }
+      for (Real p = Real(1e-12); p < 1; p = p < 0.5 ? Real(p * 4 * step) : Real(1 - (1 - p) / (4 * step)))
+      {
+         check_same([&] { return G.gamma_p_inv(p); }, [&] { return boost::math::gamma_p_inv(a, p); });
+         check_same([&] { return G.gamma_q_inv(p); }, [&] { return boost::math::gamma_q_inv(a, p); });
+      }
+      std::vector<Real> values(x.size());
+      G.gamma_q(x.begin(), x.end(), values.begin());
+      for (std::size_t i = 0; i < x.size(); ++i)
+         CHECK_EQUAL(values[i], boost::math::gamma_q(a, x[i]));
+   }
+}
+
+template <class Real>
+void test_beta(unsigned step = 1)
+{
+   const Real parameters[][2] = {
+      { Real(0.5), Real(0.5) }, { Real(0.125), Real(0.75) }, { Real(0.03125), Real(5.5) }, { Real(1), Real(3.25) },
+      { Real(2.5), Real(1) }, { Real(0.25), Real(30.5) }, { Real(20.5), Real(0.875) }, { Real(3), Real(7) },
+      { Real(4.5), Real(12.25) }, { Real(35.75), Real(10.5) }, { Real(200.5), Real(150.25) }, { Real(1000), Real(3.5) },
+   };
+   for (const auto& ab : parameters)
+   {
+      incomplete_beta_evaluator<Real> B(ab[0], ab[1]);
+      CHECK_EQUAL(B.a(), ab[0]);
+      CHECK_EQUAL(B.b(), ab[1]);
+      std::vector<Real> x;
+      for (Real z = Real(1e-20); z < 0.5; z *= 2 * step)
+      {
+         x.push_back(z);
+         x.push_back(1 - z);
+      }
+      for (Real z = 0; z <= 1; z += Real(0.03125) * step)
+         x.push_back(z);
+      for (Real z : x)
+      {
+         check_same([&] { return B.ibeta(z); }, [&] { return boost::math::ibeta(ab[0], ab[1], z); });
+         check_same([&] { return B.ibetac(z); }, [&] { return boost::math::ibetac(ab[0], ab[1], z); });
+         check_same([&] { return B.ibeta_inv(z); }, [&] { return boost::math::ibeta_inv(ab[0], ab[1], z); });
+         check_same([&] { return B.ibetac_inv(z); }, [&] { return boost::math::ibetac_inv(ab[0], ab[1], z); });
+      }
+      std::vector<Real> values(x.size());
+      B.ibeta(x.begin(), x.end(), values.begin());
+      for (std::size_t i = 0; i < x.size(); ++i)
+         CHECK_EQUAL(values[i], boost::math::ibeta(ab[0], ab[1], x[i]));
+   }
+}
+
+#if !defined(BOOST_NO_CXX17_HDR_EXECUTION) && !defined(BOOST_NO_CXX17_IF_CONSTEXPR)
+void test_execution_policy()
+{
+   incomplete_gamma_evaluator<double> G(3.75);
+   incomplete_beta_evaluator<double> B(2.5, 17.25);
+   std::vector<double> p;
+   for (double z = 0.0078125; z < 1; z += 0.0078125)
+      p.push_back(z);
+   std::vector<double> values(p.size());
+   G.gamma_p_inv(std::execution::par, p.begin(), p.end(), values.begin());
+   for (std::size_t i = 0; i < p.size(); ++i)
+      CHECK_EQUAL(values[i], boost::math::gamma_p_inv(3.75, p[i]));
+   B.ibetac(std::execution::par, p.begin(), p.end(), values.begin());
+   for (std::size_t i = 0; i < p.size(); ++i)
+      CHECK_EQUAL(values[i], boost::math::ibetac(2.5, 17.25, p[i]));
+   // An error from any one argument is rethrown:
+   p[p.size() / 2] = 2;
+   bool thrown = false;
+   try
+   {
+      B.ibeta_inv(std::execution::par, p.begin(), p.end(), values.begin());
+   }
+   catch (const std::domain_error&)
+   {
+      thrown = true;
+   }
+   CHECK_EQUAL(thrown, true);
+}
+#endif
+
+void test_errors()
+{
+   incomplete_gamma_evaluator<double> G(-1.5);
+   check_same([&] { return G.gamma_p(2.0); }, [&] { return boost::math::gamma_p(-1.5, 2.0); });
+   check_same([&] { return G.gamma_q_inv(0.5); }, [&] { return boost::math::gamma_q_inv(-1.5, 0.5); });
+   incomplete_beta_evaluator<double> B(2.0, 0.0);
+   check_same([&] { return B.ibeta(0.5); }, [&] { return boost::math::ibeta(2.0, 0.0, 0.5); });
+   check_same([&] { return B.ibetac_inv(0.5); }, [&] { return boost::math::ibetac_inv(2.0, 0.0, 0.5); });
+   incomplete_beta_evaluator<double> C(2.0, 3.0);
+   check_same([&] { return C.ibeta(1.5); }, [&] { return boost::math::ibeta(2.0, 3.0, 1.5); });
+   // Integer arguments promote to double:
+   incomplete_gamma_evaluator<int> N(2);
+   CHECK_EQUAL(N.gamma_q(1), boost::math::gamma_q(2, 1));
+}
+
+// Terms cached for one a are not used for another:
+void test_cache_mismatch()
+{
+   typedef boost::math::policies::policy<> policy_type;
+   typedef boost::math::lanczos::lanczos<double, policy_type>::type lanczos_type;
+   for (double a : { 0.25, 2.5, 40.0 })
+   {
+      boost::math::detail::igamma_parameter_cache<double> cache(a, policy_type(), lanczos_type());
+      for (double b : { 0.5, 3.0, 40.5 })
+      {
+         for (double x : { 0.125, 2.0, 35.0 })
+         {
+            CHECK_EQUAL(boost::math::detail::regularised_gamma_prefix(b, x, policy_type(), lanczos_type(), &cache),
+                        boost::math::detail::regularised_gamma_prefix(b, x, policy_type(), lanczos_type()));
+            CHECK_EQUAL(boost::math::detail::gamma_incomplete_imp(b, x, true, true, policy_type(), static_cast<double*>(0), &cache),
+                        boost::math::detail::gamma_incomplete_imp(b, x, true, true, policy_type(), static_cast<double*>(0)));
+         }
+      }
+   }
+}
+
+int main()
+{
+   test_gamma<float>();
+   test_gamma<double>();
+   test_gamma<long double>();
+   test_gamma<cpp_bin_float_50>(4);
+   test_beta<float>();
+   test_beta<double>();
+   test_beta<long double>();
+   test_beta<cpp_bin_float_50>(4);
+#if !defined(BOOST_NO_CXX17_HDR_EXECUTION) && !defined(BOOST_NO_CXX17_IF_CONSTEXPR)
+   test_execution_policy();
+#endif
+   test_cache_mismatch();
+   test_errors();
+   return boost::math::test::report_errors();
+}
@@ -0,0 +1,79 @@
+//  Copyright agent 2026
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "math_unit_test.hpp"
+#include <stdexcept>
+#include <vector>
+#include <boost/math/special_functions/jacobi_elliptic.hpp>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+
+using boost::math::jacobi_elliptic;
+using boost::math::jacobi_elliptic_evaluator;
+using boost::multiprecision::cpp_bin_float_50;
+
+// The evaluator gives exactly the values of jacobi_elliptic, for moduli reaching
+// each of the special cases, the small k expansion, the AGM recurrence and k > 1:
+template <class Real>
+void test_same_values(unsigned step = 1)
+{
+   for (Real k : { Real(0), Real(1e-10), Real(0.001), Real(0.25), Real(0.5), Real(0.75), Real(0.96875), Real(0.999999), Real(1), Real(1.5), Real(20) })
+   {
+      jacobi_elliptic_evaluator<Real> J(k);
+      CHECK_EQUAL(J.k(), k);
+      std::vector<Real> u;
+      for (Real x = -40; x <= 40; x += Real(0.4375) * step)
+      {
+         u.push_back(x);
+      }
+      u.push_back(Real(1e-20));
+      for (Real x : u)
+      {
+         Real cn1, dn1, cn2, dn2;
+         Real sn1 = J(x, &cn1, &dn1);
+         Real sn2 = jacobi_elliptic(k, x, &cn2, &dn2);
+         CHECK_EQUAL(sn1, sn2);
+         CHECK_EQUAL(cn1, cn2);
+         CHECK_EQUAL(dn1, dn2);
+         CHECK_EQUAL(J(x), sn2);
+      }
+      std::vector<Real> sn(u.size()), cn(u.size()), dn(u.size());
+      J(u.begin(), u.end(), sn.begin(), cn.begin(), dn.begin());
+      for (std::size_t i = 0; i < u.size(); ++i)
+      {
+         Real c, d;
+         CHECK_EQUAL(sn[i], jacobi_elliptic(k, u[i], &c, &d));
+         CHECK_EQUAL(cn[i], c);
+         CHECK_EQUAL(dn[i], d);
+      }
+   }
+}
+
+void test_errors()
+{
+   jacobi_elliptic_evaluator<double> J(-0.5);
+   bool thrown = false;
+   try
+   {
+      J(1.5);
+   }
+   catch (const std::domain_error&)
+   {
+      thrown = true;
+   }
+   CHECK_EQUAL(thrown, true);
+   // Integer arguments promote to double:
+   jacobi_elliptic_evaluator<int> N(0);
+   CHECK_ULP_CLOSE(std::sin(1.0), N(1), 0);
+}
+
+int main()
+{
+   test_same_values<float>();
+   test_same_values<double>();
+   test_same_values<long double>();
+   test_same_values<cpp_bin_float_50>(8);
+   test_errors();
+   return boost::math::test::report_errors();
+}
@@ -0,0 +1,102 @@
+//  Copyright agent 2026
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "math_unit_test.hpp"
+#include <stdexcept>
+#include <vector>
+#include <boost/math/special_functions/jacobi_theta.hpp>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+
+using boost::math::jacobi_theta_evaluator;
+using boost::multiprecision::cpp_bin_float_50;
+
+// The evaluator gives exactly the values of the tau functions, both for tau < 1,
+// where the imaginary transformation is used, and for the q-series with tau >= 1:
+template <class Real>
+void test_same_values(unsigned step = 1)
+{
+   for (Real tau : { Real(0.0625), Real(0.5), Real(0.96875), Real(1), Real(1.25), Real(3.5), Real(20), Real(300) })
+   {
+      jacobi_theta_evaluator<Real> E(tau);
+      CHECK_EQUAL(E.tau(), tau);
+      std::vector<Real> z;
+      for (Real x = -12; x <= 12; x += Real(0.1875) * step)
+      {
+         z.push_back(x);
+      }
+      for (Real x : z)
+      {
+         CHECK_EQUAL(E.theta1(x), boost::math::jacobi_theta1tau(x, tau));
+         CHECK_EQUAL(E.theta2(x), boost::math::jacobi_theta2tau(x, tau));
+         CHECK_EQUAL(E.theta3(x), boost::math::jacobi_theta3tau(x, tau));
+         CHECK_EQUAL(E.theta4(x), boost::math::jacobi_theta4tau(x, tau));
+         CHECK_EQUAL(E.theta3m1(x), boost::math::jacobi_theta3m1tau(x, tau));
+         CHECK_EQUAL(E.theta4m1(x), boost::math::jacobi_theta4m1tau(x, tau));
+         Real t1, t2, t3, t4;
+         E(x, &t1, &t2, &t3, &t4);
+         CHECK_EQUAL(t1, boost::math::jacobi_theta1tau(x, tau));
+         CHECK_EQUAL(t2, boost::math::jacobi_theta2tau(x, tau));
+         CHECK_EQUAL(t3, boost::math::jacobi_theta3tau(x, tau));
+         CHECK_EQUAL(t4, boost::math::jacobi_theta4tau(x, tau));
+      }
+      std::vector<Real> values(z.size());
+      E.theta4(z.begin(), z.end(), values.begin());
+      for (std::size_t i = 0; i < z.size(); ++i)
+      {
+         CHECK_EQUAL(values[i], boost::math::jacobi_theta4tau(z[i], tau));
+      }
+   }
+}
+
+// For a fixed q, as the q functions do:
+void test_nome()
+{
+   for (double q : { 0.001, 0.2, 0.75 })
+   {
+      jacobi_theta_evaluator<double> E(-std::log(q) / boost::math::constants::pi<double>());
+      for (double x = -3; x <= 3; x += 0.125)
+      {
+         CHECK_EQUAL(E.theta1(x), boost::math::jacobi_theta1(x, q));
+         CHECK_EQUAL(E.theta3(x), boost::math::jacobi_theta3(x, q));
+      }
+   }
+}
+
+void test_errors()
+{
+   jacobi_theta_evaluator<double> E(-1.5);
+   bool thrown = false;
+   try
+   {
+      E.theta2(0.5);
+   }
+   catch (const std::domain_error&)
+   {
+      thrown = true;
+   }
+   CHECK_EQUAL(thrown, true);
+   thrown = false;
+   try
+   {
+      double t1, t2, t3, t4;
+      E(0.5, &t1, &t2, &t3, &t4);
+   }
+   catch (const std::domain_error&)
+   {
+      thrown = true;
+   }
+   CHECK_EQUAL(thrown, true);
+}
+
+int main()
+{
+   test_same_values<float>();
+   test_same_values<double>();
+   test_same_values<long double>();
+   test_same_values<cpp_bin_float_50>(8);
+   test_nome();
+   test_errors();
+   return boost::math::test::report_errors();
+}
@@ -0,0 +1,89 @@
+//  Copyright agent 2026
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "math_unit_test.hpp"
+#include <stdexcept>
+#include <vector>
+#include <boost/math/special_functions/lambert_w.hpp>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+
+using boost::math::lambert_w0;
+using boost::math::lambert_wm1;
+
+// The array forms give exactly the values of the scalar functions,
+// over arguments in every region of the approximations:
+template <class Real>
+void test_same_values()
+{
+   std::vector<Real> z;
+   const Real e_minus_one = boost::math::constants::exp_minus_one<Real>();
+   z.push_back(-e_minus_one);
+   for (Real x = -e_minus_one + Real(1) / 1024; x < 0.05; x += Real(1) / 64)
+   {
+      z.push_back(x);
+   }
+   for (Real x = Real(0.05); x < Real(1e30); x *= Real(1.5))
+   {
+      z.push_back(x);
+   }
+   std::vector<Real> w(z.size());
+   lambert_w0(&z[0], z.size(), &w[0]);
+   for (std::size_t i = 0; i < z.size(); ++i)
+   {
+      CHECK_EQUAL(w[i], lambert_w0(z[i]));
+   }
+
+   z.clear();
+   z.push_back(-e_minus_one);
+   for (Real x = -e_minus_one + Real(1) / 4096; x < -Real(1e-30); x = x < -0.3 ? Real(x + Real(1) / 256) : Real(x / 2))
+   {
+      z.push_back(x);
+   }
+   w.resize(z.size());
+   lambert_wm1(&z[0], z.size(), &w[0]);
+   for (std::size_t i = 0; i < z.size(); ++i)
+   {
+      CHECK_EQUAL(w[i], lambert_wm1(z[i]));
+   }
+}
+
+void test_errors()
+{
+   const double z[] = { 1.0, -1.0, 2.0 };
+   double w[] = { 0.0, 0.0, 0.0 };
+   bool thrown = false;
+   try
+   {
+      lambert_w0(z, 3, w);
+   }
+   catch (const std::domain_error&)
+   {
+      thrown = true;
+   }
+   CHECK_EQUAL(thrown, true);
+   // Values preceding the argument out of range have been written:
+   CHECK_EQUAL(w[0], lambert_w0(1.0));
+   CHECK_EQUAL(w[2], 0.0);
+   thrown = false;
+   try
+   {
+      lambert_wm1(z, 3, w);
+   }
+   catch (const std::domain_error&)
+   {
+      thrown = true;
+   }
+   CHECK_EQUAL(thrown, true);
+}
+
+int main()
+{
+   test_same_values<float>();
+   test_same_values<double>();
+   test_same_values<long double>();
+   test_same_values<boost::multiprecision::cpp_bin_float_50>();
+   test_errors();
+   return boost::math::test::report_errors();
+}
@@ -0,0 +1,214 @@
+/*
+ * Copyright agent, 2026
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "math_unit_test.hpp"
+#include <cmath>
+#include <random>
+#include <vector>
+#include <boost/math/special_functions/hermite.hpp>
+#include <boost/math/special_functions/laguerre.hpp>
+#include <boost/math/special_functions/chebyshev.hpp>
+#include <boost/math/special_functions/gegenbauer.hpp>
+#include <boost/math/special_functions/jacobi.hpp>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+
+using boost::multiprecision::cpp_bin_float_50;
+
+// The single point arrays use exactly the recurrences of the scalar functions, so agree with them exactly:
+template<class Real>
+void test_single_point()
+{
+    using namespace boost::math;
+    typedef policies::policy<policies::promote_float<false>, policies::promote_double<false>> no_promotion;
+    unsigned n = 40;
+    std::vector<Real> v(n + 1);
+    for (Real x : {Real(-1), Real(-3)/4, Real(0), Real(1)/3, Real(7)/8, Real(1), Real(5)/2})
+    {
+        hermite_array(n, x, v.begin(), no_promotion());
+        for (unsigned k = 0; k <= n; ++k)
+        {
+            CHECK_ULP_CLOSE(hermite(k, x, no_promotion()), v[k], 0);
+        }
+        laguerre_array(n, x, v.begin(), no_promotion());
+        for (unsigned k = 0; k <= n; ++k)
+        {
+            CHECK_ULP_CLOSE(laguerre(k, x, no_promotion()), v[k], 0);
+        }
+        Real lambda = Real(3)/4;
+        gegenbauer_array(n, lambda, x, v.begin());
+        for (unsigned k = 0; k <= n; ++k)
+        {
+            CHECK_ULP_CLOSE(gegenbauer(k, lambda, x), v[k], 0);
+        }
+        Real alpha = Real(1)/2;
+        Real beta = Real(-1)/4;
+        jacobi_array(n, alpha, beta, x, v.begin());
+        for (unsigned k = 0; k <= n; ++k)
+        {
+            CHECK_ULP_CLOSE(jacobi(k, alpha, beta, x), v[k], 0);
+        }
+        if (x >= -1 && x <= 1)
+        {
+            chebyshev_t_array(n, x, v.begin(), no_promotion());
+            for (unsigned k = 0; k <= n; ++k)
+            {
+                CHECK_ULP_CLOSE(chebyshev_t(k, x, no_promotion()), v[k], 0);
+            }
+            chebyshev_u_array(n, x, v.begin(), no_promotion());
+            for (unsigned k = 0; k <= n; ++k)
+            {
+                CHECK_ULP_CLOSE(chebyshev_u(k, x, no_promotion()), v[k], 0);
+            }
+        }
+    }
+    // The default policy promotes float and double, just as the scalar functions do:
+    hermite_array(3u, Real(1)/3, v.begin());
+    CHECK_ULP_CLOSE(hermite(3, Real(1)/3), v[3], 0);
+    // Degree zero writes exactly one value:
+    std::vector<Real> w;
+    laguerre_array(0u, Real(2), std::back_inserter(w));
+    CHECK_EQUAL(w.size(), std::size_t(1));
+    CHECK_EQUAL(w[0], Real(1));
+}
+
+// The recurrences are the same up to the order of the operations, so allow for the
+// cancellation of terms close to a zero, relative to the size of the terms:
+template<class Real, class F>
+void check_many(std::vector<Real> const & x, std::vector<Real> const & out, unsigned n, F f, Real scale)
+{
+    using std::abs;
+    std::size_t points = x.size();
+    for (unsigned k = 0; k <= n; ++k)
+    {
+        for (std::size_t i = 0; i < points; ++i)
+        {
+            Real expected = f(k, x[i]);
+            CHECK_LE(abs(expected - out[k*points + i]), 64*(k + 1)*std::numeric_limits<Real>::epsilon()*(abs(expected) + scale));
+        }
+    }
+}
+
+// The values at many points, stored by degree, must agree with the scalar functions to rounding:
+template<class Real>
+void test_many_points()
+{
+    using namespace boost::math;
+    typedef policies::policy<policies::promote_float<false>, policies::promote_double<false>> no_promotion;
+    std::mt19937 gen(12345);
+    std::uniform_real_distribution<double> dis(-1, 1);
+    unsigned n = 30;
+    std::size_t points = 21;
+    std::vector<Real> x(points);
+    for (auto & z : x)
+    {
+        z = Real(dis(gen));
+    }
+    std::vector<Real> out((n + 1)*points);
+    hermite_array(n, x.data(), points, out.data());
+    check_many(x, out, n, [](unsigned k, Real z) { return hermite(k, z, no_promotion()); }, Real(0));
+    laguerre_array(n, x.data(), points, out.data());
+    check_many(x, out, n, [](unsigned k, Real z) { return laguerre(k, z, no_promotion()); }, Real(1));
+    chebyshev_t_array(n, x.data(), points, out.data());
+    check_many(x, out, n, [](unsigned k, Real z) { return chebyshev_t(k, z, no_promotion()); }, Real(1));
+    chebyshev_u_array(n, x.data(), points, out.data());
+    check_many(x, out, n, [](unsigned k, Real z) { return chebyshev_u(k, z, no_promotion()); }, Real(n + 1));
+    Real lambda = Real(5)/2;
+    gegenbauer_array(n, lambda, x.data(), points, out.data());
+    check_many(x, out, n, [&](unsigned k, Real z) { return gegenbauer(k, lambda, z); }, gegenbauer(n, lambda, Real(1)));
+    Real alpha = Real(3)/2;
+    Real beta = Real(1)/3;
+    jacobi_array(n, alpha, beta, x.data(), points, out.data());
+    check_many(x, out, n, [&](unsigned k, Real z) { return jacobi(k, alpha, beta, z); }, jacobi(n, alpha, beta, Real(1)));
+}
+
+template<class Real>
+void test_clenshaw()
+{
+    using namespace boost::math;
+    using std::abs;
+    std::mt19937 gen(31415);
+    std::uniform_real_distribution<double> dis(-1, 1);
+    for (std::size_t length : {0, 1, 2, 3, 10, 25})
+    {
+        std::vector<Real> c(length);
+        for (auto & ck : c)
+        {
+            ck = Real(dis(gen));
+        }
+        for (Real x : {Real(-9)/10, Real(-1)/4, Real(0), Real(1)/7, Real(4)/5})
+        {
+            Real lambda = Real(1)/3;
+            Real alpha = Real(-1)/3;
+            Real beta = Real(2);
+            Real h = 0, l = 0, g = 0, j = 0;
+            Real h_scale = 0, l_scale = 0, g_scale = 0, j_scale = 0;
+            for (std::size_t k = 0; k < length; ++k)
+            {
+                h += c[k]*hermite(unsigned(k), x);
+                h_scale += abs(c[k]*hermite(unsigned(k), x));
+                l += c[k]*laguerre(unsigned(k), x);
+                l_scale += abs(c[k]*laguerre(unsigned(k), x));
+                g += c[k]*gegenbauer(unsigned(k), lambda, x);
+                g_scale += abs(c[k]*gegenbauer(unsigned(k), lambda, x));
+                j += c[k]*jacobi(unsigned(k), alpha, beta, x);
+                j_scale += abs(c[k]*jacobi(unsigned(k), alpha, beta, x));
+            }
+            Real tol = 64*std::numeric_limits<Real>::epsilon()*Real(length + 1);
+            CHECK_LE(abs(h - hermite_clenshaw_recurrence(c.data(), length, x)), tol*h_scale + std::numeric_limits<Real>::min());
+            CHECK_LE(abs(l - laguerre_clenshaw_recurrence(c.data(), length, x)), tol*l_scale + std::numeric_limits<Real>::min());
+            CHECK_LE(abs(g - gegenbauer_clenshaw_recurrence(c.data(), length, lambda, x)), tol*g_scale + std::numeric_limits<Real>::min());
+            CHECK_LE(abs(j - jacobi_clenshaw_recurrence(c.data(), length, alpha, beta, x)), tol*j_scale + std::numeric_limits<Real>::min());
+        }
+    }
+}
+
+void test_domain()
+{
+    std::vector<double> v(4);
+    bool thrown = false;
+    try
+    {
+        boost::math::gegenbauer_array(3, -1.0, 0.5, v.begin());
+    }
+    catch (std::domain_error const &)
+    {
+        thrown = true;
+    }
+    CHECK_EQUAL(thrown, true);
+    // Hermite polynomials of high degree overflow float:
+    thrown = false;
+    std::vector<float> f(300);
+    try
+    {
+        boost::math::hermite_array(299, 10.0f, f.begin());
+    }
+    catch (std::overflow_error const &)
+    {
+        thrown = true;
+    }
+    CHECK_EQUAL(thrown, true);
+}
+
+int main()
+{
+    test_single_point<float>();
+    test_single_point<double>();
+    test_single_point<long double>();
+    test_single_point<cpp_bin_float_50>();
+
+    test_many_points<float>();
+    test_many_points<double>();
+    test_many_points<long double>();
+
+    test_clenshaw<float>();
+    test_clenshaw<double>();
+    test_clenshaw<long double>();
+    test_clenshaw<cpp_bin_float_50>();
+
+    test_domain();
+    return boost::math::test::report_errors();
+}
@@ -0,0 +1,169 @@
+//  Copyright agent 2026
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "math_unit_test.hpp"
+#include <stdexcept>
+#include <vector>
+#include <boost/math/special_functions/owens_t.hpp>
+#include <boost/math/distributions/normal.hpp>
+#include <boost/math/quadrature/gauss_kronrod.hpp>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+
+using boost::math::owens_t;
+using boost::math::bivariate_normal_cdf;
+using boost::multiprecision::cpp_bin_float_50;
+
+// The array overload gives exactly the values of the scalar function, over (h, a)
+// reaching each of the methods T1 - T6:
+template <class Real>
+void test_owens_t_array()
+{
+   std::vector<Real> h, a;
+   for (Real x = -9; x <= 9; x += Real(0.375))
+   {
+      for (Real y : { Real(-20), Real(-1), Real(0), Real(0.03125), Real(0.25), Real(0.5), Real(0.75), Real(0.9375), Real(1), Real(1.5), Real(6), Real(1000) })
+      {
+         h.push_back(x);
+         a.push_back(y);
+      }
+   }
+   std::vector<Real> values(h.size());
+   owens_t(h.data(), a.data(), h.size(), values.data());
+   for (std::size_t i = 0; i < h.size(); ++i)
+   {
+      CHECK_EQUAL(values[i], owens_t(h[i], a[i]));
+   }
+}
+
+// P(X <= h, Y <= k) as the integral over x <= h of phi(x) G((k - rho x) / sqrt(1 - rho^2)):
+double bivariate_normal_integral(double h, double k, double rho)
+{
+   boost::math::normal_distribution<double> N;
+   double s = sqrt((1 - rho) * (1 + rho));
+   auto f = [&](double x) { return boost::math::pdf(N, x) * boost::math::cdf(N, (k - rho * x) / s); };
+   return boost::math::quadrature::gauss_kronrod<double, 61>::integrate(f, -std::numeric_limits<double>::infinity(), h, 15, 1e-15);
+}
+
+// The standard normal distribution, calculated at higher precision:
+template <class Real>
+Real normal_cdf(Real x)
+{
+   return static_cast<Real>(boost::math::cdf(boost::math::normal_distribution<cpp_bin_float_50>(), cpp_bin_float_50(x)));
+}
+
+template <class Real>
+void test_bivariate_identities()
+{
+   using std::asin;
+   const Real points[] = { Real(-6), Real(-2.5), Real(-1), Real(-0.125), Real(0), Real(0.5), Real(1.75), Real(4) };
+   for (Real h : points)
+   {
+      for (Real k : points)
+      {
+         // Independent variables:
+         CHECK_ULP_CLOSE(Real(normal_cdf(h) * normal_cdf(k)), bivariate_normal_cdf(h, k, Real(0)), 20);
+         for (Real rho : { Real(-0.875), Real(-0.25), Real(0.5), Real(0.9375) })
+         {
+            CHECK_EQUAL(bivariate_normal_cdf(h, k, rho), bivariate_normal_cdf(k, h, rho));
+         }
+         // Perfectly correlated variables:
+         CHECK_ULP_CLOSE(normal_cdf((std::min)(h, k)), bivariate_normal_cdf(h, k, Real(1)), 20);
+      }
+   }
+   for (Real rho : { Real(-0.9375), Real(-0.5), Real(0.125), Real(0.75) })
+   {
+      CHECK_ULP_CLOSE(Real(0.25f + asin(rho) / (2 * boost::math::constants::pi<Real>())), bivariate_normal_cdf(Real(0), Real(0), rho), 2);
+   }
+   CHECK_EQUAL(bivariate_normal_cdf(Real(1), Real(-1), Real(-1)), Real(0));
+   CHECK_EQUAL(bivariate_normal_cdf(-std::numeric_limits<Real>::infinity(), Real(1), Real(0.5)), Real(0));
+   CHECK_ULP_CLOSE(normal_cdf(Real(1)), bivariate_normal_cdf(std::numeric_limits<Real>::infinity(), Real(1), Real(0.5)), 1);
+}
+
+// Compared with the integral, and with the same function at higher precision.  The
+// error is absolute: the terms of Owen's formula cancel in the lower tail.
+void test_bivariate_values()
+{
+   const double points[] = { -7.5, -3, -1.25, -0.5, 0, 0.25, 1, 2.5, 6 };
+   for (double rho : { -0.99, -0.6, -0.1, 0.3, 0.8, 0.995 })
+   {
+      for (double h : points)
+      {
+         for (double k : points)
+         {
+            double p = bivariate_normal_cdf(h, k, rho);
+            CHECK_ABSOLUTE_ERROR(static_cast<double>(bivariate_normal_cdf(cpp_bin_float_50(h), cpp_bin_float_50(k), cpp_bin_float_50(rho))), p, 2 * std::numeric_limits<double>::epsilon());
+            CHECK_ABSOLUTE_ERROR(bivariate_normal_integral(h, k, rho), p, 1e-14);
+            if ((h >= -1.25) && (k >= -1.25) && (rho >= 0))
+            {
+               CHECK_ULP_CLOSE(static_cast<double>(bivariate_normal_cdf(cpp_bin_float_50(h), cpp_bin_float_50(k), cpp_bin_float_50(rho))), p, 10);
+            }
+         }
+      }
+   }
+}
+
+// The array overload, at a single correlation, gives exactly the values of the scalar function:
+template <class Real>
+void test_bivariate_array()
+{
+   std::vector<Real> h, k;
+   for (Real x = -5; x <= 5; x += Real(0.625))
+   {
+      for (Real y = -5; y <= 5; y += Real(0.3125))
+      {
+         h.push_back(x);
+         k.push_back(y);
+      }
+   }
+   std::vector<Real> values(h.size());
+   for (Real rho : { Real(-1), Real(-0.75), Real(0), Real(0.125), Real(0.96875), Real(1) })
+   {
+      bivariate_normal_cdf(h.data(), k.data(), rho, h.size(), values.data());
+      for (std::size_t i = 0; i < h.size(); ++i)
+      {
+         CHECK_EQUAL(values[i], bivariate_normal_cdf(h[i], k[i], rho));
+      }
+   }
+}
+
+void test_errors()
+{
+   bool thrown = false;
+   try
+   {
+      bivariate_normal_cdf(0.5, 1.0, 1.5);
+   }
+   catch (const std::domain_error&)
+   {
+      thrown = true;
+   }
+   CHECK_EQUAL(thrown, true);
+   thrown = false;
+   try
+   {
+      bivariate_normal_cdf(std::numeric_limits<double>::quiet_NaN(), 1.0, 0.5);
+   }
+   catch (const std::domain_error&)
+   {
+      thrown = true;
+   }
+   CHECK_EQUAL(thrown, true);
+}
+
+int main()
+{
+   test_owens_t_array<float>();
+   test_owens_t_array<double>();
+   test_owens_t_array<long double>();
+   test_bivariate_identities<float>();
+   test_bivariate_identities<double>();
+   test_bivariate_identities<long double>();
+   test_bivariate_values();
+   test_bivariate_array<float>();
+   test_bivariate_array<double>();
+   test_bivariate_array<long double>();
+   test_errors();
+   return boost::math::test::report_errors();
+}
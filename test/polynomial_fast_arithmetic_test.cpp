@@ -0,0 +1,327 @@
+/*
+ * Copyright agent, 2026
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "math_unit_test.hpp"
+#include <cstdint>
+#include <limits>
+#include <ostream>
+#include <random>
+#include <vector>
+#include <boost/math/tools/polynomial.hpp>
+#include <boost/multiprecision/cpp_int.hpp>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+
+using boost::math::tools::polynomial;
+using boost::math::tools::quotient_remainder;
+using boost::math::tools::fft_multiply;
+using boost::math::tools::newton_divide;
+using boost::multiprecision::cpp_int;
+using boost::multiprecision::cpp_bin_float_50;
+
+// The integers modulo a prime: an exact field which keeps the coefficients small.
+class mod_p
+{
+public:
+    static const std::int64_t p = 10007;
+
+    mod_p() : m_v(0) {}
+    mod_p(int v) : m_v(((v % p) + p) % p) {}
+
+    mod_p operator-() const { return mod_p(static_cast<int>(p - m_v)); }
+    mod_p& operator+=(mod_p const & x) { m_v = (m_v + x.m_v) % p; return *this; }
+    mod_p& operator-=(mod_p const & x) { m_v = (m_v + p - x.m_v) % p; return *this; }
+    mod_p& operator*=(mod_p const & x) { m_v = (m_v * x.m_v) % p; return *this; }
+    mod_p& operator/=(mod_p const & x) { return *this *= x.inverse(); }
+
+    mod_p inverse() const
+    {
+        std::int64_t r = 1, b = m_v, e = p - 2;
+        while (e)
+        {
+            if (e & 1)
+                r = r * b % p;
+            b = b * b % p;
+            e >>= 1;
+        }
+        mod_p x;
+        x.m_v = r;
+        return x;
+    }
+
+    friend mod_p operator+(mod_p a, mod_p const & b) { return a += b; }
+    friend mod_p operator-(mod_p a, mod_p const & b) { return a -= b; }
+    friend mod_p operator*(mod_p a, mod_p const & b) { return a *= b; }
+    friend mod_p operator/(mod_p a, mod_p const & b) { return a /= b; }
+    friend bool operator==(mod_p const & a, mod_p const & b) { return a.m_v == b.m_v; }
+    friend bool operator!=(mod_p const & a, mod_p const & b) { return a.m_v != b.m_v; }
+    friend std::ostream& operator<<(std::ostream& os, mod_p const & a) { return os << a.m_v; }
+
+private:
+    std::int64_t m_v;
+};
+
+namespace std
+{
+template<>
+class numeric_limits<mod_p> : public numeric_limits<int>
+{
+public:
+    static const bool is_specialized = true;
+    static const bool is_integer = false;
+    static const bool is_exact = true;
+    static const bool is_bounded = true;
+};
+}
+
+template<class T>
+std::vector<T> schoolbook(std::vector<T> const & a, std::vector<T> const & b)
+{
+    std::vector<T> c(a.size() + b.size() - 1, T(0));
+    for (std::size_t i = 0; i < a.size(); ++i)
+        for (std::size_t j = 0; j < b.size(); ++j)
+            c[i + j] += a[i] * b[j];
+    return c;
+}
+
+template<class T>
+std::vector<T> random_coefficients(std::size_t n, std::mt19937& gen, int range)
+{
+    std::uniform_int_distribution<int> dis(-range, range);
+    std::vector<T> c(n);
+    for (auto & x : c)
+    {
+        x = T(dis(gen));
+    }
+    // Keep the degree exact:
+    if (c.back() == T(0))
+    {
+        c.back() = T(1);
+    }
+    return c;
+}
+
+// Exact coefficient types must give exactly the schoolbook product whichever method is chosen:
+template<class T>
+void test_exact_multiplication(int range)
+{
+    std::mt19937 gen(314159);
+    std::vector<std::pair<std::size_t, std::size_t>> sizes{{1, 1}, {5, 40}, {31, 33}, {64, 64}, {100, 37}, {129, 400}, {513, 600}, {1000, 1000}};
+    for (auto const & s : sizes)
+    {
+        auto a = random_coefficients<T>(s.first, gen, range);
+        auto b = random_coefficients<T>(s.second, gen, range);
+        polynomial<T> pa(a.begin(), a.end()), pb(b.begin(), b.end());
+        polynomial<T> c = pa * pb;
+        auto expected = schoolbook(a, b);
+        CHECK_EQUAL(c.size(), expected.size());
+        for (std::size_t i = 0; i < expected.size(); ++i)
+        {
+            if (!CHECK_EQUAL(c[i], expected[i]))
+            {
+                break;
+            }
+        }
+    }
+}
+
+// Unsigned products wrap around modulo 2^64 exactly as they do in the schoolbook method:
+void test_unsigned_wraparound()
+{
+    std::mt19937_64 gen(2718);
+    std::vector<std::uint64_t> a(300), b(300);
+    for (auto & x : a)
+        x = gen();
+    for (auto & x : b)
+        x = gen() >> 40;
+    polynomial<std::uint64_t> pa(a.begin(), a.end()), pb(b.begin(), b.end());
+    polynomial<std::uint64_t> c = pa * pb;
+    auto expected = schoolbook(a, b);
+    CHECK_EQUAL(c.size(), expected.size());
+    for (std::size_t i = 0; i < expected.size(); ++i)
+    {
+        if (!CHECK_EQUAL(c[i], expected[i]))
+        {
+            break;
+        }
+    }
+}
+
+// operator* is the schoolbook product; fft_multiply is only accurate relative to the largest coefficients:
+template<class Real>
+void test_floating_multiplication()
+{
+    std::mt19937 gen(1618);
+    std::uniform_real_distribution<double> dis(-1, 1);
+    for (std::size_t n : {10, 50, 300, 2000})
+    {
+        std::vector<Real> a(n), b(n + 17);
+        for (auto & x : a)
+            x = dis(gen);
+        for (auto & x : b)
+            x = dis(gen);
+        polynomial<Real> pa(a.begin(), a.end()), pb(b.begin(), b.end());
+        polynomial<Real> c = pa * pb;
+        auto expected = schoolbook(a, b);
+        CHECK_EQUAL(c.size(), expected.size());
+        for (std::size_t i = 0; i < expected.size(); ++i)
+        {
+            if (!CHECK_EQUAL(expected[i], c[i]))
+            {
+                break;
+            }
+        }
+        polynomial<Real> f = fft_multiply(pa, pb);
+        CHECK_EQUAL(f.size(), expected.size());
+        using std::sqrt;
+        Real tol = 64*std::numeric_limits<Real>::epsilon()*sqrt(Real(n));
+        for (std::size_t i = 0; i < expected.size(); ++i)
+        {
+            if (!CHECK_ABSOLUTE_ERROR(expected[i], f[i], tol))
+            {
+                break;
+            }
+        }
+    }
+}
+
+// Coefficients spanning many orders of magnitude keep their relative accuracy under operator*:
+template<class Real>
+void test_graded_multiplication()
+{
+    using std::ldexp;
+    std::size_t n = 400;
+    std::vector<Real> a(n), b(n);
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        a[i] = ldexp(Real(1) + Real(i % 7)/8, -static_cast<int>(i/4));
+        b[i] = ldexp(Real(1) + Real(i % 5)/8, -static_cast<int>(i/4));
+    }
+    polynomial<Real> pa(a.begin(), a.end()), pb(b.begin(), b.end());
+    polynomial<Real> c = pa * pb;
+    auto expected = schoolbook(a, b);
+    for (std::size_t i = 0; i < expected.size(); ++i)
+    {
+        if (!CHECK_ULP_CLOSE(expected[i], c[i], 0))
+        {
+            break;
+        }
+    }
+}
+
+// The quotient and remainder are unique, so checking u = qv + r with deg r < deg v is enough:
+template<class T>
+void test_exact_division()
+{
+    std::mt19937 gen(5772);
+    std::vector<std::pair<std::size_t, std::size_t>> sizes{{10, 3}, {200, 100}, {500, 70}, {700, 300}, {1000, 999}};
+    for (auto const & s : sizes)
+    {
+        auto u = random_coefficients<T>(s.first, gen, 1000);
+        auto v = random_coefficients<T>(s.second, gen, 1000);
+        polynomial<T> pu(u.begin(), u.end()), pv(v.begin(), v.end());
+        auto qr = quotient_remainder(pu, pv);
+        CHECK_LE(qr.second.size(), pv.size() - 1);
+        CHECK_EQUAL(qr.first.size(), pu.size() - pv.size() + 1);
+        polynomial<T> w = qr.first * pv + qr.second;
+        CHECK_EQUAL(w == pu, true);
+        auto nqr = newton_divide(pu, pv);
+        CHECK_EQUAL(nqr.first == qr.first, true);
+        CHECK_EQUAL(nqr.second == qr.second, true);
+    }
+}
+
+template<class Real>
+void test_floating_division()
+{
+    std::mt19937 gen(4669);
+    std::uniform_real_distribution<Real> dis(-1, 1);
+    // A divisor which is well conditioned for division: dominant leading coefficient.
+    std::vector<Real> v(150);
+    for (auto & x : v)
+        x = dis(gen)/8;
+    v.back() = 4;
+    std::vector<Real> q(400);
+    for (auto & x : q)
+        x = dis(gen);
+    std::vector<Real> r(149);
+    for (auto & x : r)
+        x = dis(gen);
+    polynomial<Real> pv(v.begin(), v.end()), pq(q.begin(), q.end()), pr(r.begin(), r.end());
+    polynomial<Real> u = pq * pv + pr;
+    Real tol = 2048*std::numeric_limits<Real>::epsilon();
+    for (auto const & qr : {quotient_remainder(u, pv), newton_divide(u, pv)})
+    {
+        CHECK_EQUAL(qr.first.size(), pq.size());
+        for (std::size_t i = 0; i < pq.size(); ++i)
+        {
+            CHECK_ABSOLUTE_ERROR(pq[i], qr.first[i], tol);
+        }
+        for (std::size_t i = 0; i < pr.size(); ++i)
+        {
+            CHECK_ABSOLUTE_ERROR(pr[i], qr.second[i], tol);
+        }
+    }
+    // operator/ is long division:
+    polynomial<Real> w(u);
+    std::vector<Real> quotient(u.size() - pv.size() + 1);
+    for (std::size_t k = quotient.size(); k-- > 0;)
+    {
+        quotient[k] = w[k + pv.size() - 1]/pv[pv.size() - 1];
+        for (std::size_t j = 0; j < pv.size(); ++j)
+        {
+            w[k + j] -= quotient[k]*pv[j];
+        }
+    }
+    CHECK_EQUAL(true, polynomial<Real>(quotient.begin(), quotient.end()) == u / pv);
+}
+
+void test_half_gcd()
+{
+    std::mt19937 gen(1414);
+    for (std::size_t g_size : {5, 80, 300})
+    {
+        auto g = random_coefficients<mod_p>(g_size, gen, 5000);
+        auto a = random_coefficients<mod_p>(400, gen, 5000);
+        auto b = random_coefficients<mod_p>(350, gen, 5000);
+        polynomial<mod_p> pg(g.begin(), g.end()), pa(a.begin(), a.end()), pb(b.begin(), b.end());
+        polynomial<mod_p> u = pg * pa;
+        polynomial<mod_p> v = pg * pb;
+        polynomial<mod_p> fast = boost::math::tools::gcd(u, v);
+        polynomial<mod_p> classical = boost::integer::gcd_detail::Euclid_gcd(u, v);
+        // Same remainder sequence, so exactly the same result:
+        CHECK_EQUAL(fast == classical, true);
+        CHECK_EQUAL(fast.size() >= pg.size(), true);
+        CHECK_EQUAL(!(fast % pg), true);
+        // And in the other order:
+        polynomial<mod_p> swapped = boost::math::tools::gcd(v, u);
+        CHECK_EQUAL(swapped == boost::integer::gcd_detail::Euclid_gcd(v, u), true);
+    }
+}
+
+int main()
+{
+    test_exact_multiplication<int>(100);
+    test_exact_multiplication<long long>(1000000);
+    test_exact_multiplication<std::int64_t>(1 << 24);
+    test_exact_multiplication<cpp_int>(1000000);
+    test_exact_multiplication<mod_p>(5000);
+    test_unsigned_wraparound();
+
+    test_floating_multiplication<float>();
+    test_floating_multiplication<double>();
+    test_floating_multiplication<long double>();
+    test_floating_multiplication<cpp_bin_float_50>();
+    test_graded_multiplication<float>();
+    test_graded_multiplication<double>();
+
+    test_exact_division<mod_p>();
+    test_floating_division<double>();
+    test_floating_division<long double>();
+
+    test_half_gcd();
+    return boost::math::test::report_errors();
+}
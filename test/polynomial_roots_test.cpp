@@ -0,0 +1,249 @@
+/*
+ * Copyright agent, 2026
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "math_unit_test.hpp"
+#include <complex>
+#include <random>
+#include <vector>
+#include <boost/math/tools/polynomial_roots.hpp>
+#include <boost/math/constants/constants.hpp>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+#if !defined(BOOST_NO_CXX17_HDR_EXECUTION) && !defined(BOOST_NO_CXX17_IF_CONSTEXPR)
+#include <execution>
+#endif
+
+using boost::math::tools::polynomial;
+using boost::math::tools::polynomial_roots;
+using boost::math::constants::two_pi;
+using boost::multiprecision::cpp_bin_float_50;
+
+template<class Real>
+polynomial<Real> from_roots(std::vector<Real> const & real_roots, std::vector<std::complex<Real>> const & complex_pairs)
+{
+    polynomial<Real> p{Real(1)};
+    for (auto r : real_roots)
+    {
+        p *= polynomial<Real>{-r, Real(1)};
+    }
+    for (auto z : complex_pairs)
+    {
+        // (x - z)(x - conj(z)) = x^2 - 2Re(z) x + |z|^2
+        p *= polynomial<Real>{std::norm(z), -2*z.real(), Real(1)};
+    }
+    return p;
+}
+
+template<class Real>
+void test_known_roots()
+{
+    std::vector<Real> real_roots{Real(-3), Real(-1)/2, Real(1)/4, Real(2), Real(5)};
+    std::vector<std::complex<Real>> pairs{{Real(1), Real(1)}, {Real(-2), Real(1)/2}, {Real(0), Real(3)}};
+    auto p = from_roots(real_roots, pairs);
+    auto roots = polynomial_roots(p);
+    CHECK_EQUAL(roots.size(), std::size_t(11));
+
+    std::vector<std::complex<Real>> expected;
+    for (auto r : real_roots)
+    {
+        expected.emplace_back(r, Real(0));
+    }
+    for (auto z : pairs)
+    {
+        expected.push_back(z);
+        expected.push_back(std::conj(z));
+    }
+    // Roots with equal real parts may come out in either order, so match each to its nearest neighbour:
+    Real tol = 64*std::numeric_limits<Real>::epsilon();
+    for (auto e : expected)
+    {
+        Real dist = std::numeric_limits<Real>::max();
+        for (auto z : roots)
+        {
+            using std::abs;
+            Real d = abs(e - z);
+            if (d < dist)
+            {
+                dist = d;
+            }
+        }
+        CHECK_LE(dist, tol);
+    }
+    // The real roots are polished with a real iteration, so come out exactly real:
+    for (auto r : real_roots)
+    {
+        bool found = false;
+        for (auto z : roots)
+        {
+            if (z.imag() == 0 && abs(z.real() - r) <= tol)
+            {
+                found = true;
+            }
+        }
+        CHECK_EQUAL(found, true);
+    }
+}
+
+template<class Real>
+void test_roots_of_unity(std::size_t n)
+{
+    std::vector<Real> c(n + 1, Real(0));
+    c[0] = -1;
+    c[n] = 1;
+    polynomial<Real> p(std::move(c));
+    auto roots = polynomial_roots(p);
+    CHECK_EQUAL(roots.size(), n);
+    // Every root of unity must be found exactly once:
+    std::vector<int> hits(n, 0);
+    Real tol = 64*std::numeric_limits<Real>::epsilon();
+    for (auto z : roots)
+    {
+        using std::atan2;
+        using std::round;
+        Real k = atan2(z.imag(), z.real())*static_cast<Real>(n)/two_pi<Real>();
+        long j = static_cast<long>(round(k));
+        j = ((j % long(n)) + long(n)) % long(n);
+        hits[j] += 1;
+        Real theta = two_pi<Real>()*static_cast<Real>(j)/static_cast<Real>(n);
+        using std::cos;
+        using std::sin;
+        CHECK_ABSOLUTE_ERROR(cos(theta), z.real(), tol);
+        CHECK_ABSOLUTE_ERROR(sin(theta), z.imag(), tol);
+    }
+    for (std::size_t j = 0; j < n; ++j)
+    {
+        CHECK_EQUAL(hits[j], 1);
+    }
+}
+
+template<class Real>
+void test_zero_roots()
+{
+    // x^3 (x - 2)(x + 1):
+    polynomial<Real> p{Real(0), Real(0), Real(0), Real(-2), Real(-1), Real(1)};
+    auto roots = polynomial_roots(p);
+    CHECK_EQUAL(roots.size(), std::size_t(5));
+    CHECK_ULP_CLOSE(Real(-1), roots[0].real(), 4);
+    for (std::size_t i = 1; i < 4; ++i)
+    {
+        CHECK_EQUAL(roots[i].real(), Real(0));
+        CHECK_EQUAL(roots[i].imag(), Real(0));
+    }
+    CHECK_ULP_CLOSE(Real(2), roots[4].real(), 4);
+
+    polynomial<Real> linear{Real(3), Real(2)};
+    roots = polynomial_roots(linear);
+    CHECK_EQUAL(roots.size(), std::size_t(1));
+    CHECK_ULP_CLOSE(Real(-3)/Real(2), roots[0].real(), 1);
+
+    polynomial<Real> constant{Real(7)};
+    CHECK_EQUAL(polynomial_roots(constant).size(), std::size_t(0));
+
+    bool thrown = false;
+    try
+    {
+        polynomial_roots(polynomial<Real>());
+    }
+    catch (std::domain_error const &)
+    {
+        thrown = true;
+    }
+    CHECK_EQUAL(thrown, true);
+}
+
+void test_integer_coefficients()
+{
+    // (x - 1)(x - 2)(x - 3) = x^3 - 6x^2 + 11x - 6
+    polynomial<int> p{-6, 11, -6, 1};
+    auto roots = polynomial_roots(p);
+    CHECK_EQUAL(roots.size(), std::size_t(3));
+    for (std::size_t i = 0; i < 3; ++i)
+    {
+        CHECK_ULP_CLOSE(double(i + 1), roots[i].real(), 4);
+        CHECK_EQUAL(roots[i].imag(), 0.0);
+    }
+}
+
+template<class Real>
+void test_multiple_root()
+{
+    // (x - 1)^3 (x + 2): the triple root is only determined to about eps^(1/3).
+    auto p = from_roots<Real>({Real(1), Real(1), Real(1), Real(-2)}, {});
+    auto roots = polynomial_roots(p);
+    CHECK_EQUAL(roots.size(), std::size_t(4));
+    using std::cbrt;
+    Real tol = 16*cbrt(std::numeric_limits<Real>::epsilon());
+    CHECK_ABSOLUTE_ERROR(Real(-2), roots[0].real(), tol);
+    for (std::size_t i = 1; i < 4; ++i)
+    {
+        CHECK_ABSOLUTE_ERROR(Real(1), roots[i].real(), tol);
+        CHECK_ABSOLUTE_ERROR(Real(0), roots[i].imag(), tol);
+    }
+}
+
+#if !defined(BOOST_NO_CXX17_HDR_EXECUTION) && !defined(BOOST_NO_CXX17_IF_CONSTEXPR)
+void test_parallel()
+{
+    // A degree 500 polynomial with random coefficients:
+    std::mt19937 gen(12345);
+    std::uniform_real_distribution<double> dis(-1, 1);
+    std::vector<double> c(501);
+    for (auto & x : c)
+    {
+        x = dis(gen);
+    }
+    polynomial<double> p(std::move(c));
+    auto serial = polynomial_roots(p);
+    auto parallel = polynomial_roots(std::execution::par, p);
+    CHECK_EQUAL(serial.size(), std::size_t(500));
+    CHECK_EQUAL(parallel.size(), std::size_t(500));
+    for (std::size_t i = 0; i < serial.size(); ++i)
+    {
+        CHECK_EQUAL(serial[i].real(), parallel[i].real());
+        CHECK_EQUAL(serial[i].imag(), parallel[i].imag());
+    }
+    // Each computed root should be a root to within the backward error of Horner's rule:
+    for (auto z : serial)
+    {
+        std::complex<double> v = 0;
+        double bound = 0;
+        for (std::size_t k = p.size(); k-- > 0;)
+        {
+            v = v*z + p[k];
+            bound = bound*std::abs(z) + (4*k + 1)*std::abs(p[k]);
+        }
+        CHECK_LE(std::abs(v), 4*std::numeric_limits<double>::epsilon()*bound);
+    }
+}
+#endif
+
+int main()
+{
+    test_known_roots<float>();
+    test_known_roots<double>();
+    test_known_roots<long double>();
+    test_known_roots<cpp_bin_float_50>();
+
+    test_roots_of_unity<double>(7);
+    test_roots_of_unity<double>(64);
+    test_roots_of_unity<double>(500);
+    test_roots_of_unity<long double>(101);
+    test_roots_of_unity<cpp_bin_float_50>(40);
+
+    test_zero_roots<float>();
+    test_zero_roots<double>();
+    test_zero_roots<cpp_bin_float_50>();
+
+    test_integer_coefficients();
+
+    test_multiple_root<double>();
+    test_multiple_root<long double>();
+
+#if !defined(BOOST_NO_CXX17_HDR_EXECUTION) && !defined(BOOST_NO_CXX17_IF_CONSTEXPR)
+    test_parallel();
+#endif
+    return boost::math::test::report_errors();
+}
@@ -0,0 +1,165 @@
+//  Copyright agent 2026
+//  Use, modification and distribution are subject to the
+//  Boost Software License, Version 1.0. (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+
+#include "math_unit_test.hpp"
+#include <cstdint>
+#include <iterator>
+#include <vector>
+#include <boost/math/special_functions/prime_sieve.hpp>
+#if !defined(BOOST_NO_CXX17_HDR_EXECUTION) && !defined(BOOST_NO_CXX17_IF_CONSTEXPR)
+#include <execution>
+#endif
+
+using boost::math::is_prime;
+using boost::math::prime_count;
+using boost::math::prime_range;
+using boost::math::prime_sieve;
+
+// The primes below n by the plain sieve of Eratosthenes:
+std::vector<std::uint32_t> simple_sieve(std::uint32_t n)
+{
+   std::vector<char> composite(n, 0);
+   std::vector<std::uint32_t> primes;
+   for (std::uint32_t i = 2; i < n; ++i)
+   {
+      if (!composite[i])
+      {
+         primes.push_back(i);
+         for (std::uint64_t j = std::uint64_t(i) * i; j < n; j += i)
+         {
+            composite[j] = 1;
+         }
+      }
+   }
+   return primes;
+}
+
+void test_small()
+{
+   const std::uint32_t n = 2000000;
+   std::vector<std::uint32_t> expected = simple_sieve(n);
+   std::vector<std::uint32_t> primes;
+   prime_range(std::uint32_t(0), n, std::back_inserter(primes));
+   CHECK_EQUAL(primes.size(), expected.size());
+   CHECK_EQUAL(primes == expected, true);
+   // Agrees with the table:
+   for (unsigned i = 0; i <= boost::math::max_prime; ++i)
+   {
+      CHECK_EQUAL(primes[i], boost::math::prime(i));
+   }
+   std::size_t k = 0;
+   for (std::uint32_t i = 0; i < n; ++i)
+   {
+      bool p = (k < expected.size()) && (expected[k] == i);
+      CHECK_EQUAL(is_prime(i), p);
+      if (p)
+      {
+         ++k;
+      }
+   }
+   // Sub-ranges starting and ending on and between primes, segments and the table:
+   for (std::uint32_t lower : { 0u, 1u, 2u, 3u, 4u, 13u, 14u, 1000u, 65535u, 65536u, 65537u, 104729u, 131071u })
+   {
+      for (std::uint32_t upper : { 0u, 2u, 3u, 5u, 14u, 65538u, 104730u, 200001u, 1999993u })
+      {
+         std::vector<std::uint32_t> r;
+         for (std::uint32_t p : expected)
+         {
+            if ((p >= lower) && (p < upper))
+            {
+               r.push_back(p);
+            }
+         }
+         std::vector<std::uint32_t> values;
+         prime_range(lower, upper, std::back_inserter(values));
+         CHECK_EQUAL(values == r, true);
+         values.clear();
+         for (std::uint32_t p : prime_sieve<std::uint32_t>(lower, upper))
+         {
+            values.push_back(p);
+         }
+         CHECK_EQUAL(values == r, true);
+      }
+   }
+   // Negative values are no different from zero:
+   CHECK_EQUAL(is_prime(-7), false);
+   std::vector<int> values;
+   prime_range(-20, 12, std::back_inserter(values));
+   CHECK_EQUAL(values.size(), std::size_t(5));
+   CHECK_EQUAL(prime_count(-3), 0);
+}
+
+// Far beyond the table: the sieve agrees with testing each number:
+void test_large()
+{
+   for (std::uint64_t lower : { 4294967291uLL - 100000, 1000000000000uLL, 1000000000000000000uLL, 18446744073709551615uLL - 200000 })
+   {
+      const std::uint64_t upper = lower + 200000;
+      std::vector<std::uint64_t> primes;
+      prime_range(lower, upper, std::back_inserter(primes));
+      std::size_t k = 0;
+      bool same = true;
+      for (std::uint64_t x = lower; x < upper; ++x)
+      {
+         if (is_prime(x))
+         {
+            same = same && (k < primes.size()) && (primes[k] == x);
+            ++k;
+         }
+      }
+      CHECK_EQUAL(same, true);
+      CHECK_EQUAL(k, primes.size());
+   }
+   // The largest primes of 32 and 64 bits:
+   CHECK_EQUAL(is_prime(4294967291uLL), true);
+   CHECK_EQUAL(is_prime(18446744073709551557uLL), true);
+   CHECK_EQUAL(is_prime(18446744073709551559uLL), false);
+   // The smallest strong pseudoprimes to the first 1, 2, ..., 9 prime bases:
+   for (std::uint64_t n : { 2047uLL, 1373653uLL, 25326001uLL, 3215031751uLL, 2152302898747uLL, 3474749660383uLL, 341550071728321uLL, 3825123056546413051uLL })
+   {
+      CHECK_EQUAL(is_prime(n), false);
+   }
+   // A Carmichael number, and the square of a prime:
+   CHECK_EQUAL(is_prime(561), false);
+   CHECK_EQUAL(is_prime(4294967291uLL * 4294967291uLL), false);
+   std::vector<std::uint64_t> primes;
+   prime_range(18446744073709551557uLL, 18446744073709551615uLL, std::back_inserter(primes));
+   CHECK_EQUAL(primes.size(), std::size_t(1));
+}
+
+void test_count()
+{
+   CHECK_EQUAL(prime_count(0), 0);
+   CHECK_EQUAL(prime_count(2), 1);
+   CHECK_EQUAL(prime_count(104729), 10000);
+   CHECK_EQUAL(prime_count(1000000), 78498);
+   CHECK_EQUAL(prime_count(std::uint64_t(100000000)), std::uint64_t(5761455));
+   CHECK_EQUAL(prime_count(std::uint64_t(1000000007)), std::uint64_t(50847535));
+}
+
+#if !defined(BOOST_NO_CXX17_HDR_EXECUTION) && !defined(BOOST_NO_CXX17_IF_CONSTEXPR)
+void test_execution_policy()
+{
+   std::vector<std::uint64_t> expected, primes;
+   const std::uint64_t lower = 999999000000uLL;
+   const std::uint64_t upper = 1000000000000uLL;
+   prime_range(lower, upper, std::back_inserter(expected));
+   prime_range(std::execution::par, lower, upper, std::back_inserter(primes));
+   CHECK_EQUAL(primes == expected, true);
+   CHECK_EQUAL(prime_count(std::execution::par, std::uint64_t(100000000)), std::uint64_t(5761455));
+   CHECK_EQUAL(prime_count(std::execution::par, 104729), 10000);
+}
+#endif
+
+int main()
+{
+   test_small();
+   test_large();
+   test_count();
+#if !defined(BOOST_NO_CXX17_HDR_EXECUTION) && !defined(BOOST_NO_CXX17_IF_CONSTEXPR)
+   test_execution_policy();
+#endif
+   return boost::math::test::report_errors();
+}
@@ -0,0 +1,187 @@
+/*
+ * Copyright agent, 2026
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "math_unit_test.hpp"
+#include <cmath>
+#include <complex>
+#include <vector>
+#include <boost/math/special_functions/spherical_harmonic_table.hpp>
+#include <boost/math/special_functions/spherical_harmonic.hpp>
+#include <boost/math/constants/constants.hpp>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+#if !defined(BOOST_NO_CXX17_HDR_EXECUTION) && !defined(BOOST_NO_CXX17_IF_CONSTEXPR)
+#include <execution>
+#endif
+
+using boost::math::sph_legendre_table;
+using boost::math::sph_legendre_table_index;
+using boost::math::sph_legendre_table_size;
+using boost::math::spherical_harmonic_table;
+using boost::multiprecision::cpp_bin_float_50;
+
+//
+// The functions oscillate with an amplitude of about sqrt((2l+1)/(4 pi)), and errors are measured relative to that;
+// exactly as for the scalar functions there is no relative accuracy close to a zero.
+//
+template<class Real>
+void test_against_scalar(unsigned lmax, Real tol)
+{
+    using std::abs;
+    using std::sqrt;
+    Real pi = boost::math::constants::pi<Real>();
+    std::vector<Real> table(sph_legendre_table_size(lmax));
+    for (Real theta : {Real(0), Real(1)/64, Real(1)/2, pi/3, Real(3)/2, pi/2, Real(3), pi, Real(4), Real(-2), Real(7)})
+    {
+        sph_legendre_table(lmax, theta, table.begin());
+        for (unsigned l = 0; l <= lmax; ++l)
+        {
+            Real amplitude = sqrt((2*l + 1)/(4*pi));
+            for (unsigned m = 0; m <= l; ++m)
+            {
+                Real expected = boost::math::spherical_harmonic_r(l, int(m), theta, Real(0));
+                Real computed = table[sph_legendre_table_index(l, m)];
+                if (!CHECK_LE(abs(expected - computed), tol*(abs(expected) + amplitude)))
+                {
+                    std::cerr << "  l = " << l << ", m = " << m << ", theta = " << theta << "\n";
+                }
+            }
+        }
+    }
+}
+
+template<class Real>
+void test_complex()
+{
+    using std::abs;
+    unsigned lmax = 30;
+    Real tol = 64*std::numeric_limits<Real>::epsilon();
+    std::vector<std::complex<Real>> table(sph_legendre_table_size(lmax));
+    Real theta = Real(2)/3;
+    for (Real phi : {Real(0), Real(1)/3, Real(5)})
+    {
+        spherical_harmonic_table(lmax, theta, phi, table.begin());
+        for (unsigned l = 0; l <= lmax; ++l)
+        {
+            for (unsigned m = 0; m <= l; ++m)
+            {
+                std::complex<Real> expected = boost::math::spherical_harmonic(l, int(m), theta, phi);
+                std::complex<Real> computed = table[sph_legendre_table_index(l, m)];
+                CHECK_LE(abs(expected - computed), tol*(abs(expected) + 1));
+            }
+        }
+    }
+}
+
+//
+// At high degree the scalar functions overflow, so use the addition theorem instead:
+// Y_l^0(theta)^2 + 2 sum_{m > 0} Y_l^m(theta, 0)^2 = (2l+1)/(4 pi) for every theta.
+// Near the poles the diagonal underflows long before l = lmax, which exercises the scaling.
+//
+void test_addition_theorem()
+{
+    unsigned lmax = 2048;
+    double pi = boost::math::constants::pi<double>();
+    std::vector<double> table(sph_legendre_table_size(lmax));
+    for (double theta : {1e-300, 1e-5, 0.01, 0.3, pi/2, 2.0, pi - 0.001, pi})
+    {
+        sph_legendre_table(lmax, theta, table.begin());
+        for (unsigned l = 0; l <= lmax; l += 7)
+        {
+            double sum = 0;
+            for (unsigned m = l; m > 0; --m)
+            {
+                double p = table[sph_legendre_table_index(l, m)];
+                CHECK_EQUAL((boost::math::isfinite)(p), true);
+                sum += 2*p*p;
+            }
+            double p0 = table[sph_legendre_table_index(l, 0)];
+            sum += p0*p0;
+            CHECK_ULP_CLOSE((2*l + 1)/(4*pi), sum, 2*l + 8);
+        }
+    }
+}
+
+// All the angles at once must give exactly the values of one angle at a time, computed in the same precision:
+void test_many_angles()
+{
+    using namespace boost::math::policies;
+    typedef policy<promote_double<false>> no_promotion;
+    unsigned lmax = 200;
+    std::size_t points = 37;
+    std::vector<double> theta(points);
+    for (std::size_t i = 0; i < points; ++i)
+    {
+        // Include the poles and some angles very close to them:
+        theta[i] = i == 0 ? 0.0 : (i == 1 ? 1e-200 : boost::math::constants::pi<double>()*double(i)/double(points - 1));
+    }
+    std::vector<double> all(sph_legendre_table_size(lmax)*points), one(sph_legendre_table_size(lmax));
+    sph_legendre_table(lmax, theta.data(), points, all.data());
+    for (std::size_t i = 0; i < points; ++i)
+    {
+        sph_legendre_table(lmax, theta[i], one.begin(), no_promotion());
+        for (std::size_t k = 0; k < one.size(); ++k)
+        {
+            if (!CHECK_EQUAL(one[k], all[k*points + i]))
+            {
+                break;
+            }
+        }
+    }
+#if !defined(BOOST_NO_CXX17_HDR_EXECUTION) && !defined(BOOST_NO_CXX17_IF_CONSTEXPR)
+    std::vector<double> parallel(all.size());
+    sph_legendre_table(std::execution::par, lmax, theta.data(), points, parallel.data());
+    for (std::size_t k = 0; k < all.size(); ++k)
+    {
+        if (!CHECK_EQUAL(all[k], parallel[k]))
+        {
+            break;
+        }
+    }
+#endif
+    // float is computed in double internally:
+    std::vector<float> ftheta(theta.begin(), theta.end());
+    std::vector<float> fall(all.size());
+    sph_legendre_table(lmax, ftheta.data(), points, fall.data());
+    CHECK_ULP_CLOSE(float(boost::math::spherical_harmonic_r(150, 20, ftheta[9], 0.0f)), fall[sph_legendre_table_index(150, 20)*points + 9], 4);
+}
+
+void test_domain()
+{
+    std::vector<double> table(sph_legendre_table_size(3));
+    bool thrown = false;
+    try
+    {
+        sph_legendre_table(3, std::numeric_limits<double>::quiet_NaN(), table.begin());
+    }
+    catch (std::domain_error const &)
+    {
+        thrown = true;
+    }
+    CHECK_EQUAL(thrown, true);
+    // No angles is not an error, and writes nothing:
+    std::vector<double> none;
+    sph_legendre_table(3, none.data(), 0, table.data());
+#if !defined(BOOST_NO_CXX17_HDR_EXECUTION) && !defined(BOOST_NO_CXX17_IF_CONSTEXPR)
+    sph_legendre_table(std::execution::par, 3, none.data(), 0, table.data());
+#endif
+}
+
+int main()
+{
+    test_against_scalar<float>(40, 32*std::numeric_limits<float>::epsilon());
+    test_against_scalar<double>(80, 64*std::numeric_limits<double>::epsilon());
+    test_against_scalar<long double>(80, 64*std::numeric_limits<long double>::epsilon());
+    test_against_scalar<cpp_bin_float_50>(30, 64*std::numeric_limits<cpp_bin_float_50>::epsilon());
+
+    test_complex<double>();
+    test_complex<long double>();
+
+    test_addition_theorem();
+    test_many_angles();
+    test_domain();
+    return boost::math::test::report_errors();
+}
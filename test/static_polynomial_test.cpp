@@ -0,0 +1,158 @@
+/*
+ * Copyright agent, 2026
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "math_unit_test.hpp"
+#include <complex>
+#include <random>
+#include <boost/math/tools/static_polynomial.hpp>
+#include <boost/math/tools/rational.hpp>
+#include <boost/multiprecision/cpp_bin_float.hpp>
+
+using boost::math::tools::static_polynomial;
+using boost::math::tools::static_rational;
+using boost::math::tools::make_static_polynomial;
+using boost::math::tools::make_static_rational;
+using boost::math::tools::evaluate_polynomial;
+using boost::math::tools::evaluate_rational;
+using boost::multiprecision::cpp_bin_float_50;
+
+// Everything must fold to a constant; exact in integer arithmetic:
+void test_constexpr()
+{
+    constexpr static_polynomial<int, 3> p{1, 2, 3};
+    constexpr auto q = make_static_polynomial(-1, 1);
+    static_assert(p(2) == 17, "evaluation");
+    static_assert(p.evaluate_reversed(2) == 3 + 2*2 + 1*4, "reversed evaluation");
+    constexpr auto pq = p*q;
+    static_assert(pq.size() == 4, "size of product");
+    static_assert(pq[0] == -1 && pq[1] == -1 && pq[2] == -1 && pq[3] == 3, "product");
+    static_assert(pq(3) == p(3)*q(3), "product evaluation");
+    constexpr auto s = p + q;
+    static_assert(s.size() == 3 && s[0] == 0 && s[1] == 3 && s[2] == 3, "sum");
+    constexpr auto d = p - q;
+    static_assert(d[0] == 2 && d[1] == 1 && d[2] == 3, "difference");
+    static_assert((-p)[2] == -3, "negation");
+    static_assert((2*p)[1] == 4 && (p*2)[2] == 6, "scalar product");
+    static_assert(p.derivative() == static_polynomial<int, 2>{2, 6}, "derivative");
+    static_assert(p.derivative().derivative().derivative() == static_polynomial<int, 1>{0}, "derivative of a constant");
+    static_assert(static_polynomial<int, 3>{4, 0, 1}.degree() == 2, "degree");
+
+    constexpr double a[] = {1.0, 0.5, 0.25};
+    constexpr static_polynomial<double, 3> from_array(a);
+    static_assert(from_array(2.0) == 3.0, "construction from an array");
+    constexpr auto I = static_polynomial<double, 3>{6, 4, 3}.integral();
+    static_assert(I[0] == 0 && I[1] == 6 && I[2] == 2 && I[3] == 1, "integral");
+    static_assert(I.derivative() == static_polynomial<double, 3>{6, 4, 3}, "fundamental theorem");
+
+    constexpr static_rational<double, 2, 2> r(static_polynomial<double, 2>{1, 1}, static_polynomial<double, 2>{2, 1});
+    static_assert(r(0.0) == 0.5, "rational evaluation");
+    static_assert(r(3.0) == 0.8, "reversed rational evaluation");
+    constexpr auto dr = r.derivative();
+    static_assert(dr(0.0) == 0.25, "rational derivative");
+    constexpr auto r2 = r*r + r/r - r;
+    static_assert(r2(0.0) == 0.25 + 1 - 0.5, "rational arithmetic");
+#ifdef __cpp_deduction_guides
+    constexpr static_polynomial deduced{1.0, 2.0, 3.0, 4.0};
+    static_assert(deduced.size() == 4, "deduction guide");
+#endif
+}
+
+// Each scheme must agree with the run time evaluate_polynomial to a few ulps:
+template<class Real, std::size_t N>
+void test_schemes()
+{
+    std::mt19937 gen(7);
+    std::uniform_real_distribution<double> dis(0, 1);
+    Real c[N];
+    for (auto & x : c)
+    {
+        x = dis(gen);
+    }
+    static_polynomial<Real, N> p(c);
+    using horner = boost::math::tools::detail::static_horner<N, 1>;
+    using second_order_horner = boost::math::tools::detail::static_second_order_horner<N, 1>;
+    using estrin = boost::math::tools::detail::static_estrin<N, 1>;
+    for (std::size_t i = 0; i < 20; ++i)
+    {
+        // Positive coefficients and argument, so every scheme is well conditioned:
+        Real x = Real(i)/8;
+        Real expected = evaluate_polynomial(c, x, N);
+        CHECK_ULP_CLOSE(expected, horner::evaluate(c, x), 2*N);
+        CHECK_ULP_CLOSE(expected, second_order_horner::evaluate(c, x), 2*N);
+        CHECK_ULP_CLOSE(expected, estrin::evaluate(c, x), 2*N);
+        CHECK_ULP_CLOSE(expected, p(x), 2*N);
+        // Reversed:
+        Real reversed[N];
+        for (std::size_t j = 0; j < N; ++j)
+        {
+            reversed[j] = c[N - 1 - j];
+        }
+        CHECK_ULP_CLOSE(evaluate_polynomial(reversed, x, N), p.evaluate_reversed(x), 2*N);
+    }
+}
+
+template<class Real>
+void test_rational()
+{
+    // The same rational as used in the evaluate_rational tests, with coefficients large enough
+    // that evaluation by the naive method would overflow for large x.
+    constexpr std::size_t N = 5;
+    Real num[N] = {Real(1), Real(2), Real(3), Real(4), Real(5)};
+    Real den[N] = {Real(2), Real(3), Real(5), Real(7), Real(11)};
+    static_rational<Real, N> r(num, den);
+    for (Real x : {Real(0), Real(1)/3, Real(1), Real(3)/2, Real(10), Real(1e20), std::numeric_limits<Real>::max()/4})
+    {
+        CHECK_ULP_CLOSE(evaluate_rational(num, den, x, N), r(x), 16);
+    }
+    // Unequal sizes go through P/Q directly:
+    static_rational<Real, 2, 3> s(static_polynomial<Real, 2>{1, 1}, static_polynomial<Real, 3>{1, 0, 1});
+    Real x = Real(7)/3;
+    CHECK_ULP_CLOSE((1 + x)/(1 + x*x), s(x), 2);
+    // d/dx (1 + x)/(1 + x^2) = (1 - 2x - x^2)/(1 + x^2)^2:
+    CHECK_ULP_CLOSE((1 - 2*x - x*x)/((1 + x*x)*(1 + x*x)), s.derivative()(x), 8);
+}
+
+void test_complex()
+{
+    constexpr static_polynomial<double, 4> p{1, -1, 2, 3};
+    std::complex<double> z(0.5, -0.25);
+    std::complex<double> expected = ((3.0*z + 2.0)*z - 1.0)*z + 1.0;
+    std::complex<double> computed = p(z);
+    CHECK_ULP_CLOSE(expected.real(), computed.real(), 8);
+    CHECK_ULP_CLOSE(expected.imag(), computed.imag(), 8);
+    // Complex arguments always use P/Q:
+    static_rational<double, 4> r(p, static_polynomial<double, 4>{1, 0, 0, 1});
+    std::complex<double> rz = r(z);
+    std::complex<double> rexpected = expected/(1.0 + z*z*z);
+    CHECK_ULP_CLOSE(rexpected.real(), rz.real(), 8);
+    CHECK_ULP_CLOSE(rexpected.imag(), rz.imag(), 8);
+}
+
+int main()
+{
+    test_constexpr();
+
+    test_schemes<float, 1>();
+    test_schemes<float, 7>();
+    test_schemes<double, 2>();
+    test_schemes<double, 3>();
+    test_schemes<double, 5>();
+    test_schemes<double, 8>();
+    test_schemes<double, 9>();
+    test_schemes<double, 17>();
+    test_schemes<double, 33>();
+    test_schemes<long double, 12>();
+    test_schemes<cpp_bin_float_50, 11>();
+
+    test_rational<float>();
+    test_rational<double>();
+    test_rational<long double>();
+    test_rational<cpp_bin_float_50>();
+
+    test_complex();
+    return boost::math::test::report_errors();
+}
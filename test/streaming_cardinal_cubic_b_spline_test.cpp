@@ -0,0 +1,148 @@
+/*
+ * Copyright agent, 2026
+ * Use, modification and distribution are subject to the
+ * Boost Software License, Version 1.0. (See accompanying file
+ * LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+ */
+
+#include "math_unit_test.hpp"
+#include <cmath>
+#include <vector>
+#include <boost/math/interpolators/streaming_cardinal_cubic_b_spline.hpp>
+#include <boost/math/interpolators/cardinal_cubic_b_spline.hpp>
+using boost::math::interpolators::streaming_cardinal_cubic_b_spline;
+using boost::math::interpolators::cardinal_cubic_b_spline;
+
+template<class Real>
+void test_constant()
+{
+    Real c = 7.2;
+    Real t0 = 0;
+    Real h = Real(1)/Real(16);
+    size_t capacity = 64;
+    auto scbs = streaming_cardinal_cubic_b_spline<Real>(t0, h, capacity);
+    auto dom = scbs.domain();
+    CHECK_NAN(dom.first);
+    CHECK_NAN(dom.second);
+
+    for (size_t i = 0; i < 1000; ++i) {
+        scbs.push_back(c);
+        dom = scbs.domain();
+        if (!std::isnan(dom.first)) {
+            Real t = dom.first;
+            while (t <= dom.second) {
+                CHECK_ULP_CLOSE(c, scbs(t), 5);
+                CHECK_MOLLIFIED_CLOSE(Real(0), scbs.prime(t), 200*std::numeric_limits<Real>::epsilon());
+                t += h/3;
+            }
+        }
+    }
+    CHECK_EQUAL(size_t(1000), scbs.size());
+    CHECK_EQUAL(capacity, scbs.capacity());
+    dom = scbs.domain();
+    // The window of retained coefficients slides with the stream:
+    CHECK_ULP_CLOSE(t0 + (1000 - scbs.latency() - capacity + 1)*h, dom.first, 0);
+    CHECK_ULP_CLOSE(t0 + (1000 - scbs.latency() - 2)*h, dom.second, 0);
+}
+
+template<class Real>
+void test_linear()
+{
+    Real m = 8.3;
+    Real b = 7.2;
+    Real t0 = -1;
+    Real h = Real(1)/Real(32);
+    auto scbs = streaming_cardinal_cubic_b_spline<Real>(t0, h, 128);
+    for (size_t i = 0; i < 300; ++i) {
+        Real t = t0 + i*h;
+        scbs.push_back(m*t + b);
+    }
+    auto dom = scbs.domain();
+    Real t = dom.first;
+    while (t <= dom.second) {
+        CHECK_MOLLIFIED_CLOSE(m*t + b, scbs(t), 30*std::numeric_limits<Real>::epsilon());
+        CHECK_MOLLIFIED_CLOSE(m, scbs.prime(t), 2000*std::numeric_limits<Real>::epsilon());
+        CHECK_MOLLIFIED_CLOSE(Real(0), scbs.double_prime(t), 500000*std::numeric_limits<Real>::epsilon());
+        t += h/7;
+    }
+}
+
+// Far from the left boundary, the streaming spline must agree with the batch spline:
+template<class Real>
+void test_agreement_with_batch()
+{
+    using std::sin;
+    Real t0 = 0;
+    Real h = Real(1)/Real(64);
+    size_t n = 2048;
+    std::vector<Real> y(n);
+    auto scbs = streaming_cardinal_cubic_b_spline<Real>(t0, h, 256);
+    for (size_t i = 0; i < n; ++i) {
+        y[i] = sin(t0 + i*h);
+        scbs.push_back(y[i]);
+    }
+    auto cbs = cardinal_cubic_b_spline<Real>(y.data(), y.size(), t0, h);
+
+    auto dom = scbs.domain();
+    Real t = dom.first;
+    while (t <= dom.second) {
+        CHECK_MOLLIFIED_CLOSE(cbs(t), scbs(t), 10*std::numeric_limits<Real>::epsilon());
+        CHECK_MOLLIFIED_CLOSE(cbs.prime(t), scbs.prime(t), 1000*std::numeric_limits<Real>::epsilon());
+        t += h/5;
+    }
+
+    // Interpolation condition:
+    size_t k = static_cast<size_t>((dom.first - t0)/h);
+    while (t0 + k*h <= dom.second) {
+        CHECK_ULP_CLOSE(y[k], scbs(t0 + k*h), 10);
+        ++k;
+    }
+}
+
+template<class Real>
+void test_out_of_domain()
+{
+    auto scbs = streaming_cardinal_cubic_b_spline<Real>(0, 1, 16);
+    bool threw = false;
+    try {
+        scbs(0);
+    }
+    catch (std::domain_error const &) {
+        threw = true;
+    }
+    CHECK_EQUAL(true, threw);
+    for (size_t i = 0; i < 100; ++i) {
+        scbs.push_back(1);
+    }
+    auto dom = scbs.domain();
+    threw = false;
+    try {
+        scbs(dom.second + 1);
+    }
+    catch (std::domain_error const &) {
+        threw = true;
+    }
+    CHECK_EQUAL(true, threw);
+}
+
+int main()
+{
+    test_constant<float>();
+    test_constant<double>();
+#ifndef BOOST_MATH_NO_LONG_DOUBLE_MATH_FUNCTIONS
+    test_constant<long double>();
+#endif
+
+    test_linear<double>();
+#ifndef BOOST_MATH_NO_LONG_DOUBLE_MATH_FUNCTIONS
+    test_linear<long double>();
+#endif
+
+    test_agreement_with_batch<double>();
+#ifndef BOOST_MATH_NO_LONG_DOUBLE_MATH_FUNCTIONS
+    test_agreement_with_batch<long double>();
+#endif
+
+    test_out_of_domain<double>();
+    return boost::math::test::report_errors();
+}
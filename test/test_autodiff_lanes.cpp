@@ -0,0 +1,132 @@
+//           Copyright agent 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//      (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#include "test_autodiff.hpp"
+#include <boost/math/differentiation/autodiff_lanes.hpp>
+
+BOOST_AUTO_TEST_SUITE(test_autodiff_lanes)
+
+constexpr std::size_t lanes = 8;
+
+// Each lane of f agrees with the computation g on a scalar fvar.
+template <typename T, std::size_t Order, typename Func, typename Reference>
+void check_lanes(std::array<T, lanes> const& x, Func const& f, Reference const& g, T const& eps) {
+  using std::fabs;
+  auto const r = f(make_fvar_lanes<T, Order>(x));
+  for (std::size_t j = 0; j < lanes; ++j) {
+    auto const expected = g(make_fvar<T, Order>(x[j]));
+    for (std::size_t i = 0; i <= Order; ++i) {
+      T const tol = eps * (std::max)(T(1), fabs(expected.derivative(i)));
+      BOOST_CHECK_SMALL(T(r.derivative(i)[j] - expected.derivative(i)), tol);
+    }
+  }
+}
+
+template <typename T, std::size_t Order, typename Func>
+void check_lanes(std::array<T, lanes> const& x, Func const& f, T const& eps) {
+  check_lanes<T, Order>(x, f, f, eps);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(arithmetic, T, bin_float_types) {
+  constexpr std::size_t m = 5;
+  T const eps = 1000 * std::numeric_limits<T>::epsilon();
+  test_detail::RandomSample<T> x_sampler{T(0.25), 4};
+  std::array<T, lanes> x;
+  for (auto& xj : x)
+    xj = x_sampler.next();
+  check_lanes<T, m>(x, [](auto const& y) { return y * y * y - T(2) * y + T(1); }, eps);
+  check_lanes<T, m>(x, [](auto const& y) { return (y + T(3)) / (y * y + T(1)); }, eps);
+  check_lanes<T, m>(x, [](auto const& y) { return T(1) / y - y / T(2); }, eps);
+  check_lanes<T, m>(x, [](auto y) { return (y *= y) /= (y - T(5)); }, eps);
+  auto const y = make_fvar_lanes<T, m>(x);
+  auto const z = y / y;
+  for (std::size_t j = 0; j < lanes; ++j) {
+    BOOST_CHECK_EQUAL(z.derivative(0)[j], T(1));
+    BOOST_CHECK_EQUAL(z.derivative(1)[j], T(0));
+  }
+  // Constants may differ from lane to lane:
+  detail::fvar_lanes<T, m, lanes> const c(x);
+  auto const w = y * c;
+  for (std::size_t j = 0; j < lanes; ++j) {
+    BOOST_CHECK_EQUAL(w.derivative(1)[j], x[j]);
+    BOOST_CHECK_EQUAL(w.derivative(2)[j], T(0));
+  }
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(elementary_functions, T, bin_float_types) {
+  using std::fabs;
+  constexpr std::size_t m = 5;
+  T const eps = 1000 * std::numeric_limits<T>::epsilon();
+  test_detail::RandomSample<T> x_sampler{-4, 4};
+  std::array<T, lanes> x;
+  for (auto& xj : x)
+    xj = x_sampler.next();
+  std::array<T, lanes> positive;
+  for (std::size_t j = 0; j < lanes; ++j)
+    positive[j] = fabs(x[j]) + T(0.125);
+  check_lanes<T, m>(x, [](auto const& y) { return exp(y); }, eps);
+  // The generic expm1 and log1p lose accuracy in the derivatives of a scalar fvar, so compare with exp and log:
+  check_lanes<T, m>(x, [](auto const& y) { return expm1(y); }, [](auto const& y) { return exp(y) - T(1); }, eps);
+  check_lanes<T, m>(positive, [](auto const& y) { return log(y); }, eps);
+  check_lanes<T, m>(positive, [](auto const& y) { return log1p(y); }, [](auto const& y) { return log(y + T(1)); }, eps);
+  check_lanes<T, m>(positive, [](auto const& y) { return sqrt(y); }, eps);
+  check_lanes<T, m>(positive, [](auto const& y) { return pow(y, T(2.5)); }, eps);
+  check_lanes<T, m>(positive, [](auto const& y) { return pow(y, y); }, eps);
+  check_lanes<T, m>(x, [](auto const& y) { return pow(T(1.5), y); }, eps);
+  check_lanes<T, m>(x, [](auto const& y) { return pow(y, T(3)); }, eps);
+  check_lanes<T, m>(x, [](auto const& y) { return sin(y); }, eps);
+  check_lanes<T, m>(x, [](auto const& y) { return cos(y); }, eps);
+  check_lanes<T, m>(x, [](auto const& y) { return atan(y); }, eps);
+  check_lanes<T, m>(x, [](auto const& y) { return sinh(y); }, eps);
+  check_lanes<T, m>(x, [](auto const& y) { return cosh(y); }, eps);
+  check_lanes<T, m>(x, [](auto const& y) { return tanh(y); }, eps);
+  check_lanes<T, m>(x, [](auto const& y) { return fabs(y); }, eps);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(special_functions, T, bin_float_types) {
+  using std::fabs;
+  constexpr std::size_t m = 4;
+  T const eps = 10000 * std::numeric_limits<T>::epsilon();
+  test_detail::RandomSample<T> x_sampler{-3, 3};
+  std::array<T, lanes> x;
+  for (auto& xj : x)
+    xj = x_sampler.next();
+  std::array<T, lanes> positive;
+  for (std::size_t j = 0; j < lanes; ++j)
+    positive[j] = fabs(x[j]) + T(0.25);
+  check_lanes<T, m>(x, [](auto const& y) { return erf(y); }, eps);
+  check_lanes<T, m>(x, [](auto const& y) { return erfc(y); }, eps);
+  check_lanes<T, m>(positive, [](auto const& y) { return lgamma(y); }, eps);
+  check_lanes<T, m>(positive, [](auto const& y) { return tgamma(y); }, eps);
+  check_lanes<T, m>(positive, [](auto const& y) { return digamma(y); }, eps);
+  // Negative non-integers, where the sign of tgamma alternates:
+  std::array<T, lanes> negative;
+  for (std::size_t j = 0; j < lanes; ++j)
+    negative[j] = -T(j) - T(0.375);
+  check_lanes<T, m>(negative, [](auto const& y) { return tgamma(y); }, eps);
+  check_lanes<T, m>(negative, [](auto const& y) { return lgamma(y); }, eps);
+}
+
+// Delta and gamma of a call for eight spot prices at once.
+BOOST_AUTO_TEST_CASE_TEMPLATE(black_scholes, T, bin_float_types) {
+  T const K = 100;
+  T const sigma = T(0.25);
+  T const tau = T(30) / 365;
+  T const r = T(1.25) / 100;
+  T const eps = 1000 * std::numeric_limits<T>::epsilon();
+  std::array<T, lanes> spots;
+  for (std::size_t j = 0; j < lanes; ++j)
+    spots[j] = 80 + 5 * T(j);
+  check_lanes<T, 2>(spots, [&](auto const& S) {
+    using std::exp;
+    using std::sqrt;
+    auto const d1 = (log(S / K) + (r + sigma * sigma / 2) * tau) / (sigma * sqrt(tau));
+    auto const d2 = d1 - sigma * sqrt(tau);
+    T const c = -boost::math::constants::one_div_root_two<T>();
+    return S * erfc(c * d1) / 2 - exp(-r * tau) * K * erfc(c * d2) / 2;
+  }, eps);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
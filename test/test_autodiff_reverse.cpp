@@ -0,0 +1,158 @@
+//           Copyright agent 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//      (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#include "test_autodiff.hpp"
+#include <boost/math/differentiation/autodiff_reverse.hpp>
+#include <boost/math/distributions/gamma.hpp>
+#include <boost/math/distributions/normal.hpp>
+#include <boost/math/distributions/students_t.hpp>
+
+BOOST_AUTO_TEST_SUITE(test_autodiff_reverse)
+
+// The adjoint of f agrees with the first derivative of the same computation on a forward mode fvar.
+template <typename T, typename Func>
+void check_forward(T const& x, Func const& f, T const& eps) {
+  using std::fabs;
+  autodiff_tape<T> t;
+  auto const xr = t.variable(x);
+  auto const y = f(xr);
+  t.propagate(y);
+  auto const expected = f(make_fvar<T, 1>(x));
+  BOOST_CHECK_SMALL(T(y.value() - expected.derivative(0)), eps * (std::max)(T(1), fabs(expected.derivative(0))));
+  BOOST_CHECK_SMALL(T(t.adjoint(xr) - expected.derivative(1)), eps * (std::max)(T(1), fabs(expected.derivative(1))));
+}
+
+// The adjoint of f agrees with a central difference of f.
+template <typename Func>
+void check_difference(double x, Func const& f) {
+  using std::fabs;
+  autodiff_tape<double> t;
+  auto const xr = t.variable(x);
+  auto const y = f(xr);
+  t.propagate(y);
+  double const h = 1e-5 * (std::max)(1.0, fabs(x));
+  double const expected = (f(autodiff_rvar<double>(x + h)).value() - f(autodiff_rvar<double>(x - h)).value()) / (2 * h);
+  BOOST_CHECK_SMALL(t.adjoint(xr) - expected, 1e-7 * (std::max)(1.0, fabs(expected)));
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(elementary_functions, T, bin_float_types) {
+  T const eps = 100 * std::numeric_limits<T>::epsilon();
+  test_detail::RandomSample<T> x_sampler{T(0.25), 3};
+  for (int i = 0; i < 10; ++i) {
+    T const x = x_sampler.next();
+    check_forward(x, [](auto const& y) { return y * y * y - T(2) * y + T(1); }, eps);
+    check_forward(x, [](auto const& y) { return (y + T(3)) / (y * y + T(1)) - T(1) / y; }, eps);
+    check_forward(x, [](auto const& y) { return exp(y) * log(y) / sqrt(y); }, eps);
+    check_forward(x, [](auto const& y) { return pow(y, T(2.5)) + pow(T(1.5), y) + pow(y, y); }, eps);
+    check_forward(x, [](auto const& y) { return sin(y) * cos(y) + tan(y) + atan(y); }, eps);
+    check_forward(x, [](auto const& y) { return sinh(y) - cosh(y) + tanh(y) + fabs(T(1) - y); }, eps);
+    check_forward(x, [](auto const& y) { return erf(y) + erfc(T(2) * y); }, eps);
+    check_forward(x, [](auto const& y) { return tgamma(y) + lgamma(y) + digamma(y); }, 10 * eps);
+    check_forward(x, [](auto y) {
+      y += T(1);
+      y *= y;
+      y -= T(2);
+      return y /= (y + T(5));
+    }, eps);
+  }
+}
+
+BOOST_AUTO_TEST_CASE(special_functions) {
+  test_detail::RandomSample<double> x_sampler{0.1, 0.9};
+  for (int i = 0; i < 10; ++i) {
+    double const x = x_sampler.next();
+    check_difference(x, [](auto const& y) { return ibeta(2.5, 3.25, y); });
+    check_difference(x, [](auto const& y) { return ibetac(0.75, 4.0, y); });
+    check_difference(x, [](auto const& y) { return gamma_p(2.5, 4 * y); });
+    check_difference(x, [](auto const& y) { return gamma_q(0.5, 4 * y); });
+    check_difference(x, [](auto const& y) { return cyl_bessel_j(1.5, 10 * y); });
+    check_difference(x, [](auto const& y) { return cyl_neumann(0.0, 10 * y); });
+    check_difference(x, [](auto const& y) { return cyl_bessel_i(2.0, 10 * y); });
+    check_difference(x, [](auto const& y) { return cyl_bessel_k(0.5, 10 * y); });
+    check_difference(x, [](auto const& y) { return cdf(boost::math::normal_distribution<double>(0.5, 2), y); });
+    check_difference(x, [](auto const& y) { return cdf(boost::math::gamma_distribution<double>(2, 0.5), y); });
+    check_difference(x, [](auto const& y) {
+      return cdf(boost::math::complement(boost::math::students_t_distribution<double>(3), y));
+    });
+  }
+}
+
+// A scalar loss of many parameters: every partial derivative from one sweep.
+BOOST_AUTO_TEST_CASE(gradient) {
+  std::size_t const n = 2000;
+  autodiff_tape<double> t;
+  std::vector<autodiff_rvar<double>> x;
+  for (std::size_t i = 0; i < n; ++i)
+    x.push_back(t.variable(1 + std::sin(double(i))));
+  // Rosenbrock
+  auto loss = [&x, n]() {
+    autodiff_rvar<double> sum = 0;
+    for (std::size_t i = 0; i + 1 < n; ++i) {
+      auto const a = x[i + 1] - x[i] * x[i];
+      auto const b = 1.0 - x[i];
+      sum += 100 * a * a + b * b;
+    }
+    return sum;
+  };
+  std::size_t const start = t.position();
+  std::vector<double> g(n);
+  std::vector<double> g2(n);
+  t.gradient(loss(), x.begin(), x.end(), g.begin());
+  std::size_t const length = t.position() - start;
+  // Rewinding reuses the tape for the next evaluation, with the same result:
+  t.rewind(start);
+  t.gradient(loss(), x.begin(), x.end(), g2.begin());
+  BOOST_CHECK_EQUAL(t.position() - start, length);
+  for (std::size_t i = 0; i < n; ++i) {
+    double expected = 0;
+    double const xi = x[i].value();
+    if (i + 1 < n)
+      expected += -400 * xi * (x[i + 1].value() - xi * xi) - 2 * (1 - xi);
+    if (i > 0)
+      expected += 200 * (xi - x[i - 1].value() * x[i - 1].value());
+    BOOST_CHECK_SMALL(g[i] - expected, 1e-12 * (std::max)(1.0, std::fabs(expected)));
+    BOOST_CHECK_EQUAL(g[i], g2[i]);
+  }
+  // Constants have no derivative:
+  BOOST_CHECK_EQUAL(t.adjoint(autodiff_rvar<double>(3)), 0.0);
+  // Each propagate starts from zero adjoints, including those of intermediate statements:
+  t.rewind(start);
+  auto const y1 = x[0] * x[1];
+  auto const y2 = y1 * x[0];
+  t.propagate(y2);
+  t.propagate(y2);
+  BOOST_CHECK_EQUAL(t.adjoint(x[0]), 2 * x[0].value() * x[1].value());
+  BOOST_CHECK_EQUAL(t.adjoint(x[1]), x[0].value() * x[0].value());
+  t.propagate(y1);
+  BOOST_CHECK_EQUAL(t.adjoint(x[0]), x[1].value());
+}
+
+// A checkpointed function costs the outer tape one statement, and gives the same derivatives.
+BOOST_AUTO_TEST_CASE(checkpoint_function) {
+  auto f = [](std::vector<autodiff_rvar<double>> const& v) {
+    autodiff_rvar<double> r = v[0];
+    for (int k = 0; k < 100; ++k)
+      r = sin(r) * v[1] + v[2];
+    return r;
+  };
+  autodiff_tape<double> direct;
+  std::vector<autodiff_rvar<double>> x{direct.variable(0.5), direct.variable(1.25), autodiff_rvar<double>(0.75)};
+  auto const y = exp(f(x));
+  std::vector<double> expected(2);
+  direct.gradient(y, x.begin(), x.begin() + 2, expected.begin());
+
+  autodiff_tape<double> outer;
+  std::vector<autodiff_rvar<double>> z{outer.variable(0.5), outer.variable(1.25), autodiff_rvar<double>(0.75)};
+  std::size_t const start = outer.position();
+  auto const w = exp(checkpoint(f, z));
+  BOOST_CHECK_EQUAL(outer.position() - start, 2u);
+  BOOST_CHECK_EQUAL(w.value(), y.value());
+  std::vector<double> computed(2);
+  outer.gradient(w, z.begin(), z.begin() + 2, computed.begin());
+  for (std::size_t i = 0; i < 2; ++i)
+    BOOST_CHECK_SMALL(computed[i] - expected[i], 1e-14 * (std::max)(1.0, std::fabs(expected[i])));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,85 @@
+//           Copyright agent 2026.
+// Distributed under the Boost Software License, Version 1.0.
+//      (See accompanying file LICENSE_1_0.txt or copy at
+//           https://www.boost.org/LICENSE_1_0.txt)
+
+#include "test_autodiff.hpp"
+#include <boost/math/differentiation/autodiff_taylor.hpp>
+
+BOOST_AUTO_TEST_SUITE(test_autodiff_taylor)
+
+struct f {
+  template <typename X, typename Y, typename Z>
+  auto operator()(X const& x, Y const& y, Z const& z) const {
+    return exp(x * sin(y * log(z) / x) + sqrt(x * z / (y + 1))) + x * x / tan(z) - pow(y, 3) * atan(x * z) / tanh(y);
+  }
+};
+
+BOOST_AUTO_TEST_CASE(tables) {
+  using tables = detail::taylor_tables<3, 2>;
+  BOOST_CHECK_EQUAL(tables::size, 10u);
+  tables const& t = tables::get();
+  // Graded lexicographic order:
+  std::array<std::array<size_t, 3>, 10> const expected{
+      {{{0, 0, 0}}, {{1, 0, 0}}, {{0, 1, 0}}, {{0, 0, 1}}, {{2, 0, 0}},
+       {{1, 1, 0}}, {{1, 0, 1}}, {{0, 2, 0}}, {{0, 1, 1}}, {{0, 0, 2}}}};
+  for (std::size_t k = 0; k < expected.size(); ++k)
+    BOOST_CHECK(t.exponents[k] == expected[k]);
+  BOOST_CHECK_EQUAL(t.begin[tables::size], tables::pairs);
+  // x*y is made of (x, y) and (y, x), and each factor of (constant, x*y) and (x*y, constant):
+  BOOST_CHECK_EQUAL(t.begin[6] - t.begin[5], 4u);
+}
+
+// Every derivative of total order at most Degree agrees with the nested fvar of make_ftuple.
+BOOST_AUTO_TEST_CASE_TEMPLATE(mixed_partials, T, bin_float_types) {
+  using std::fabs;
+  constexpr std::size_t degree = 3;
+  T const eps = 1000 * std::numeric_limits<T>::epsilon();
+  test_detail::RandomSample<T> x_sampler{T(0.5), 2};
+  // Away from the pole of tan(z) at pi/2, where neither side has any accuracy to spare:
+  test_detail::RandomSample<T> z_sampler{T(0.5), T(1.25)};
+  for (int sample = 0; sample < 5; ++sample) {
+    std::array<T, 3> x{{x_sampler.next(), x_sampler.next(), z_sampler.next()}};
+    auto const v = make_taylor_variables<T, degree>(x);
+    auto const r = f()(v[0], v[1], v[2]);
+    auto const variables = make_ftuple<T, degree, degree, degree>(x[0], x[1], x[2]);
+    auto const expected = f()(std::get<0>(variables), std::get<1>(variables), std::get<2>(variables));
+    for (std::size_t i = 0; i <= degree; ++i) {
+      for (std::size_t j = 0; j <= degree; ++j) {
+        for (std::size_t k = 0; k <= degree; ++k) {
+          if (i + j + k <= degree) {
+            T const e = expected.derivative(i, j, k);
+            BOOST_CHECK_SMALL(T(r.derivative(i, j, k) - e), eps * (std::max)(T(1), fabs(e)));
+          } else {
+            BOOST_CHECK_EQUAL(r.derivative(i, j, k), T(0));
+          }
+        }
+      }
+    }
+  }
+}
+
+// A Hessian of a function of many variables, from a single evaluation.
+BOOST_AUTO_TEST_CASE(hessian) {
+  constexpr std::size_t n = 12;
+  std::array<double, n> x;
+  for (std::size_t i = 0; i < n; ++i)
+    x[i] = 1 + 0.1 * double(i);
+  auto const v = make_taylor_variables<double, 2>(x);
+  // sum of x[i]*x[i+1]^2 / x[i+2]
+  autodiff_taylor<double, n, 2> sum = 0;
+  for (std::size_t i = 0; i + 2 < n; ++i)
+    sum += v[i] * v[i + 1] * v[i + 1] / v[i + 2];
+  double const tol = 1e-13;
+  std::array<std::size_t, n> orders{};
+  // d2/dx1^2 involves the terms i = 0 (x0*x1^2/x2) only:
+  orders[1] = 2;
+  BOOST_CHECK_SMALL(sum.derivative(orders) - 2 * x[0] / x[2], tol);
+  // d2/dx3dx4 involves i = 2 (x2*x3^2/x4) and i = 3 (x3*x4^2/x5):
+  orders = {};
+  orders[3] = orders[4] = 1;
+  BOOST_CHECK_SMALL(sum.derivative(orders) - (-2 * x[2] * x[3] / (x[4] * x[4]) + 2 * x[4] / x[5]), tol);
+  BOOST_CHECK_EQUAL(sum.derivative(0, 0, 0, 0, 0, 0, 0, 0, 0, 3), 0.0);
+}
+
+BOOST_AUTO_TEST_SUITE_END()